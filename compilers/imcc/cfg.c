@@ -281,7 +281,7 @@ find_basic_blocks(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), int first)
 
     ins = unit->instructions;
 
-    if (unit->type & IMC_PCCSUB) {
+    if ((unit->type & IMC_PCCSUB) && first) {
         IMCC_debug(imcc, DEBUG_CFG, "pcc_sub %s nparams %d\n",
                 ins->symregs[0]->name, ins->symregs[0]->pcc_sub->nargs);
         expand_pcc_sub(imcc, unit, ins);
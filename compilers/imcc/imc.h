@@ -420,6 +420,7 @@ typedef struct subs_t {
     IMC_Unit      *unit;
     struct subs_t *prev;
     struct subs_t *next;
+    struct subs_t *next_by_name;       /* next sub with the same label */
     SymHash        fixup;              /* currently set_p_pc sub names only */
     int            ins_line;           /* line number for debug */
     int            n_basic_blocks;     /* block count */
@@ -482,6 +483,9 @@ struct _imc_info_t {
     SymReg               *keys[IMCC_MAX_FIX_REGS]; /* TODO key overflow check */
     AsmState              asm_state;
     SymHash               ghash;
+    SymReg              **ghash_pending;   /* ghash entries not yet folded */
+    unsigned int          n_ghash_pending;
+    unsigned int          ghash_pending_size;
     jmp_buf               jump_buf;        /* The jump for error  handling */
     int                   IMCC_DEBUG;
     int                   cnr;
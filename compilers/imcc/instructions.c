@@ -136,8 +136,7 @@ instruction_reads(ARGIN(const Instruction *ins), ARGIN(const SymReg *r))
 
     /* a sub call reads the previous args */
     if (ins->type & ITPCCSUB) {
-        while (ins && ins->op != &core_ops->op_info_table[PARROT_OP_set_args_pc])
-            ins = ins->prev;
+        ins = instruction_call_args(ins);
 
         if (!ins)
             return 0;
@@ -190,14 +189,12 @@ instruction_writes(ARGIN(const Instruction *ins), ARGIN(const SymReg *r))
     }
     else if (ins->type & ITPCCSUB) {
         int i;
-        ins = ins->prev;
         /* can't used pcc_sub->ret due to bug #38406
          * it seems that all sub SymRegs are shared
          * and point to the most recent pcc_sub
          * structure
          */
-        while (ins && ins->op != &core_ops->op_info_table[PARROT_OP_get_results_pc])
-            ins = ins->next;
+        ins = instruction_call_results(ins);
 
         if (!ins)
             return 0;
@@ -234,6 +231,74 @@ instruction_writes(ARGIN(const Instruction *ins), ARGIN(const SymReg *r))
 }
 
 
+/*
+
+=item C<const Instruction * instruction_call_args(const Instruction *call)>
+
+Returns the C<set_args> instruction of the sub call C<call>, or NULL if it has
+none.  The search stops at the previous call and at the start of the block.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const Instruction *
+instruction_call_args(ARGIN(const Instruction *call))
+{
+    ASSERT_ARGS(instruction_call_args)
+    const op_info_t * const set_args =
+        &PARROT_GET_CORE_OPLIB(NULL)->op_info_table[PARROT_OP_set_args_pc];
+    const Instruction *ins;
+
+    for (ins = call->prev; ins; ins = ins->prev) {
+        if (ins->op == set_args)
+            return ins;
+
+        if (ins->type & (ITPCCSUB | ITBRANCH | ITLABEL))
+            break;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<const Instruction * instruction_call_results(const Instruction *call)>
+
+Returns the C<get_results> instruction following the sub call C<call>, or
+NULL if it has none, like a tailcall.  The search stops at the next call, label
+or branch.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const Instruction *
+instruction_call_results(ARGIN(const Instruction *call))
+{
+    ASSERT_ARGS(instruction_call_results)
+    const op_info_t * const get_results =
+        &PARROT_GET_CORE_OPLIB(NULL)->op_info_table[PARROT_OP_get_results_pc];
+    const Instruction *ins;
+
+    if (call->opname && strncmp(call->opname, "tailcall", 8) == 0)
+        return NULL;
+
+    for (ins = call->next; ins; ins = ins->next) {
+        if (ins->op == get_results)
+            return ins;
+
+        if (ins->type & (ITPCCSUB | ITBRANCH | ITLABEL))
+            break;
+    }
+
+    return NULL;
+}
+
 /*
 
 =item C<int get_branch_regno(const Instruction *ins)>
@@ -158,6 +158,16 @@ void insert_ins(
         FUNC_MODIFIES(*ins)
         FUNC_MODIFIES(*tmp);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const Instruction * instruction_call_args(ARGIN(const Instruction *call))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const Instruction * instruction_call_results(ARGIN(const Instruction *call))
+        __attribute__nonnull__(1);
+
 int instruction_reads(ARGIN(const Instruction *ins), ARGIN(const SymReg *r))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -233,6 +243,10 @@ void subst_ins(
 #define ASSERT_ARGS_insert_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(tmp))
+#define ASSERT_ARGS_instruction_call_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(call))
+#define ASSERT_ARGS_instruction_call_results __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(call))
 #define ASSERT_ARGS_instruction_reads __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ins) \
     , PARROT_ASSERT_ARG(r))
@@ -13,6 +13,9 @@
 
 /* HEADERIZER HFILE: compilers/imcc/pbc.h */
 
+/* longest op sequence replaced by a superinstruction */
+#define IMCC_MAX_SUPEROP_LENGTH 3
+
 /*
 
 =head1 NAME
@@ -111,6 +114,15 @@ static opcode_t build_key(
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(* bc);
 
+PARROT_WARN_UNUSED_RESULT
+static int can_fuse_ins(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const Instruction *ins),
+    int last)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc);
+
 static void constant_folding(
     ARGMOD(imc_info_t * imcc),
     ARGIN(const IMC_Unit *unit),
@@ -141,15 +153,14 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static subs_t * find_global_label(
     ARGMOD(imc_info_t * imcc),
+    ARGIN(Hash *labels),
     ARGIN(const char *name),
-    ARGIN(const subs_t *sym),
-    ARGOUT(int *pc))
+    ARGIN(const subs_t *sym))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         __attribute__nonnull__(4)
-        FUNC_MODIFIES(* imcc)
-        FUNC_MODIFIES(*pc);
+        FUNC_MODIFIES(* imcc);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -160,23 +171,29 @@ static PMC* find_outer(
         __attribute__nonnull__(2)
         FUNC_MODIFIES(* imcc);
 
-PARROT_WARN_UNUSED_RESULT
+static void fixup_globals(ARGMOD(imc_info_t * imcc))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(* imcc);
+
 PARROT_CAN_RETURN_NULL
-static subs_t * find_sub_by_subid(
+static Instruction * fuse_ins(
     ARGMOD(imc_info_t * imcc),
-    ARGIN(const char *lookup),
-    ARGIN(const subs_t *sym),
-    ARGOUT(int *pc))
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Instruction *ins),
+    int n)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
-        __attribute__nonnull__(4)
         FUNC_MODIFIES(* imcc)
-        FUNC_MODIFIES(*pc);
+        FUNC_MODIFIES(*unit);
 
-static void fixup_globals(ARGMOD(imc_info_t * imcc))
+static void fuse_superinstructions(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
-        FUNC_MODIFIES(* imcc);
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
 
 PARROT_WARN_UNUSED_RESULT
 static size_t get_code_size(
@@ -304,6 +321,9 @@ static void verify_signature(
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(key_reg) \
     , PARROT_ASSERT_ARG(bc))
+#define ASSERT_ARGS_can_fuse_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ins))
 #define ASSERT_ARGS_constant_folding __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit) \
@@ -315,19 +335,21 @@ static void verify_signature(
     , PARROT_ASSERT_ARG(bc))
 #define ASSERT_ARGS_find_global_label __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(labels) \
     , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(sym) \
-    , PARROT_ASSERT_ARG(pc))
+    , PARROT_ASSERT_ARG(sym))
 #define ASSERT_ARGS_find_outer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
-#define ASSERT_ARGS_find_sub_by_subid __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(imcc) \
-    , PARROT_ASSERT_ARG(lookup) \
-    , PARROT_ASSERT_ARG(sym) \
-    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_fixup_globals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc))
+#define ASSERT_ARGS_fuse_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_fuse_superinstructions __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_get_code_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit) \
@@ -644,6 +666,150 @@ store_key_const(ARGMOD(imc_info_t * imcc), ARGIN(const char *str), int idx)
 
 /*
 
+=item C<static int can_fuse_ins(imc_info_t * imcc, const Instruction *ins, int
+last)>
+
+Returns true if C<ins> can be part of a superinstruction, as its last
+instruction if C<last> is set.  Instructions with variable-length arguments
+and C<set_p_pc>, which needs a global fixup at its own position, are never
+fused; neither are branches unless they end the superinstruction.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+can_fuse_ins(ARGMOD(imc_info_t * imcc), ARGIN(const Instruction *ins), int last)
+{
+    ASSERT_ARGS(can_fuse_ins)
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(imcc->interp);
+    const op_info_t * const op = ins->op;
+
+    if (!op || op->lib != core_ops || ins->opsize != op->op_count)
+        return 0;
+
+    if (!last && (ins->type & ITBRANCH))
+        return 0;
+
+    switch (OP_INFO_OPNUM(op)) {
+      case PARROT_OP_set_p_pc:
+      case PARROT_OP_set_args_pc:
+      case PARROT_OP_get_results_pc:
+      case PARROT_OP_get_params_pc:
+      case PARROT_OP_set_returns_pc:
+        return 0;
+      default:
+        return 1;
+    }
+}
+
+/*
+
+=item C<static Instruction * fuse_ins(imc_info_t * imcc, IMC_Unit *unit,
+Instruction *ins, int n)>
+
+If the core oplib has a superinstruction for the C<n> instructions starting at
+C<ins>, replaces them with it and returns the new instruction.  Otherwise
+returns NULL.
+
+The superinstruction takes the arguments of all of the fused instructions in
+order; C<INS> derives its register usage and branch flags from the op info.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static Instruction *
+fuse_ins(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit), ARGIN(Instruction *ins), int n)
+{
+    ASSERT_ARGS(fuse_ins)
+    /* INS appends the argument types to the name, so leave room for them */
+    char         fullname[64] = "";
+    SymReg      *regs[PARROT_MAX_ARGS];
+    op_info_t   *op;
+    Instruction *tmp;
+    Instruction *fused;
+    int          keys  = 0;
+    int          nargs = 0;
+    int          i;
+
+    for (i = 0, tmp = ins; i < n; ++i, tmp = tmp->next) {
+        int j;
+
+        if (!tmp || !can_fuse_ins(imcc, tmp, i == n - 1))
+            return NULL;
+
+        nargs += tmp->symreg_count;
+
+        if (nargs >= PARROT_MAX_ARGS
+        ||  strlen(fullname) + strlen(tmp->op->full_name) + 3 * nargs + 3 > sizeof (fullname))
+            return NULL;
+
+        if (i)
+            strcat(fullname, "__");
+
+        strcat(fullname, tmp->op->full_name);
+
+        for (j = 0; j < tmp->symreg_count; ++j)
+            regs[nargs - tmp->symreg_count + j] = tmp->symregs[j];
+
+        keys |= tmp->keys << (nargs - tmp->symreg_count);
+    }
+
+    op = (op_info_t *)Parrot_hash_get(imcc->interp, imcc->interp->op_hash, fullname);
+    if (!op || !STREQ(op->full_name, fullname) || op->op_count != nargs + 1)
+        return NULL;
+
+    fused       = INS(imcc, unit, fullname, NULL, regs, nargs, keys, 0);
+    fused->line = ins->line;
+
+    IMCC_debug(imcc, DEBUG_PBC, "fused %d instructions into %s\n", n, fullname);
+
+    subst_ins(unit, ins, fused, 1);
+
+    for (i = 1, tmp = fused->next; i < n; ++i)
+        tmp = delete_ins(unit, tmp);
+
+    return fused;
+}
+
+/*
+
+=item C<static void fuse_superinstructions(imc_info_t * imcc, IMC_Unit *unit)>
+
+Replaces sequences of instructions for which the core oplib has a
+superinstruction (see F<src/ops/ops.super>) with that superinstruction,
+preferring the longest match.  A labelled instruction never continues a
+sequence, since the label sits between it and the instruction before.
+
+=cut
+
+*/
+
+static void
+fuse_superinstructions(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(fuse_superinstructions)
+    Instruction *ins;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int n;
+
+        for (n = IMCC_MAX_SUPEROP_LENGTH; n > 1; --n) {
+            Instruction * const fused = fuse_ins(imcc, unit, ins, n);
+
+            if (fused) {
+                ins = fused;
+                break;
+            }
+        }
+    }
+}
+
+/*
+
 =item C<static size_t get_code_size(imc_info_t * imcc, const IMC_Unit *unit,
 size_t *src_lines)>
 
@@ -826,11 +992,11 @@ bytecode_map_op(ARGMOD(imc_info_t * imcc), op_info_t *info) {
 
 /*
 
-=item C<static subs_t * find_global_label(imc_info_t * imcc, const char *name,
-const subs_t *sym, int *pc)>
+=item C<static subs_t * find_global_label(imc_info_t * imcc, Hash *labels, const
+char *name, const subs_t *sym)>
 
-Finds a global label, returning the symreg (and setting the (absolute) pc
-through the out parameter).
+Finds the sub of a global label in C<labels>, the first sub with that label in
+the same namespace as C<sym>.
 
 =cut
 
@@ -839,60 +1005,18 @@ through the out parameter).
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static subs_t *
-find_global_label(ARGMOD(imc_info_t * imcc), ARGIN(const char *name),
-    ARGIN(const subs_t *sym), ARGOUT(int *pc))
+find_global_label(ARGMOD(imc_info_t * imcc), ARGIN(Hash *labels),
+    ARGIN(const char *name), ARGIN(const subs_t *sym))
 {
     ASSERT_ARGS(find_global_label)
     subs_t *s;
 
-    *pc = 0;
-
-    for (s = imcc->globals->cs->first; s; s = s->next) {
-        const SymReg * const r = s->unit->instructions->symregs[0];
-
-        /* if names and namespaces are matching - ok */
-        if (r && r->name && (strcmp(r->name, name) == 0)
-                && ((sym->unit->_namespace && s->unit->_namespace
-                        && (strcmp(sym->unit->_namespace->name, s->unit->_namespace->name) == 0))
-                    || (!sym->unit->_namespace && !s->unit->_namespace)))
+    for (s = (subs_t *)Parrot_hash_get(imcc->interp, labels, name); s; s = s->next_by_name) {
+        /* if namespaces are matching - ok */
+        if ((sym->unit->_namespace && s->unit->_namespace
+                && (strcmp(sym->unit->_namespace->name, s->unit->_namespace->name) == 0))
+            || (!sym->unit->_namespace && !s->unit->_namespace))
             return s;
-
-        *pc += s->size;
-    }
-    return NULL;
-}
-
-/*
-
-=item C<static subs_t * find_sub_by_subid(imc_info_t * imcc, const char *lookup,
-const subs_t *sym, int *pc)>
-
-Find the first sub in the current code segment with a given subid.
-
-=cut
-
-*/
-
-PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static subs_t *
-find_sub_by_subid(ARGMOD(imc_info_t * imcc), ARGIN(const char *lookup),
-    ARGIN(const subs_t *sym), ARGOUT(int *pc))
-{
-    ASSERT_ARGS(find_sub_by_subid)
-    subs_t *s;
-    UNUSED(sym);
-
-    *pc = 0;
-
-    for (s = imcc->globals->cs->first; s; s = s->next) {
-        const SymReg * const r = s->unit->instructions->symregs[0];
-
-        /* if subid matches - ok */
-        if (r && (r->subid && (strcmp(r->subid->name, lookup) == 0)))
-            return s;
-
-        *pc += s->size;
     }
     return NULL;
 }
@@ -915,6 +1039,25 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
     int     jumppc = 0;
     op_lib_t *core_ops = PARROT_GET_CORE_OPLIB(imcc->interp);
     PackFile_ByteCode * const bc = Parrot_pf_get_current_code_segment(imcc->interp);
+    Hash * const labels = Parrot_hash_new_cstring_hash(imcc->interp);
+    Hash * const subids = Parrot_hash_new_cstring_hash(imcc->interp);
+
+    /* index the subs by label and subid once, instead of searching all subs
+     * for every fixup; going backwards leaves the first match in front */
+    for (s = imcc->globals->cs->subs; s; s = s->prev) {
+        SymReg * const r = s->unit->instructions->symregs[0];
+
+        if (!r)
+            continue;
+
+        if (r->name) {
+            s->next_by_name = (subs_t *)Parrot_hash_get(imcc->interp, labels, r->name);
+            Parrot_hash_put(imcc->interp, labels, r->name, s);
+        }
+
+        if (r->subid)
+            Parrot_hash_put(imcc->interp, subids, r->subid->name, s);
+    }
 
     for (s = imcc->globals->cs->first; s; s = s->next) {
         const SymHash * const hsh = &s->fixup;
@@ -924,7 +1067,7 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
             SymReg *fixup;
 
             for (fixup = hsh->data[i]; fixup; fixup = fixup->next) {
-                int pc, pmc_const;
+                int pmc_const;
                 const int addr = jumppc + fixup->color;
                 int subid_lookup = 0;
                 subs_t *s1;
@@ -934,11 +1077,10 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
                     s1 = NULL;
                 else if (fixup->usage & U_SUBID_LOOKUP) {
                     subid_lookup = 1;
-                    /* s1 = find_sub_by_subid(interp, fixup->name, &pc); */
-                    s1 = find_sub_by_subid(imcc, fixup->name, s, &pc);
+                    s1 = (subs_t *)Parrot_hash_get(imcc->interp, subids, fixup->name);
                 }
                 else if (fixup->usage & U_LEXINFO_LOOKUP) {
-                    s1 = find_sub_by_subid(imcc, fixup->name, s, &pc);
+                    s1 = (subs_t *)Parrot_hash_get(imcc->interp, subids, fixup->name);
                     if (!s1 || s1->pmc_const == -1)
                         IMCC_fataly(imcc, EXCEPTION_INVALID_OPERATION,
                                 "Sub '%s' not found\n", fixup->name);
@@ -956,7 +1098,7 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
                     continue;
                 }
                 else
-                    s1 = find_global_label(imcc, fixup->name, s, &pc);
+                    s1 = find_global_label(imcc, labels, fixup->name, s);
 
                 /*
                  * if failed change opcode:
@@ -1025,6 +1167,9 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
 
         jumppc += s->size;
     }
+
+    Parrot_hash_destroy(imcc->interp, labels);
+    Parrot_hash_destroy(imcc->interp, subids);
 }
 
 
@@ -1172,6 +1317,7 @@ add_const_str(ARGMOD(imc_info_t * imcc), ARGIN(STRING *s),
         ct->string_hash = Parrot_hash_create(imcc->interp, enum_type_INTVAL,
                 Hash_key_type_STRING_enc);
 
+    s = Parrot_str_intern(imcc->interp, s);
     ct->str.constants[ct->str.const_count] = s;
 
     Parrot_hash_put(imcc->interp, ct->string_hash, s,
@@ -2114,31 +2260,35 @@ constant_folding(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
         ARGMOD(PackFile_ByteCode * bc))
 {
     ASSERT_ARGS(constant_folding)
-    const SymHash *hsh = &imcc->ghash;
-    unsigned int   i;
+    const SymHash *hsh;
+    unsigned int   i, kept;
 
-    /* go through all consts of current sub */
-    for (i = 0; i < hsh->size; i++) {
-        SymReg *r;
+    /* normally constants are in ghash ... but only the entries not yet
+     * folded by an earlier unit need a look; ghash grows with every unit */
+    for (i = kept = 0; i < imcc->n_ghash_pending; i++) {
+        SymReg * const r = imcc->ghash_pending[i];
 
-        /* normally constants are in ghash ... */
-        for (r = hsh->data[i]; r; r = r->next) {
-            if (r->type & (VTCONST|VT_CONSTP))
-                add_1_const(imcc, r, bc);
+        if (r->type & (VTCONST|VT_CONSTP))
+            add_1_const(imcc, r, bc);
 
-            if (r->usage & U_LEXICAL) {
-                SymReg *n = r->reg;
+        if (r->usage & U_LEXICAL) {
+            SymReg *n = r->reg;
 
-                /* r->reg is a chain of names for the same lex sym */
-                while (n) {
-                    /* lex_name */
-                    add_1_const(imcc, n, bc);
-                    n = n->reg;
-                }
+            /* r->reg is a chain of names for the same lex sym */
+            while (n) {
+                /* lex_name */
+                add_1_const(imcc, n, bc);
+                n = n->reg;
             }
         }
+
+        /* unused constants may be used by a later unit; others are done */
+        if ((r->type & (VTCONST|VT_CONSTP)) && r->color < 0 && r->use_count <= 0)
+            imcc->ghash_pending[kept++] = r;
     }
 
+    imcc->n_ghash_pending = kept;
+
     /* ... but keychains 'K' are in local hash, they may contain
      * variables and constants */
     hsh = &unit->hash;
@@ -2163,19 +2313,23 @@ constant_folding(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
 =item C<void e_pbc_new_sub(imc_info_t * imcc, void *param, IMC_Unit *unit)>
 
 Starts a new PBC emitting of a compilation unit, if the given compilation unit
-has any instructions.
+has any instructions.  When optimizing (C<-O1> and up), sequences of
+instructions with a superinstruction in the core oplib are fused first.
 
 =cut
 
 */
 
 void
-e_pbc_new_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGIN(IMC_Unit *unit))
+e_pbc_new_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGMOD(IMC_Unit *unit))
 {
     ASSERT_ARGS(e_pbc_new_sub)
     if (!unit->instructions)
         return;
 
+    if (imcc->optimizer_level & OPT_PRE)
+        fuse_superinstructions(imcc, unit);
+
     /* we start a new compilation unit */
     make_new_sub(imcc, unit);
 }
@@ -33,11 +33,47 @@ The following parts are just missing:
 #include "imc.h"
 #include "optimizer.h"
 
+/* register reads and writes of all instructions, and the symbols live on
+ * entry to each basic block, as used by liveness_reg_alloc() */
+typedef struct live_info_t {
+    unsigned int   n_symbols;   /* symbols on unit->reglist */
+    unsigned int  *ins_refs;    /* first ref of each instruction, by index */
+    unsigned int  *ref_sym;     /* reglist index of each ref */
+    unsigned char *ref_kind;    /* REF_READ and/or REF_WRITE */
+    unsigned int   n_refs;
+    unsigned int   size;        /* allocated refs */
+    Set          **live_in;     /* by basic block index */
+} Live_info;
+
+#define REF_READ  1
+#define REF_WRITE 2
+
+/* color_reg_set() keeps an interference bit matrix per register kind, so
+ * units with more symbols of one kind than this use vanilla_reg_alloc() */
+#define LIVENESS_MAX_SYMBOLS 4096
+
 /* HEADERIZER HFILE: compilers/imcc/imc.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void add_ins_ref(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGMOD(Live_info *li),
+    ARGIN(const Instruction *ins),
+    ARGIN(const SymReg *r),
+    ARGMOD(unsigned int *seen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*li)
+        FUNC_MODIFIES(*seen);
+
 static void allocate_lexicals(
     ARGMOD(imc_info_t * imcc),
     ARGMOD(IMC_Unit *unit))
@@ -61,15 +97,62 @@ static void build_reglist(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(*unit);
 
+static void collect_ins_refs(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGOUT(Live_info *li))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*li);
+
+static void color_reg_set(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(const Live_info *li),
+    ARGIN(const Set *pinned),
+    int j,
+    int reg_set)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
 static void compute_du_chain(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+static void compute_liveness(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGMOD(Live_info *li))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*li);
+
 static void compute_one_du_chain(ARGMOD(SymReg *r), ARGIN(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*r);
 
+PARROT_WARN_UNUSED_RESULT
+static int find_pinned(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Live_info *li),
+    ARGMOD(Set *pinned))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*pinned);
+
 PARROT_WARN_UNUSED_RESULT
 static unsigned int first_avail(
     ARGMOD(imc_info_t * imcc),
@@ -85,6 +168,33 @@ static void imc_stat_init(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+PARROT_CANNOT_RETURN_NULL
+static Set * live_out(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const Live_info *li),
+    ARGIN(const Basic_block *bb))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc);
+
+static void live_transfer(
+    ARGIN(const Live_info *li),
+    ARGIN(const Instruction *ins),
+    ARGMOD(Set *live))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*live);
+
+static void liveness_reg_alloc(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
 static void make_stat(
     ARGMOD(IMC_Unit *unit),
     ARGMOD_NULLOK(int *sets),
@@ -117,6 +227,13 @@ static void vanilla_reg_alloc(
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(*unit);
 
+#define ASSERT_ARGS_add_ins_ref __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(li) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(r) \
+    , PARROT_ASSERT_ARG(seen))
 #define ASSERT_ARGS_allocate_lexicals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -126,16 +243,45 @@ static void vanilla_reg_alloc(
 #define ASSERT_ARGS_build_reglist __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_collect_ins_refs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(li))
+#define ASSERT_ARGS_color_reg_set __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(li) \
+    , PARROT_ASSERT_ARG(pinned))
 #define ASSERT_ARGS_compute_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_compute_liveness __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(li))
 #define ASSERT_ARGS_compute_one_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_find_pinned __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(li) \
+    , PARROT_ASSERT_ARG(pinned))
 #define ASSERT_ARGS_first_avail __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_imc_stat_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_live_out __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(li) \
+    , PARROT_ASSERT_ARG(bb))
+#define ASSERT_ARGS_live_transfer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(li) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(live))
+#define ASSERT_ARGS_liveness_reg_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_make_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_print_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -168,6 +314,7 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
 {
     ASSERT_ARGS(imc_reg_alloc)
     const char *function;
+    int         first;
 
     if (!unit)
         return;
@@ -197,9 +344,10 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     /* all lexicals get a unique register */
     allocate_lexicals(imcc, unit);
 
-    /* build CFG and life info, and optimize iteratively */
+    /* build CFG and life info, and optimize iteratively; the PCC
+     * directives are expanded on the first pass only */
+    first = 1;
     do {
-        int first = 1;
         do {
             while (pre_optimize(imcc, unit)) { };
 
@@ -222,8 +370,11 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     if (imcc->debug & DEBUG_IMC)
         dump_symreg(unit);
 
-    /* TODO add option for a better allocator */
-    vanilla_reg_alloc(imcc, unit);
+    if ((imcc->optimizer_level & (OPT_PRE|OPT_CFG))
+    &&  !imcc->dont_optimize && !unit->pasm_file)
+        liveness_reg_alloc(imcc, unit);
+    else
+        vanilla_reg_alloc(imcc, unit);
 
     if (imcc->debug & DEBUG_IMC)
         dump_instructions(imcc, unit);
@@ -764,6 +915,567 @@ vanilla_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static void liveness_reg_alloc(imc_info_t * imcc, IMC_Unit *unit)>
+
+Liveness based register allocator, used from C<-O1> on. Computes which
+symbols are live at each instruction from the CFG and colors the resulting
+interference graph, so that symbols which are never live at the same time
+share a register. This keeps the register frames of big subs small.
+
+Units with more than C<LIVENESS_MAX_SYMBOLS> symbols of one register kind are
+left to C<vanilla_reg_alloc>, as the interference graph would get too big.
+
+Lexicals still get a register of their own, as does every symbol used in
+code reachable from a block that control can enter without a CFG edge:
+exception handlers, C<set_addr> and C<set_label> targets and
+C<local_branch> return points. A frame re-entered through a
+return continuation after it moved on is not covered; such code must not
+be compiled with C<-O1>.
+
+=cut
+
+*/
+
+static void
+liveness_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(liveness_reg_alloc)
+    const char    type[] = "INSP";
+    SymHash      *hsh    = &unit->hash;
+    Live_info     li;
+    Set          *pinned;
+    unsigned int  i, n_set[4] = { 0, 0, 0, 0 };
+    int           j;
+
+    IMCC_info(imcc, 2, "liveness_reg_alloc\n");
+
+    for (i = 0; i < unit->n_symbols; i++)
+        for (j = 0; j < 4; j++)
+            if (unit->reglist[i]->set == type[j]
+            &&  ++n_set[j] > LIVENESS_MAX_SYMBOLS) {
+                IMCC_debug(imcc, DEBUG_IMC, "liveness: too many %c symbols\n", type[j]);
+                vanilla_reg_alloc(imcc, unit);
+                return;
+            }
+
+    /* Clear the pre-assigned colors. While the analysis runs, the color
+     * of a symbol on the reglist is its index there. */
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+        for (r = hsh->data[i]; r; r = r->next) {
+            if (REG_NEEDS_ALLOC(r))
+                r->color = -1;
+        }
+    }
+
+    for (i = 0; i < unit->n_symbols; i++)
+        unit->reglist[i]->color = i;
+
+    collect_ins_refs(imcc, unit, &li);
+    compute_liveness(imcc, unit, &li);
+
+    pinned = set_make(imcc, li.n_symbols);
+
+    if (find_pinned(imcc, unit, &li, pinned)) {
+        for (i = 0; i < unit->n_symbols; i++)
+            unit->reglist[i]->color = -1;
+
+        for (j = 0; j < 4; j++)
+            color_reg_set(imcc, unit, &li, pinned, j, type[j]);
+
+        /* symbols no instruction refers to don't need a register */
+        for (i = 0; i < hsh->size; i++) {
+            SymReg *r;
+            for (r = hsh->data[i]; r; r = r->next) {
+                if (REG_NEEDS_ALLOC(r) && r->color == -1
+                && (r->set == 'I' || r->set == 'N'
+                ||  r->set == 'S' || r->set == 'P'))
+                    r->color = 0;
+            }
+        }
+    }
+    else {
+        IMCC_debug(imcc, DEBUG_IMC, "liveness: escaping label not found\n");
+        vanilla_reg_alloc(imcc, unit);
+    }
+
+    set_free(pinned);
+
+    for (i = 0; i < unit->n_basic_blocks; i++)
+        set_free(li.live_in[i]);
+
+    mem_sys_free(li.live_in);
+    mem_sys_free(li.ins_refs);
+    mem_sys_free(li.ref_sym);
+    mem_sys_free(li.ref_kind);
+}
+
+/*
+
+=item C<static void collect_ins_refs(imc_info_t * imcc, const IMC_Unit *unit,
+Live_info *li)>
+
+Records which reglist symbols each instruction of the unit reads and writes.
+
+=cut
+
+*/
+
+static void
+collect_ins_refs(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
+        ARGOUT(Live_info *li))
+{
+    ASSERT_ARGS(collect_ins_refs)
+    Instruction  *ins;
+    unsigned int *seen;
+    unsigned int  n_ins = 0;
+
+    for (ins = unit->instructions; ins; ins = ins->next)
+        n_ins++;
+
+    li->n_symbols = unit->n_symbols;
+    li->n_refs    = 0;
+    li->size      = 2 * n_ins + 16;
+    li->ins_refs  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_ins + 1,
+                        unsigned int);
+    li->ref_sym   = mem_gc_allocate_n_typed(imcc->interp, li->size, unsigned int);
+    li->ref_kind  = mem_gc_allocate_n_typed(imcc->interp, li->size, unsigned char);
+    seen          = mem_gc_allocate_n_zeroed_typed(imcc->interp,
+                        li->n_symbols + 1, unsigned int);
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int i;
+
+        li->ins_refs[ins->index] = li->n_refs;
+
+        for (i = 0; i < ins->symreg_count; i++)
+            add_ins_ref(imcc, unit, li, ins, ins->symregs[i], seen);
+
+        /* a sub call reads the previous args and writes the results */
+        if (ins->type & ITPCCSUB) {
+            const Instruction *call = instruction_call_args(ins);
+
+            if (call)
+                for (i = 0; i < call->symreg_count; i++)
+                    add_ins_ref(imcc, unit, li, ins, call->symregs[i], seen);
+
+            call = instruction_call_results(ins);
+
+            if (call)
+                for (i = 0; i < call->symreg_count; i++)
+                    add_ins_ref(imcc, unit, li, ins, call->symregs[i], seen);
+        }
+    }
+
+    li->ins_refs[n_ins] = li->n_refs;
+    mem_sys_free(seen);
+}
+
+/*
+
+=item C<static void add_ins_ref(imc_info_t * imcc, const IMC_Unit *unit,
+Live_info *li, const Instruction *ins, const SymReg *r, unsigned int *seen)>
+
+Records the read and write of reglist symbol C<r> (or of the registers in
+key C<r>) by C<ins>. C<seen> keeps symbols from being recorded twice for the
+same instruction.
+
+=cut
+
+*/
+
+static void
+add_ins_ref(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
+        ARGMOD(Live_info *li), ARGIN(const Instruction *ins),
+        ARGIN(const SymReg *r), ARGMOD(unsigned int *seen))
+{
+    ASSERT_ARGS(add_ins_ref)
+    unsigned int kind = 0;
+    unsigned int k;
+
+    if (r->set == 'K') {
+        const SymReg *key;
+        for (key = r->nextkey; key; key = key->nextkey)
+            if (key->reg)
+                add_ins_ref(imcc, unit, li, ins, key->reg, seen);
+        return;
+    }
+
+    if (!REG_NEEDS_ALLOC(r)
+    ||   r->color < 0
+    ||  (unsigned int)r->color >= li->n_symbols
+    ||   unit->reglist[r->color] != r)
+        return;
+
+    k = (unsigned int)r->color;
+
+    if (seen[k] == ins->index + 1)
+        return;
+
+    seen[k] = ins->index + 1;
+
+    if (instruction_reads(ins, r))
+        kind |= REF_READ;
+
+    if (instruction_writes(ins, r))
+        kind |= REF_WRITE;
+
+    if (!kind)
+        return;
+
+    if (li->n_refs == li->size) {
+        li->size    *= 2;
+        li->ref_sym  = mem_gc_realloc_n_typed(imcc->interp, li->ref_sym,
+                            li->size, unsigned int);
+        li->ref_kind = mem_gc_realloc_n_typed(imcc->interp, li->ref_kind,
+                            li->size, unsigned char);
+    }
+
+    li->ref_sym[li->n_refs]  = k;
+    li->ref_kind[li->n_refs] = (unsigned char)kind;
+    li->n_refs++;
+}
+
+/*
+
+=item C<static void live_transfer(const Live_info *li, const Instruction *ins,
+Set *live)>
+
+Turns the set of symbols live after C<ins> into the set live before it.
+
+=cut
+
+*/
+
+static void
+live_transfer(ARGIN(const Live_info *li), ARGIN(const Instruction *ins),
+        ARGMOD(Set *live))
+{
+    ASSERT_ARGS(live_transfer)
+    unsigned int i;
+
+    for (i = li->ins_refs[ins->index]; i < li->ins_refs[ins->index + 1]; i++)
+        if (li->ref_kind[i] & REF_WRITE)
+            set_remove(live, li->ref_sym[i]);
+
+    for (i = li->ins_refs[ins->index]; i < li->ins_refs[ins->index + 1]; i++)
+        if (li->ref_kind[i] & REF_READ)
+            set_add(live, li->ref_sym[i]);
+}
+
+/*
+
+=item C<static Set * live_out(imc_info_t * imcc, const Live_info *li, const
+Basic_block *bb)>
+
+Returns a new set of the symbols live at the end of C<bb>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Set *
+live_out(ARGMOD(imc_info_t * imcc), ARGIN(const Live_info *li),
+        ARGIN(const Basic_block *bb))
+{
+    ASSERT_ARGS(live_out)
+    Set * const live = set_make(imcc, li->n_symbols);
+    const Edge *e;
+
+    for (e = bb->succ_list; e; e = e->succ_next)
+        set_union_inplace(live, li->live_in[e->to->index]);
+
+    return live;
+}
+
+/*
+
+=item C<static void compute_liveness(imc_info_t * imcc, const IMC_Unit *unit,
+Live_info *li)>
+
+Computes the symbols live on entry to each basic block, iterating backwards
+over the CFG until nothing changes.
+
+=cut
+
+*/
+
+static void
+compute_liveness(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
+        ARGMOD(Live_info *li))
+{
+    ASSERT_ARGS(compute_liveness)
+    unsigned int i;
+    int          changed;
+
+    li->live_in = mem_gc_allocate_n_typed(imcc->interp,
+                        unit->n_basic_blocks + 1, Set *);
+
+    for (i = 0; i < unit->n_basic_blocks; i++)
+        li->live_in[i] = set_make(imcc, li->n_symbols);
+
+    do {
+        changed = 0;
+
+        for (i = unit->n_basic_blocks; i-- > 0;) {
+            const Basic_block * const bb   = unit->bb_list[i];
+            Set               * const live = live_out(imcc, li, bb);
+            const Instruction        *ins;
+
+            for (ins = bb->end; ins; ins = ins->prev) {
+                live_transfer(li, ins, live);
+                if (ins == bb->start)
+                    break;
+            }
+
+            if (set_equal(live, li->live_in[i]))
+                set_free(live);
+            else {
+                set_free(li->live_in[i]);
+                li->live_in[i] = live;
+                changed        = 1;
+            }
+        }
+    } while (changed);
+}
+
+/*
+
+=item C<static int find_pinned(imc_info_t * imcc, const IMC_Unit *unit, const
+Live_info *li, Set *pinned)>
+
+Collects the symbols which need a register of their own in C<pinned>.
+Besides lexicals these are all symbols used in blocks
+reachable from a block which can be entered without a CFG edge, so that
+code run from there can neither clobber nor see other symbols.
+
+Returns 0 if such a block can't be found.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+find_pinned(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(const Live_info *li), ARGMOD(Set *pinned))
+{
+    ASSERT_ARGS(find_pinned)
+    const unsigned int  n_blocks = unit->n_basic_blocks;
+    Set         * const region   = set_make(imcc, n_blocks);
+    unsigned int * const todo    = mem_gc_allocate_n_typed(imcc->interp,
+                                        n_blocks + 1, unsigned int);
+    const Instruction  *ins;
+    unsigned int        i, n_todo = 0;
+
+    for (i = 0; i < li->n_symbols; i++)
+        if (unit->reglist[i]->usage & U_LEXICAL)
+            set_add(pinned, i);
+
+    for (i = 1; i < n_blocks; i++)
+        if (!unit->bb_list[i]->pred_list)
+            set_add(region, i);
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int a;
+
+        if (!ins->op)
+            continue;
+
+        /* the return point of a local_branch is entered by local_return */
+        if (STREQ(ins->opname, "local_branch") && ins->next)
+            set_add(region, ins->next->bbindex);
+
+        /* label operands of ops which don't jump there, like push_eh */
+        if (!(ins->type & ITBRANCH) || (ins->op->jump & PARROT_JUMP_RELATIVE))
+            continue;
+
+        for (a = 0; a < ins->opsize - 1 && a < ins->symreg_count; a++) {
+            if (ins->type & (1 << a)) {
+                const SymReg * const label = find_sym(imcc, ins->symregs[a]->name);
+
+                if (!label || !(label->type & VTADDRESS) || !label->first_ins) {
+                    set_free(region);
+                    mem_sys_free(todo);
+                    return 0;
+                }
+
+                set_add(region, label->first_ins->bbindex);
+            }
+        }
+    }
+
+    for (i = 0; i < n_blocks; i++) {
+        if (set_contains(region, i)) {
+            set_union_inplace(pinned, li->live_in[i]);
+            todo[n_todo++] = i;
+        }
+    }
+
+    while (n_todo) {
+        const Basic_block * const bb = unit->bb_list[todo[--n_todo]];
+        const Edge               *e;
+
+        for (ins = bb->start; ins; ins = ins->next) {
+            unsigned int r;
+
+            for (r = li->ins_refs[ins->index]; r < li->ins_refs[ins->index + 1]; r++)
+                set_add(pinned, li->ref_sym[r]);
+
+            if (ins == bb->end)
+                break;
+        }
+
+        for (e = bb->succ_list; e; e = e->succ_next) {
+            if (!set_contains(region, e->to->index)) {
+                set_add(region, e->to->index);
+                todo[n_todo++] = e->to->index;
+            }
+        }
+    }
+
+    set_free(region);
+    mem_sys_free(todo);
+
+    return 1;
+}
+
+/*
+
+=item C<static void color_reg_set(imc_info_t * imcc, IMC_Unit *unit, const
+Live_info *li, const Set *pinned, int j, int reg_set)>
+
+Assigns the registers of one register kind: pinned symbols get the lowest
+registers one each, then each other symbol in order of first use gets the
+lowest register none of the symbols it interferes with has.
+
+=cut
+
+*/
+
+static void
+color_reg_set(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit),
+        ARGIN(const Live_info *li), ARGIN(const Set *pinned), int j, int reg_set)
+{
+    ASSERT_ARGS(color_reg_set)
+    const unsigned int n = li->n_symbols;
+    unsigned int  *members, *local;
+    unsigned char *graph, *taken;
+    unsigned int   i, n_set = 0;
+    int            next = 0, max_color = -1;
+
+    local   = mem_gc_allocate_n_typed(imcc->interp, n + 1, unsigned int);
+    members = mem_gc_allocate_n_typed(imcc->interp, n + 1, unsigned int);
+
+    for (i = 0; i < n; i++) {
+        local[i] = n;
+        if (unit->reglist[i]->set == reg_set) {
+            local[i]         = n_set;
+            members[n_set++] = i;
+        }
+    }
+
+    graph = mem_gc_allocate_n_zeroed_typed(imcc->interp,
+                (size_t)n_set * n_set / 8 + 1, unsigned char);
+
+#define GRAPH_BIT(a, b)  ((size_t)(a) * n_set + (b))
+#define INTERFERES(a, b) (graph[GRAPH_BIT((a), (b)) >> 3] &  (1 << (GRAPH_BIT((a), (b)) & 7)))
+#define INTERFERE(a, b)  (graph[GRAPH_BIT((a), (b)) >> 3] |= (1 << (GRAPH_BIT((a), (b)) & 7)))
+
+    /* a symbol written by an instruction interferes with everything live
+     * after it, and with the other operands of that instruction */
+    for (i = 0; n_set && i < unit->n_basic_blocks; i++) {
+        const Basic_block * const bb   = unit->bb_list[i];
+        Set               * const live = live_out(imcc, li, bb);
+        const Instruction        *ins;
+
+        for (ins = bb->end; ins; ins = ins->prev) {
+            unsigned int d;
+
+            for (d = li->ins_refs[ins->index]; d < li->ins_refs[ins->index + 1]; d++) {
+                const unsigned int w = li->ref_sym[d];
+                unsigned int o;
+
+                if (!(li->ref_kind[d] & REF_WRITE) || local[w] == n
+                ||   set_contains(pinned, w))
+                    continue;
+
+                for (o = 0; o < n_set; o++) {
+                    if (members[o] != w && set_contains(live, members[o])) {
+                        INTERFERE(local[w], o);
+                        INTERFERE(o, local[w]);
+                    }
+                }
+
+                for (o = li->ins_refs[ins->index]; o < li->ins_refs[ins->index + 1]; o++) {
+                    const unsigned int u = li->ref_sym[o];
+                    if (u != w && local[u] != n) {
+                        INTERFERE(local[w], local[u]);
+                        INTERFERE(local[u], local[w]);
+                    }
+                }
+            }
+
+            live_transfer(li, ins, live);
+
+            if (ins == bb->start)
+                break;
+        }
+
+        set_free(live);
+    }
+
+    for (i = 0; i < n_set; i++) {
+        SymReg * const r = unit->reglist[members[i]];
+        if (set_contains(pinned, members[i]))
+            r->color = next++;
+    }
+
+    max_color = next - 1;
+    taken     = mem_gc_allocate_n_typed(imcc->interp, n_set + 1, unsigned char);
+
+    for (i = 0; i < n_set; i++) {
+        SymReg * const r = unit->reglist[members[i]];
+        unsigned int   o, c;
+
+        if (r->color != -1)
+            continue;
+
+        memset(taken, 0, n_set + 1);
+
+        for (o = 0; o < n_set; o++) {
+            const INTVAL color = unit->reglist[members[o]]->color;
+            if (color >= next && INTERFERES(i, o))
+                taken[color - next] = 1;
+        }
+
+        for (c = 0; taken[c]; c++)
+            ;
+
+        r->color = next + c;
+
+        if (r->color > max_color)
+            max_color = r->color;
+
+        IMCC_debug(imcc, DEBUG_IMC, "liveness: sym %c '%s' color %d\n",
+                reg_set, r->name, r->color);
+    }
+
+#undef INTERFERES
+#undef INTERFERE
+#undef GRAPH_BIT
+
+    unit->first_avail[j] = max_color + 1;
+
+    mem_sys_free(taken);
+    mem_sys_free(graph);
+    mem_sys_free(members);
+    mem_sys_free(local);
+}
+
+/*
+
 =item C<static void allocate_lexicals(imc_info_t * imcc, IMC_Unit *unit)>
 
 Allocate registers for lexical variables. These must have unique registers
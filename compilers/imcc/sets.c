@@ -206,6 +206,26 @@ set_add(ARGMOD(Set *s), unsigned int element)
 }
 
 
+/*
+
+=item C<void set_remove(Set *s, unsigned int element)>
+
+Removes from set C<s> the element C<element>.
+
+=cut
+
+*/
+
+void
+set_remove(ARGMOD(Set *s), unsigned int element)
+{
+    ASSERT_ARGS(set_remove)
+
+    if (element <= s->length)
+        s->bmp[BYTE_IN_SET(element)] &= ~BIT_IN_BYTE(element);
+}
+
+
 /*
 
 =item C<unsigned int set_first_zero(const Set *s)>
@@ -361,6 +381,30 @@ set_intersec_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
 
 /*
 
+=item C<void set_union_inplace(Set *s1, const Set *s2)>
+
+Performs a set union in place -- the first Set argument changes to contain
+the result.
+
+=cut
+
+*/
+
+void
+set_union_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
+{
+    ASSERT_ARGS(set_union_inplace)
+    unsigned int i;
+
+    PARROT_ASSERT(s1->length == s2->length);
+
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
+        s1->bmp[i] |= s2->bmp[i];
+    }
+}
+
+/*
+
 =back
 
 =cut
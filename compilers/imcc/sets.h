@@ -75,6 +75,10 @@ Set* set_make_full(ARGMOD(imc_info_t * imcc), unsigned int length)
         __attribute__nonnull__(1)
         FUNC_MODIFIES(* imcc);
 
+void set_remove(ARGMOD(Set *s), unsigned int element)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*s);
+
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 Set * set_union(
@@ -86,6 +90,11 @@ Set * set_union(
         __attribute__nonnull__(3)
         FUNC_MODIFIES(* imcc);
 
+void set_union_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*s1);
+
 #define ASSERT_ARGS_set_add __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_set_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -113,10 +122,15 @@ Set * set_union(
        PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_set_make_full __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc))
+#define ASSERT_ARGS_set_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_set_union __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(s1) \
     , PARROT_ASSERT_ARG(s2))
+#define ASSERT_ARGS_set_union_inplace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s1) \
+    , PARROT_ASSERT_ARG(s2))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: compilers/imcc/sets.c */
 
@@ -103,6 +103,11 @@ static SymReg * mk_pmc_const_2(
         FUNC_MODIFIES(*unit)
         FUNC_MODIFIES(*rhs);
 
+static void queue_ghash_pending(ARGMOD(imc_info_t * imcc), ARGIN(SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc);
+
 static void resize_symhash(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -132,6 +137,9 @@ static void resize_symhash(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh))
     , PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(left) \
     , PARROT_ASSERT_ARG(rhs))
+#define ASSERT_ARGS_queue_ghash_pending __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(r))
 #define ASSERT_ARGS_resize_symhash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(hsh))
@@ -765,7 +773,13 @@ _mk_const(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh),
 {
     ASSERT_ARGS(_mk_const)
     SymReg * const r = _mk_symreg(imcc, hsh, name, t);
-    r->type          = VTCONST;
+
+    /* a used global which was folded through another symbol (e.g. a
+     * namespace's VT_CONSTP) turns into a constant of its own here */
+    if (hsh == &imcc->ghash && r->use_count > 0 && r->color < 0)
+        queue_ghash_pending(imcc, r);
+
+    r->type = VTCONST;
 
     if (t == 'U') {
         /* charset:"string" */
@@ -1387,6 +1401,36 @@ _store_symreg(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh),
 
     if (hsh->entries >= hsh->size)
         resize_symhash(imcc, hsh);
+
+    /* remember new globals, so that constant folding needn't rescan ghash */
+    if (hsh == &imcc->ghash)
+        queue_ghash_pending(imcc, r);
+}
+
+
+/*
+
+=item C<static void queue_ghash_pending(imc_info_t * imcc, SymReg *r)>
+
+Queues a global symbol for the next constant folding.
+
+=cut
+
+*/
+
+static void
+queue_ghash_pending(ARGMOD(imc_info_t * imcc), ARGIN(SymReg *r))
+{
+    ASSERT_ARGS(queue_ghash_pending)
+
+    if (imcc->n_ghash_pending == imcc->ghash_pending_size) {
+        imcc->ghash_pending_size = imcc->ghash_pending_size
+                                 ? imcc->ghash_pending_size * 2 : 16;
+        imcc->ghash_pending      = mem_gc_realloc_n_typed(imcc->interp,
+                imcc->ghash_pending, imcc->ghash_pending_size, SymReg *);
+    }
+
+    imcc->ghash_pending[imcc->n_ghash_pending++] = r;
 }
 
 
@@ -1614,6 +1658,11 @@ clear_globals(ARGMOD(imc_info_t * imcc))
 
     if (hsh->data)
         clear_sym_hash(hsh);
+
+    mem_sys_free(imcc->ghash_pending);
+    imcc->ghash_pending      = NULL;
+    imcc->n_ghash_pending    = 0;
+    imcc->ghash_pending_size = 0;
 }
 
 
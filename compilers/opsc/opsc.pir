@@ -11,8 +11,10 @@
 .include 'compilers/opsc/gen/Ops/Emitter.pir'
 .include 'compilers/opsc/gen/Ops/Trans.pir'
 .include 'compilers/opsc/gen/Ops/Trans/C.pir'
+.include 'compilers/opsc/gen/Ops/Trans/CGoto.pir'
 
 .include 'compilers/opsc/gen/Ops/Op.pir'
+.include 'compilers/opsc/gen/Ops/SuperOp.pir'
 .include 'compilers/opsc/gen/Ops/OpLib.pir'
 .include 'compilers/opsc/gen/Ops/File.pir'
 
@@ -92,6 +92,8 @@ method op ($/, $key?) {
                 :name('goto_offset'),
                 self.opsize,
             );
+            # Dropped when the op is fused with the op after it.
+            $goto_next<auto_next> := 1;
 
             $OP[0].push($goto_next);
         }
@@ -239,6 +241,7 @@ method op_body($/) {
 }
 
 method op_macro:sym<expr offset>($/) {
+    $OP<uses_pc> := 1;
     make PAST::Op.new(
         :pasttype<macro>,
         :name<expr_offset>,
@@ -247,6 +250,7 @@ method op_macro:sym<expr offset>($/) {
 }
 
 method op_macro:sym<goto offset>($/) {
+    $OP<uses_pc> := 1;
     $OP.add_jump('PARROT_JUMP_RELATIVE');
 
     my $past := PAST::Op.new(
@@ -266,6 +270,7 @@ method op_macro:sym<goto offset>($/) {
 }
 
 method op_macro:sym<expr address>($/) {
+    $OP<uses_pc> := 1;
     make PAST::Op.new(
         :pasttype<macro>,
         :name<expr_address>,
@@ -274,6 +279,7 @@ method op_macro:sym<expr address>($/) {
 }
 
 method op_macro:sym<goto address>($/) {
+    $OP<uses_pc> := 1;
     my $past := PAST::Op.new(
         :pasttype<macro>,
         :name<goto_address>,
@@ -291,6 +297,7 @@ method op_macro:sym<goto address>($/) {
 }
 
 method op_macro:sym<expr next>($/) {
+    $OP<uses_pc> := 1;
     make PAST::Op.new(
         :pasttype<macro>,
         :name<expr_offset>,
@@ -299,6 +306,7 @@ method op_macro:sym<expr next>($/) {
 }
 
 method op_macro:sym<goto next>($/) {
+    $OP<uses_pc> := 1;
     $OP.add_jump('PARROT_JUMP_RELATIVE');
 
     my $past := PAST::Op.new(
@@ -319,6 +327,7 @@ method op_macro:sym<goto next>($/) {
 
 
 method op_macro:sym<restart next> ($/) {
+    $OP<uses_pc> := 1;
     #say('# op_macro');
     # restart NEXT()      -> restart_offset(opsize()); goto_address(0)
     my $past := PAST::Stmts.new(
@@ -466,6 +475,9 @@ method term:sym<concatenate_strings> ($/) {
 }
 
 method term:sym<identifier> ($/) {
+    # Ops looking at their own address can't be fused into superinstructions.
+    $OP<uses_pc> := 1 if ~$/ eq 'CUR_OPCODE' || ~$/ eq 'cur_opcode';
+
     # XXX Type vs Variable
     make PAST::Var.new(
         :name(~$/),
@@ -638,10 +650,13 @@ method prefix:sym<( )> ($/) {
 
 # Helper method for generating PAST::Val with opsize
 method opsize () {
-    make PAST::Val.new(
+    my $past := PAST::Val.new(
         :value($OP.size),
         :returns('int'),
     );
+    $past<opsize> := 1;
+
+    make $past;
 }
 
 method make_write_barrier () {
@@ -187,6 +187,68 @@ method emit_c_source_file($fh) {
     self._emit_coda($fh);
 }
 
+=begin
+
+=item C<print_c_runcore_files()>
+
+Writes the header and source file of a runcore which dispatches ops on its
+own rather than through an op library, e.g. L<Ops::Trans::CGoto>.
+
+=end
+
+method print_c_runcore_files() {
+    my $fh := pir::new__Ps('FileHandle');
+    $fh.open(self<func_header>, 'w')
+        || die("Can't open "~ self<func_header>);
+    self.emit_c_runcore_header($fh);
+    $fh.close();
+
+    $fh := pir::new__Ps('FileHandle');
+    $fh.open(self<source>, 'w')
+        || die("Can't open "~ self<source>);
+    self.emit_c_runcore_source($fh);
+    $fh.close();
+    return self<source>;
+}
+
+method emit_c_runcore_header($fh) {
+
+    self._emit_guard_prefix($fh, self<func_header>);
+
+    self._emit_preamble($fh);
+
+    $fh.print(q|
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+|);
+
+    self.trans.emit_c_op_funcs_header_part($fh);
+
+    self._emit_guard_suffix($fh, self<func_header>);
+
+    self._emit_coda($fh);
+}
+
+method emit_c_runcore_source($fh) {
+
+    self._emit_preamble($fh);
+
+    $fh.print(qq|
+#include "{self<include>}"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+{self.trans.defines(self)}
+|);
+
+    $fh.print(self.ops_file.preamble);
+
+    self.trans.emit_source_part(self, $fh);
+
+    self._emit_coda($fh);
+}
+
 method _emit_c_op_enum_header_part($fh) {
     my $sb := pir::new__Ps('StringBuilder');
     my $last_op_code := +self.ops_file.ops - 1;
@@ -202,6 +202,8 @@ method new(*@files, :$oplib, :$core!, :$nolines, :$quiet? = 0) {
 
     for @files { self.read_ops( $_, $nolines ) }
 
+    self.add_superops() if $core;
+
     self._calculate_op_codes();
 
     self;
@@ -270,6 +272,62 @@ method compile_ops($str, :$experimental? = 0) {
     $past;
 }
 
+=begin
+
+=item C<add_superops()>
+
+Appends a superinstruction (see C<Ops::SuperOp>) for each op sequence listed
+in the oplib's F<ops.super> file.  Sequences naming unknown ops, or in which an
+op other than the last one may branch, are skipped.
+
+=end
+
+method add_superops() {
+    my %ops;
+    for self<ops> -> $op {
+        %ops{$op.full_name} := $op;
+    }
+
+    my %seen;
+    for self<oplib>.op_super_list -> @names {
+        my $name  := join('__', |@names);
+        my $args  := 0;
+        my $error := '';
+        my @ops;
+
+        for @names -> $op_name {
+            my $op := %ops{$op_name};
+
+            if !$op {
+                $error := $error || "unknown op $op_name";
+            }
+            else {
+                if +@ops && !@ops[+@ops - 1].can_fuse {
+                    $error := $error || @ops[+@ops - 1].full_name ~ " can't be fused";
+                }
+                $args := $args + $op.size - 1;
+                @ops.push($op);
+            }
+        }
+
+        if $args >= 15 {
+            $error := $error || "too many arguments";
+        }
+
+        if %seen{$name} {
+            $error := $error || "duplicate";
+        }
+        %seen{$name} := 1;
+
+        if $error {
+            self<quiet> || say("# Skipping superinstruction " ~ $name ~ ": " ~ $error);
+        }
+        else {
+            self<ops>.push(Ops::SuperOp.fuse(@ops));
+        }
+    }
+}
+
 method get_parse_tree($str) {
     my $compiler := pir::compreg__Ps('Ops');
     $compiler.compile($str, :target('parse'));
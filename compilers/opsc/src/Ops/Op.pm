@@ -255,6 +255,21 @@ method get_jump() {
 
 =begin
 
+=item C<can_fuse()>
+
+Returns true if the op can be followed by another op inside a
+superinstruction (see C<Ops::SuperOp>).  That is the case unless the op is
+marked C<:flow>, may jump, or uses its own position or size through one of the
+C<OFFSET>, C<ADDRESS> or C<NEXT> macros.
+
+=end
+
+method can_fuse() {
+    !self<flags><flow> && !self<uses_pc> && !self.jump;
+}
+
+=begin
+
 =item C<source($trans, $op)>
 
 Returns the L<C<body()>> of the op with substitutions made by
@@ -294,6 +309,9 @@ method get_body( $trans ) {
 
 # Recursively process body chunks returning string.
 our multi method to_c(PAST::Val $val, %c) {
+    # Inside a superinstruction NEXT() is the end of the fused op.
+    return %c<opsize> if $val<opsize> && %c<opsize>;
+
     $val.value;
 }
 
@@ -315,7 +333,7 @@ our multi method to_c(PAST::Var $var, %c) {
     }
     elsif $var.scope eq 'register' {
         my $n := +$var.name;
-        %c<trans>.access_arg( self.arg_type($n - 1), $n);
+        %c<trans>.access_arg( self.arg_type($n - 1), $n + (%c<arg_offset> // 0));
     }
     else {
         # Just ordinary variable
@@ -589,16 +607,19 @@ our multi method to_c(PAST::Block $chunk, %c) {
     @res.push("\{\n");
 
     for @($chunk) {
-        if $need_space && !need_space($_) {
-            # Hack. If this $chunk doesn't need semicolon it will put newline before
+        # Fall through into the next op of a superinstruction.
+        unless %c<fused> && $_ ~~ PAST::Op && $_<auto_next> {
+            if $need_space && !need_space($_) {
+                # Hack. If this $chunk doesn't need semicolon it will put newline before
+                @res.push("\n");
+                $need_space := 0;
+            }
+
+            @res.push(indent($_, %c));
+            @res.push(self.to_c($_, %c));
+            @res.push(need_semicolon($_) ?? ";" !! "\n");
             @res.push("\n");
-            $need_space := 0;
         }
-
-        @res.push(indent($_, %c));
-        @res.push(self.to_c($_, %c));
-        @res.push(need_semicolon($_) ?? ";" !! "\n");
-        @res.push("\n");
     }
 
     %c<level>--;
@@ -15,8 +15,8 @@ C<Ops::OpLib> - library of Parrot Operations.
 
 =begin DESCRIPTION
 
-Responsible for loading F<src/ops/ops.skip> files, parse F<.ops> files, sort
-them, etc.
+Responsible for loading F<src/ops/ops.skip> and F<src/ops/ops.super> files,
+parse F<.ops> files, sort them, etc.
 
 Heavily inspired by Perl5 Parrot::Ops2pm.
 
@@ -26,6 +26,7 @@ Heavily inspired by Perl5 Parrot::Ops2pm.
 
     my $oplib := Ops::OpLib.new(
         :skip_file('../../src/ops/ops.skip'),
+        :super_file('../../src/ops/ops.super'),
     ));
 
 =end SYNOPSIS
@@ -48,6 +49,19 @@ Reference to a 'seen-hash' of skipped opcodes.
 As F<src/ops/ops.skip> states, these are "... opcodes that should not ever to be
 generated or implemented because they are useless and/or silly."
 
+=item * C<@.op_super_list>
+
+List of the op sequences to generate superinstructions for, hottest first.
+Each sequence is a list of full op names.
+
+  'op_super_list' => [
+    [ 'set_i_ic', 'lt_i_i_ic' ],
+    # ...
+  ],
+
+F<src/ops/ops.super> is generated from a profile by
+F<tools/dev/pprof2superops.pl>.
+
 =back
 
 =end ATTRIBUTES
@@ -64,12 +78,14 @@ Build OpLib.
 
 =end METHODS
 
-method new(:$skip_file, :$quiet? = 0) {
+method new(:$skip_file, :$super_file, :$quiet? = 0) {
     self<skip_file>  := $skip_file // './src/ops/ops.skip';
+    self<super_file> := $super_file // './src/ops/ops.super';
     self<quiet>      := $quiet;
 
     # Initialize self.
     self<op_skip_table> := hash();
+    self<op_super_list> := list();
     self<ops_past>      := list();
     self<regen_ops_num> := 0;
 
@@ -82,12 +98,13 @@ method new(:$skip_file, :$quiet? = 0) {
 
 =item C<load_op_map_files>
 
-Load ops.skip.
+Load ops.skip and ops.super.
 
 =end METHODS
 
 method load_op_map_files() {
     self._load_skip_file;
+    self._load_super_file;
 }
 
 method _load_skip_file() {
@@ -111,6 +128,33 @@ method _load_skip_file() {
     }
 }
 
+method _load_super_file() {
+    # An empty name disables superinstructions.
+    return 0 unless self<super_file>;
+
+    my $buf     := slurp(self<super_file>);
+    grammar SUPER {
+        token TOP { [ <sequence> | <ws> ]* }
+
+        # count of the sequence in the profile, then the ops in it
+        token sequence { $<count>=(\d+) [ <[\ \t]>+ $<op>=(\w+) ]+ }
+        token ws {
+            [
+            | \s+
+            | '#' \N*
+            ]+
+        }
+    }
+
+    my $lines := SUPER.parse($buf);
+
+    for $lines<sequence> {
+        my @ops;
+        @ops.push(~$_) for $_<op>;
+        self<op_super_list>.push(@ops);
+    }
+}
+
 
 =begin ACCESSORS
 
@@ -124,6 +168,14 @@ Various methods for accessing internals.
 
 method op_skip_table()  { self<op_skip_table>; }
 
+=begin ACCESSORS
+
+=item * C<op_super_list>
+
+=end ACCESSORS
+
+method op_super_list()  { self<op_super_list>; }
+
 # Local Variables:
 #   mode: perl6
 #   fill-column: 100
@@ -0,0 +1,149 @@
+#! nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+=begin
+
+=head1 NAME
+
+Ops::SuperOp - Superinstruction fused from a sequence of ops
+
+=head1 SYNOPSIS
+
+  my $super := Ops::SuperOp.fuse(list($set_i_ic, $lt_i_i_ic));
+
+=head1 DESCRIPTION
+
+C<Ops::SuperOp> is an op whose body runs the bodies of a sequence of ops one
+after another, saving a dispatch for each op but the first.  Its arguments are
+the arguments of all the fused ops, in order, and its full name is the full
+names of the fused ops joined by C<__>, e.g. C<set_i_ic__lt_i_i_ic>.  IMCC
+replaces sequences of ops which have a superinstruction by that
+superinstruction when optimizing.
+
+Every op but the last has to satisfy C<can_fuse()> (see C<Ops::Op>), so
+control only ever leaves the superinstruction from its last op.  Jumps of the
+last op are relative to the start of the superinstruction, which is where the
+label offsets of the fused instruction are computed from.
+
+=head2 Methods
+
+=over 4
+
+=end
+
+class Ops::SuperOp is Ops::Op;
+
+=begin
+
+=item C<fuse(@ops)>
+
+Returns a new superinstruction for the sequence C<@ops>.
+
+=end
+
+method fuse(@ops) {
+    my @args;
+    my @arg_types;
+    my @norm_args;
+    my @names;
+
+    for @ops -> $op {
+        @args.push($_)      for pir::does__IPs($op.args, 'array') ?? $op.args !! list();
+        @arg_types.push($_) for $op.arg_types;
+        @norm_args.push($_) for $op<normalized_args>;
+        @names.push($op.full_name);
+    }
+
+    my $self := self.new(
+        :name(join('__', |@names)),
+    );
+
+    $self<ops>             := @ops;
+    $self<type>            := 'inline';
+    $self<flags>           := @ops[+@ops - 1]<flags>;
+    $self<jump>            := @ops[+@ops - 1].jump;
+    $self<args>            := @args;
+    $self<arg_types>       := @arg_types;
+    $self<normalized_args> := @norm_args;
+
+    $self;
+}
+
+=begin
+
+=item C<ops()>
+
+Returns the fused ops.
+
+=item C<full_name()>
+
+Returns the name of the superinstruction, which already contains the names
+and argument types of the fused ops.
+
+=end
+
+method ops() { self<ops> }
+
+method full_name() { self.name }
+
+=begin
+
+=item C<get_body($trans)>
+
+Returns the bodies of the fused ops, each in a block of its own.  Register
+references are shifted past the arguments of the preceding ops, the automatic
+jump to the next op is dropped from all ops but the last and C<NEXT()> refers
+to the end of the superinstruction.
+
+=end
+
+method get_body( $trans ) {
+    my @ops    := self<ops>;
+    my $last   := +@ops - 1;
+    my $offset := 0;
+    my $i      := 0;
+    my @res    := list("\{\n");
+
+    for @ops -> $op {
+        my %context := hash(
+            trans      => $trans,
+            level      => 0,
+            arg_offset => $offset,
+            opsize     => self.size,
+            fused      => $i < $last,
+        );
+
+        @res.push('/* ' ~ $op.full_name ~ " */\n");
+        @res.push($op.join_children($op, %context));
+        @res.push("\n");
+
+        $offset := $offset + $op.size - 1;
+        $i++;
+    }
+
+    @res.push("\}\n");
+    @res.join('');
+}
+
+=begin
+
+=back
+
+=head1 SEE ALSO
+
+=over 4
+
+=item C<Ops::Op>
+
+=item F<tools/dev/pprof2superops.pl>
+
+=back
+
+=end
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: ft=perl6 expandtab shiftwidth=4:
@@ -13,7 +13,22 @@ method new() {
 
     self<num_entries> := 0;
 
-    self<arg_maps> := hash(
+    self<arg_maps> := self.default_arg_maps;
+
+    self;
+}
+
+=begin
+
+=item C<default_arg_maps()>
+
+Returns the C expressions used to access each kind of op argument. C<NUM> is
+replaced by the argument number.
+
+=end
+
+method default_arg_maps() {
+    hash(
         :op("cur_opcode[NUM]"),
 
         :i("IREG(NUM)"),
@@ -30,8 +45,6 @@ method new() {
         :kc("PCONST(NUM)"),
         :kic("ICONST(NUM)")
     );
-
-    self;
 }
 
 method suffix() { '' };
@@ -0,0 +1,211 @@
+#! nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+class Ops::Trans::CGoto is Ops::Trans::C;
+
+=begin
+
+Direct-threaded ("computed goto") runcore transformation.
+
+Instead of one C function per op, every op body becomes a label inside a
+single dispatch function. Bytecode is translated lazily into a thread of
+label addresses (see C<Parrot_runcore_cgoto_thread> in
+F<src/runcore/cores.c>), so dispatching the next op is a single indirect jump.
+This relies on the GNU C "labels as values" extension; the generated code is
+only compiled when C<PARROT_HAS_COMPUTED_GOTO> is defined.
+
+The context's pc is only stored by ops which call out of the op body; only
+code outside the runloop (exceptions, backtraces, invoked subs) looks at it.
+
+=end
+
+method new() {
+    # Storage for label address table entries.
+    self<op_labels> := list();
+    # Storage for labelled op bodies.
+    self<op_bodies> := list();
+
+    self<num_entries> := 0;
+
+    self<arg_maps> := self.default_arg_maps;
+
+    self;
+}
+
+method suffix() { '_cg' };
+
+method core_type() { 'PARROT_CGOTO_CORE' }
+
+=begin
+
+=item C<runops_func($emitter)>
+
+Returns the name of the generated dispatch function.
+
+=end
+
+method runops_func($emitter) {
+    self.prefix ~ 'runops_' ~ $emitter.base ~ '_ops' ~ self.suffix;
+}
+
+method op_label($op) { 'cg_' ~ $op.full_name }
+
+method prepare_ops($emitter, $ops_file) {
+
+    my $index := 0;
+    my @op_labels;
+    my @op_bodies;
+
+    for $ops_file.ops -> $op {
+        my $label := self.op_label($op);
+        my $src   := $op.source( self );
+
+        if self.calls_out($src) {
+            $src := 'Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);'
+                  ~ "\n    " ~ $src;
+        }
+
+        @op_labels.push(sprintf( "        %-50s /* %6ld */\n", "&&$label,", $index ));
+        @op_bodies.push(join('', '  ', $label, ":\n    ", $src, "\n\n"));
+        $index++;
+    }
+
+    self<runops_func> := self.runops_func($emitter);
+    self<op_labels>   := @op_labels;
+    self<op_bodies>   := @op_bodies;
+    self<num_entries> := +@op_bodies + 1;
+}
+
+=begin
+
+=item C<calls_out($src)>
+
+Returns true if the C source of an op body calls anything but the register
+and constant accessors and a few other macros which never leave the op.
+
+=end
+
+method calls_out($src) {
+    my $calls := subst($src,
+        / << [ IREG | NREG | PREG | SREG | ICONST | NCONST | SCONST | PCONST
+             | CURRENT_CONTEXT | PARROT_GC_WRITE_BARRIER | PMC_IS_NULL | STRING_IS_NULL
+             | DISPATCH_OP | abs | fabs | if | while | for | switch | return | sizeof ]
+          \s* '(' /,
+        '(', :global);
+
+    ?($calls ~~ / \w \s* '(' /);
+}
+
+method emit_c_op_funcs_header_part($fh) {
+    $fh.print(q|
+#ifdef PARROT_HAS_COMPUTED_GOTO
+| ~ 'opcode_t * ' ~ self<runops_func> ~ q|(PARROT_INTERP, ARGIN(opcode_t *cur_opcode))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+|);
+}
+
+# Any jump to an absolute address may leave the current code segment, so it
+# goes through the slow path that reloads the thread.
+method goto_address($addr) {
+    'do { cur_opcode = (opcode_t *)(' ~ $addr ~ '); goto cg_dispatch_address; } while (0)';
+}
+
+# Relative jumps always stay in the current segment.
+method goto_offset($offset) {
+    'do { cur_opcode += ' ~ $offset ~ '; DISPATCH_OP(); } while (0)';
+}
+
+method defines($emitter) {
+    return q|
+/* defines - Ops::Trans::CGoto */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+/* jump to the op at cur_opcode through the current segment's thread */
+#define DISPATCH_OP() goto *cg_thread[cur_opcode - cg_code_start]
+|;
+}
+
+method emit_source_part($emitter, $fh) {
+    my $runops := self.runops_func($emitter);
+
+    $fh.print(q|
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+/*
+** Op Dispatch Function:
+*/
+
+opcode_t *
+| ~ $runops ~ q|(PARROT_INTERP, ARGIN(opcode_t *cur_opcode))
+{
+    static void * const cg_op_labels[| ~ self<num_entries> ~ q|] = {
+|);
+
+    for self<op_labels> {
+        $fh.print($_);
+    }
+
+    $fh.print(q|        NULL
+    };
+
+    PackFile_ByteCode *cg_code       = interp->code;
+    opcode_t          *cg_code_start = cg_code->base.data;
+    void             **cg_thread     = Parrot_runcore_cgoto_thread(interp, cg_code,
+                                            &&cg_translate);
+
+    DISPATCH_OP();
+
+    /* An absolute jump, possibly into another code segment or out of the
+     * runloop altogether. */
+  cg_dispatch_address:
+    if (!cur_opcode)
+        return cur_opcode;
+
+    if (interp->code != cg_code) {
+        cg_code       = interp->code;
+        cg_code_start = cg_code->base.data;
+        cg_thread     = Parrot_runcore_cgoto_thread(interp, cg_code, &&cg_translate);
+    }
+
+    DISPATCH_OP();
+
+    /* First execution of this op: patch its label into the thread. */
+  cg_translate:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    cg_thread[cur_opcode - cg_code_start] = Parrot_runcore_cgoto_translate(interp,
+            cg_code, cur_opcode, cg_op_labels, &&cg_dynop);
+    DISPATCH_OP();
+
+    /* Ops from dynamic op libraries are called through the function table. */
+  cg_dynop:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    cur_opcode = (cg_code->op_func_table[*cur_opcode])(cur_opcode, interp);
+    goto cg_dispatch_address;
+
+|);
+
+    for self<op_bodies> {
+        $fh.print($_);
+    }
+
+    $fh.print(q|}
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+|);
+}
+
+method emit_op_lookup($emitter, $fh) { }
+
+# vim: expandtab shiftwidth=4 ft=perl6:
@@ -42,6 +42,7 @@ sub _set_implementations {
     my @impls = qw/
         io.c
         socket.c
+        reactor.c
         file.c
         time.c
         encoding.c
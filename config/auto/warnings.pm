@@ -220,6 +220,9 @@ sub _init {
         '-Wlogical-op' => [ qw(
             compilers/imcc/imcparser.c
         ) ],
+        '-Wstack-usage=500' => [ qw(
+            src/ops/core_ops_cg.c
+        ) ],
     };
 
     # Warning flags docs
@@ -0,0 +1,157 @@
+# Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/hash_keys.pir - Hash insert, lookup and delete by key type
+
+=head1 SYNOPSIS
+
+    % ./parrot examples/benchmarks/hash_keys.pir [count]
+
+=head1 DESCRIPTION
+
+Fills a C<Hash> with C<count> (default 1000000) entries, looks every key up
+twice, probes as many missing keys, and deletes half of the entries.  This is
+done with integer, string and PMC keys, and the time taken by each phase is
+printed.
+
+=cut
+
+.include 'hash_key_type.pasm'
+
+.sub 'main' :main
+    .param pmc argv
+    .local int n
+    n = 1000000
+    $I0 = elements argv
+    if $I0 < 2 goto run
+    $S0 = argv[1]
+    n   = $S0
+  run:
+    .local pmc keys
+    keys = 'make_keys'(n)
+
+    'bench'('int', .Hash_key_type_int, keys, n)
+    'bench'('string', .Hash_key_type_STRING, keys, n)
+    'bench'('PMC', .Hash_key_type_PMC, keys, n)
+.end
+
+# Keys are boxed so every phase pays the same price to fetch them; the hash
+# key type decides whether they are used as integers, strings or PMCs.
+.sub 'make_keys'
+    .param int n
+    .local pmc keys
+    .local int i
+    keys = new ['ResizablePMCArray']
+    keys = n
+    i    = 0
+  loop:
+    $I0 = i * 7919
+    $S0 = $I0
+    $S0 = concat 'key_', $S0
+    $P0 = box $S0
+    keys[i] = $P0
+    inc i
+    if i < n goto loop
+    .return (keys)
+.end
+
+.sub 'bench'
+    .param string name
+    .param int    key_type
+    .param pmc    keys
+    .param int    n
+    .local pmc hash, k
+    .local int i, found
+    .local num start
+
+    hash = new ['Hash']
+    hash = key_type
+
+    start = time
+    i = 0
+  fill:
+    k = keys[i]
+    if key_type == .Hash_key_type_int goto fill_int
+    hash[k] = i
+    goto fill_next
+  fill_int:
+    hash[i] = i
+  fill_next:
+    inc i
+    if i < n goto fill
+    'report'(name, 'insert', start)
+
+    start = time
+    found = 0
+    $I1   = n * 2
+    i     = 0
+  lookup:
+    $I2 = i % n
+    k   = keys[$I2]
+    if key_type == .Hash_key_type_int goto lookup_int
+    $I0 = exists hash[k]
+    goto lookup_next
+  lookup_int:
+    $I0 = exists hash[$I2]
+  lookup_next:
+    found += $I0
+    inc i
+    if i < $I1 goto lookup
+    'report'(name, 'lookup', start)
+
+    start = time
+    i = 0
+  miss:
+    $I2 = i + n
+    if key_type == .Hash_key_type_int goto miss_int
+    $S0 = $I2
+    $I0 = exists hash[$S0]
+    goto miss_next
+  miss_int:
+    $I0 = exists hash[$I2]
+  miss_next:
+    found += $I0
+    inc i
+    if i < n goto miss
+    'report'(name, 'miss', start)
+
+    start = time
+    i = 0
+  remove:
+    k = keys[i]
+    if key_type == .Hash_key_type_int goto remove_int
+    delete hash[k]
+    goto remove_next
+  remove_int:
+    delete hash[i]
+  remove_next:
+    i += 2
+    if i < n goto remove
+    'report'(name, 'delete', start)
+
+    $I0 = n * 2
+    if found == $I0 goto done
+    say 'wrong number of keys found'
+  done:
+.end
+
+.sub 'report'
+    .param string name
+    .param string phase
+    .param num    start
+    $N0 = time
+    $N0 -= start
+    $P0 = new ['ResizablePMCArray']
+    push $P0, name
+    push $P0, phase
+    push $P0, $N0
+    $S0 = sprintf "%-7s %-7s %.3fs\n", $P0
+    print $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
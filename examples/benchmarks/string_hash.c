@@ -0,0 +1,281 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/string_hash.c - Compare string and pointer hash functions
+
+=head1 SYNOPSIS
+
+    % cc -O2 -Iinclude -o string_hash examples/benchmarks/string_hash.c \
+        -Lblib/lib -lparrot
+    % LD_LIBRARY_PATH=blib/lib ./string_hash
+
+=head1 DESCRIPTION
+
+Hashes a few sets of identifier-like keys with both C<Parrot_hash_buffer> and
+the shift-add function it replaced.  For each set it prints the throughput and
+how many keys collide in a power-of-two bucket index, masked the way
+F<src/hash.c> masks it, and how many share the full hash value.  Pointer keys
+get the same treatment with C<Parrot_hash_pointer> against a plain xor with
+the seed.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "parrot/parrot.h"
+
+#define N_KEYS   65536
+#define ROUNDS   64
+#define SEED     0x5bd1e995
+
+typedef size_t (*hash_func)(const unsigned char *buf, size_t len, size_t seed);
+
+/*
+
+=item C<static size_t shift_add_hash(const unsigned char *buf, size_t len,
+size_t hashval)>
+
+The byte-at-a-time hash Parrot used before.
+
+=cut
+
+*/
+
+static size_t
+shift_add_hash(const unsigned char *buf, size_t len, size_t hashval)
+{
+    while (len--) {
+        hashval += hashval << 5;
+        hashval += *buf++;
+    }
+    return hashval;
+}
+
+/*
+
+=item C<static size_t siphash(const unsigned char *buf, size_t len, size_t
+hashval)>
+
+The word-at-a-time SipHash-1-3 hash Parrot uses now.
+
+=cut
+
+*/
+
+static size_t
+siphash(const unsigned char *buf, size_t len, size_t hashval)
+{
+    return Parrot_hash_buffer(buf, len, hashval);
+}
+
+/*
+
+=item C<static int cmp_size_t(const void *a, const void *b)>
+
+C<qsort> comparator for hash values.
+
+=cut
+
+*/
+
+static int
+cmp_size_t(const void *a, const void *b)
+{
+    const size_t x = *(const size_t *)a;
+    const size_t y = *(const size_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/*
+
+=item C<static void report(const char *set, const char *name, size_t *h, size_t
+n, double secs, size_t bytes)>
+
+Prints the throughput and the collision counts of the hash values in C<h>.
+
+=cut
+
+*/
+
+static void
+report(const char *set, const char *name, size_t *h, size_t n,
+        double secs, size_t bytes)
+{
+    size_t  mask = 1;
+    size_t  buckets = 0, full = 0, i;
+    char   *used;
+
+    while (mask < n)
+        mask <<= 1;
+    used = (char *)calloc(mask, 1);
+    mask--;
+
+    for (i = 0; i < n; ++i) {
+        if (used[h[i] & mask])
+            ++buckets;
+        used[h[i] & mask] = 1;
+    }
+
+    qsort(h, n, sizeof (size_t), cmp_size_t);
+    for (i = 1; i < n; ++i)
+        if (h[i] == h[i - 1])
+            ++full;
+
+    printf("%-12s %-10s %9.1f MB/s %8lu bucket %6lu full\n", set, name,
+        secs > 0 ? bytes * (double)ROUNDS / secs / 1e6 : 0.0,
+        (unsigned long)buckets, (unsigned long)full);
+
+    free(used);
+}
+
+/*
+
+=item C<static void bench_strings(const char *set, char **keys, size_t n)>
+
+Runs both string hashes over the C<n> keys.
+
+=cut
+
+*/
+
+static void
+bench_strings(const char *set, char **keys, size_t n)
+{
+    static const char * const names[] = { "shift-add", "siphash13" };
+    static const hash_func    funcs[] = { shift_add_hash, siphash };
+    size_t *h     = (size_t *)malloc(n * sizeof (size_t));
+    size_t  bytes = 0;
+    size_t  i, f;
+    int     r;
+
+    for (i = 0; i < n; ++i)
+        bytes += strlen(keys[i]);
+
+    for (f = 0; f < 2; ++f) {
+        const clock_t   start = clock();
+        volatile size_t sink  = 0;
+        double          secs;
+
+        for (r = 0; r < ROUNDS; ++r)
+            for (i = 0; i < n; ++i)
+                sink ^= funcs[f]((const unsigned char *)keys[i],
+                            strlen(keys[i]), SEED + r);
+        secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        for (i = 0; i < n; ++i)
+            h[i] = funcs[f]((const unsigned char *)keys[i],
+                        strlen(keys[i]), SEED);
+        report(set, names[f], h, n, secs, bytes);
+    }
+
+    free(h);
+}
+
+/*
+
+=item C<static void bench_pointers(void)>
+
+Hashes addresses spaced like PMC headers in an arena.
+
+=cut
+
+*/
+
+static void
+bench_pointers(void)
+{
+    char   *base = (char *)malloc(N_KEYS * 48);
+    size_t *h    = (size_t *)malloc(N_KEYS * sizeof (size_t));
+    size_t  i;
+
+    for (i = 0; i < N_KEYS; ++i)
+        h[i] = (size_t)(base + i * 48) ^ SEED;
+    report("pointers", "xor", h, N_KEYS, 0.0, 0);
+
+    for (i = 0; i < N_KEYS; ++i)
+        h[i] = Parrot_hash_pointer(base + i * 48, SEED);
+    report("pointers", "mul-shift", h, N_KEYS, 0.0, 0);
+
+    free(h);
+    free(base);
+}
+
+/*
+
+=item C<int main(void)>
+
+Builds the key sets and runs the benchmarks.
+
+=cut
+
+*/
+
+int
+main(void)
+{
+    static const char * const words[] = {
+        "get", "set", "attr", "name", "value", "node", "child", "parse",
+        "emit", "type", "list", "hash", "index", "class", "method", "sub"
+    };
+    char  **keys = (char **)malloc(N_KEYS * sizeof (char *));
+    char    buf[64];
+    size_t  i;
+
+    for (i = 0; i < N_KEYS; ++i) {
+        sprintf(buf, "$P%lu", (unsigned long)i);
+        keys[i] = strdup(buf);
+    }
+    bench_strings("registers", keys, N_KEYS);
+
+    for (i = 0; i < N_KEYS; ++i) {
+        free(keys[i]);
+        sprintf(buf, "%s_%s_%s%lu", words[i & 15], words[(i >> 4) & 15],
+                words[(i >> 8) & 15], (unsigned long)(i >> 12));
+        keys[i] = strdup(buf);
+    }
+    bench_strings("identifiers", keys, N_KEYS);
+
+    for (i = 0; i < N_KEYS; ++i) {
+        free(keys[i]);
+        sprintf(buf, "Foo::Bar::Baz::Method%05lu::invoke", (unsigned long)i);
+        keys[i] = strdup(buf);
+    }
+    bench_strings("long", keys, N_KEYS);
+
+    for (i = 0; i < N_KEYS; ++i)
+        free(keys[i]);
+    free(keys);
+
+    bench_pointers();
+
+    return 0;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/hash.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -36,6 +36,7 @@ struct init_args_t {
     Parrot_Int have_pasm_file;
     Parrot_Int turn_gc_off;
     Parrot_Int preprocess_only;
+    const char *optimize;
 };
 
 extern int Parrot_set_config_hash(Parrot_PMC interp_pmc);
@@ -263,6 +264,11 @@ run_imcc(Parrot_PMC interp, Parrot_String sourcefile, ARGIN(struct init_args_t *
         const Parrot_PMC compiler = pasm_mode ? pasm_compiler : pir_compiler;
         Parrot_PMC pbc;
 
+        if (flags->optimize
+        && !(imcc_set_optimization_level_api(interp, pir_compiler, flags->optimize)
+        &&   imcc_set_optimization_level_api(interp, pasm_compiler, flags->optimize)))
+            show_last_error_and_exit(interp);
+
         if (!imcc_compile_file_api(interp, compiler, sourcefile, &pbc))
             show_last_error_and_exit(interp);
         return pbc;
@@ -514,7 +520,7 @@ help(void)
     "       --hash-seed F00F  specify hex value to use as hash seed\n"
     "    -X --dynext add path to dynamic extension search\n"
     "   <Run core options>\n"
-    "    -R --runcore slow|bounds|fast\n"
+    "    -R --runcore slow|bounds|fast|cgoto|jit\n"
     "    -R --runcore trace|profiling|gcdebug\n"
     "    -t --trace [flags]\n"
     "   <VM options>\n"
@@ -529,6 +535,7 @@ help(void)
     "       --gc-min-threshold=KB\n"
     "       <GC GMS options>\n"
     "       --gc-nursery-size=percent of sysmem  size of gen0 (default 2)\n"
+    "       --gc-threads=N  threads marking old generations (default 1)\n"
     "       --gc-debug\n"
     "       --leak-test|--destroy-at-end\n"
     "    -. --wait    Read a keystroke before starting\n"
@@ -582,6 +589,7 @@ Parrot_cmd_options(void)
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_THREADS, OPTION_required_FLAG, { "--gc-threads" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
@@ -696,6 +704,21 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
                 exit(EXIT_FAILURE);
             }
             break;
+          case OPT_GC_THREADS:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_threads = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_threads < 1 || initargs->gc_threads > 256) {
+                    fprintf(stderr, "error: GC threads must be between 1 and 256\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC threads specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
 
           case OPT_HASH_SEED:
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
@@ -746,6 +769,7 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
     args->outfile = NULL;
     args->sourcefile = NULL;
     args->preprocess_only = 0;
+    args->optimize = NULL;
 
     if (argc == 1) {
         usage(stderr);
@@ -761,6 +785,7 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_THREADS:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
@@ -859,6 +884,10 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
             /* result = Parrot_api_set_warnings(interp, PARROT_WARNINGS_ALL_FLAG); */
             result = Parrot_api_set_warnings(interp, 0xFFFF);
             break;
+          case 'O':
+            /* a bare -O means -O1 */
+            args->optimize = opt.opt_arg && *opt.opt_arg ? opt.opt_arg : "1";
+            break;
           case 'E':
             args->preprocess_only = 1;
           default:
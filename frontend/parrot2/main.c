@@ -31,6 +31,7 @@ struct init_args_t {
     Parrot_Int turn_gc_off;
     const char ** argv;
     int argc;
+    const char *optimize;
 };
 
 extern int Parrot_set_config_hash(Parrot_PMC interp_pmc);
@@ -88,7 +89,9 @@ static void print_parrot_string(
         FUNC_MODIFIES(*vector);
 
 PARROT_CANNOT_RETURN_NULL
-static void setup_imcc(Parrot_PMC interp);
+static void setup_imcc(
+    Parrot_PMC interp,
+    ARGIN_NULLOK(const char *optimize));
 
 static void show_last_error_and_exit(Parrot_PMC interp);
 static void usage(ARGMOD(FILE *fp))
@@ -161,7 +164,7 @@ main(int argc, const char *argv[])
         show_last_error_and_exit(interp);
 
     Parrot_api_toggle_gc(interp, 0);
-    setup_imcc(interp);
+    setup_imcc(interp, parsed_flags.optimize);
     if (!parsed_flags.turn_gc_off)
         Parrot_api_toggle_gc(interp, 1);
 
@@ -179,9 +182,10 @@ main(int argc, const char *argv[])
 
 /*
 
-=item C<static void setup_imcc(Parrot_PMC interp)>
+=item C<static void setup_imcc(Parrot_PMC interp, const char *optimize)>
 
-Call into IMCC to either compile or preprocess the input.
+Call into IMCC to either compile or preprocess the input. C<optimize> holds
+the flags of the C<-O> option, if it was given.
 
 =cut
 
@@ -189,7 +193,7 @@ Call into IMCC to either compile or preprocess the input.
 
 PARROT_CANNOT_RETURN_NULL
 static void
-setup_imcc(Parrot_PMC interp)
+setup_imcc(Parrot_PMC interp, ARGIN_NULLOK(const char *optimize))
 {
     ASSERT_ARGS(setup_imcc)
     Parrot_PMC pir_compiler = NULL;
@@ -198,6 +202,11 @@ setup_imcc(Parrot_PMC interp)
     if (!(imcc_get_pir_compreg_api(interp, 1, &pir_compiler) &&
           imcc_get_pasm_compreg_api(interp, 1, &pasm_compiler)))
         show_last_error_and_exit(interp);
+
+    if (optimize
+    && !(imcc_set_optimization_level_api(interp, pir_compiler, optimize)
+    &&   imcc_set_optimization_level_api(interp, pasm_compiler, optimize)))
+        show_last_error_and_exit(interp);
 }
 
 
@@ -429,6 +438,7 @@ Parrot_cmd_options(void)
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_THREADS, OPTION_required_FLAG, { "--gc-threads" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
@@ -515,6 +525,21 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
                 exit(EXIT_FAILURE);
             }
             break;
+          case OPT_GC_THREADS:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_threads = strtoul(opt.opt_arg, NULL, 10);
+
+                if (initargs->gc_threads < 1 || initargs->gc_threads > 256) {
+                    fprintf(stderr, "error: GC threads must be between 1 and 256\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC threads specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
 
           case OPT_HASH_SEED:
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
@@ -563,6 +588,7 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
     args->run_core_name = "fast";
     args->trace = 0;
     args->turn_gc_off = 0;
+    args->optimize = NULL;
     pargs[nargs++] = argv[0];
 
     while ((status = longopt_get(argc, argv, Parrot_cmd_options(), &opt)) > 0) {
@@ -574,11 +600,16 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_THREADS:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
             args->turn_gc_off = 1;
             break;
+          case 'O':
+            /* a bare -O means -O1 */
+            args->optimize = opt.opt_arg && *opt.opt_arg ? opt.opt_arg : "1";
+            break;
           case 't':
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 const unsigned long _temp = strtoul(opt.opt_arg, NULL, 16);
@@ -1,5 +1,5 @@
 /* caches.h
- *  Copyright (C) 2001-2004, Parrot Foundation.
+ *  Copyright (C) 2001-2011, Parrot Foundation.
  *  Overview:
  *     Cache and direct freelist handling for various items.
  *  Data Structure and Algorithms:
@@ -25,6 +25,76 @@ typedef struct _meth_cache_entry {
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/*
+ * inline method caches of callmethod call sites
+ *
+ * Call sites hash into a direct-mapped table of METHOD_IC_SIZE slots.  Each
+ * slot remembers up to METHOD_IC_ENTRIES lookups, keyed on the invocant's
+ * vtable, its class (objects only) and the method name.  Slots from an older
+ * ic_version are empty.
+ */
+#define METHOD_IC_SIZE_MASK 0x1ff
+#define METHOD_IC_SIZE      (1 + METHOD_IC_SIZE_MASK)
+#define METHOD_IC_ENTRIES   4
+
+typedef struct _method_ic_entry {
+    VTABLE *vtable;             /* vtable of the invocant */
+    PMC    *_class;             /* class of the invocant if it's an Object */
+    STRING *name;               /* method name */
+    PMC    *method;             /* the method sub pmc */
+} Method_ic_entry;
+
+typedef struct _method_ic {
+    const opcode_t *site;       /* call site owning the slot */
+    UINTVAL         version;    /* ic_version the entries are valid for */
+    UINTVAL         n_entries;
+    UINTVAL         next;       /* entry to replace when full */
+    Method_ic_entry entries[METHOD_IC_ENTRIES];
+} Method_ic;
+
+/*
+ * inline attribute caches of getattribute and setattribute sites
+ *
+ * Sites hash by their pc into a direct-mapped table of ATTRIB_IC_SIZE slots.
+ * Each slot remembers where the attribute named at the site is stored in the
+ * objects of one class.  The attribute index of the class is part of the key,
+ * as it is rebuilt when a modified class is instantiated again.  Slots from
+ * an older ic_version are empty.
+ */
+#define ATTRIB_IC_SIZE_MASK 0x1ff
+#define ATTRIB_IC_SIZE      (1 + ATTRIB_IC_SIZE_MASK)
+
+typedef struct _attrib_ic {
+    const opcode_t *site;       /* attribute access owning the slot */
+    UINTVAL         version;    /* ic_version the slot is valid for */
+    PMC            *_class;     /* class of the object */
+    PMC            *attrib_index; /* attribute index of the class */
+    STRING         *name;       /* attribute name */
+    INTVAL          index;      /* position in the object's attribute store */
+} Attrib_ic;
+
+/*
+ * inline lexical caches of find_lex and store_lex sites
+ *
+ * Sites hash by their pc into a direct-mapped table of LEX_IC_SIZE slots.
+ * Each slot remembers how many outer contexts up from the site's context
+ * the lexical lives and in which register, along with the LexInfo of each
+ * pad passed on the way (NULL for contexts without one), which must match
+ * for the slot to apply.  Slots from an older ic_version are empty.
+ */
+#define LEX_IC_SIZE_MASK 0x1ff
+#define LEX_IC_SIZE      (1 + LEX_IC_SIZE_MASK)
+#define LEX_IC_DEPTH     8
+
+typedef struct _lex_ic {
+    const opcode_t *site;       /* lexical access owning the slot */
+    UINTVAL         version;    /* ic_version the slot is valid for */
+    STRING         *name;       /* lexical name */
+    UINTVAL         depth;      /* outer contexts up from the site's one */
+    INTVAL          reg;        /* register number of the lexical */
+    PMC            *lexinfo[LEX_IC_DEPTH]; /* LexInfo of each pad passed */
+} Lex_ic;
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
@@ -32,6 +102,10 @@ typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
     Meth_cache_entry ***idx;    /* bufstart idx */
     /* PMC **hash */            /* for non-constant keys */
+    Method_ic *ics;             /* inline caches, allocated on first use */
+    UINTVAL    ic_version;      /* bumped on each method cache invalidation */
+    Attrib_ic *attrib_ics;      /* attribute caches, allocated on first use */
+    Lex_ic    *lex_ics;         /* lexical caches, allocated on first use */
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
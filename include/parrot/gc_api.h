@@ -39,6 +39,7 @@ typedef struct _Parrot_GC_Init_Args {
     Parrot_Float4 nursery_size;
     Parrot_Int dynamic_threshold;
     Parrot_Int min_threshold;
+    Parrot_Int threads;
 } Parrot_GC_Init_Args;
 
 typedef enum _gc_sys_type_enum {
@@ -118,6 +119,7 @@ typedef enum {
 #define GC_finish_FLAG         (UINTVAL)(1 << 3)   /* on Parrot exit: mark (almost) all PMCs dead and */
 #define GC_strings_cb_FLAG     (UINTVAL)(1 << 4)   /* Invoked from String GC during mem_alloc to sweep dead strings */
                                                    /* garbage collect. */
+#define GC_incremental_sweep_FLAG (UINTVAL)(1 << 5) /* on allocation: may sweep later */
 
 /* HEADERIZER BEGIN: src/gc/api.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
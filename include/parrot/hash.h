@@ -20,9 +20,11 @@ typedef enum {
 /* A BucketIndex is an index into the pool of available buckets. */
 typedef UINTVAL BucketIndex;
 
+/* The index has two slots per bucket, so it is never more than half full */
 #define N_BUCKETS(n) ((n))
+#define N_SLOTS(n)   ((n) << 1)
 #define HASH_ALLOC_SIZE(n) (N_BUCKETS(n) * sizeof (HashBucket) + \
-                                     (n) * sizeof (HashBucket *))
+                                N_SLOTS(n) * sizeof (HashSlot))
 
 /* &gen_from_enum(hash_key_type.pasm) */
 typedef enum {
@@ -36,18 +38,26 @@ typedef enum {
 } Hash_key_type;
 /* &end_gen */
 
+/* Free buckets have a NULL key and chain the free list through value */
 typedef struct _hashbucket {
-    struct _hashbucket *next;
     void *key;
     void *value;
 } HashBucket;
 
+/* A slot of the open-addressing index.  Keys are placed with linear probing
+ * and Robin Hood displacement; the low bits of the hash value are kept in the
+ * slot, so probes rarely have to touch a bucket that does not match. */
+typedef struct _hashslot {
+    Parrot_UInt4 hashval;   /* low 32 bits of the key's hash value */
+    Parrot_UInt4 bucket;    /* bucket number plus one, 0 if the slot is empty */
+} HashSlot;
+
 struct _hash {
     /* Large slab store of buckets */
     HashBucket *buckets;
 
-    /* List of Bucket pointers */
-    HashBucket **index;
+    /* Open-addressing index into the buckets, N_SLOTS(mask + 1) long */
+    HashSlot *index;
 
     /* Store for empty buckets */
     HashBucket *free_list;
@@ -69,6 +79,22 @@ struct _hash {
 
 };
 
+/* Incremental state of the string hash.  Strings are hashed with SipHash-1-3
+ * over 64-bit words of eight codepoints each, one byte per codepoint while
+ * they all fit, so equal strings hash alike whatever their encoding. */
+typedef struct Parrot_hash_state {
+    Parrot_UInt8 v0, v1, v2, v3;
+    UINTVAL      block[8];         /* codepoints not yet mixed in */
+    UINTVAL      len;              /* number of codepoints seen */
+} Parrot_hash_state;
+
+#define PARROT_HASH_ADD_CODEPOINT(st, c)                                    \
+do {                                                                        \
+    (st)->block[(st)->len & 7] = (c);                                       \
+    if ((++(st)->len & 7) == 0)                                             \
+        Parrot_hash_state_block((st));                                      \
+} while (0)
+
 /* Utility macros - use them, do not reinvent the wheel */
 
 #define parrot_hash_iterate_linear(_hash, _code)                            \
@@ -88,11 +114,11 @@ struct _hash {
 {                                                                           \
     if ((_hash)->entries) {                                                 \
         UINTVAL _loc;                                                       \
-        for (_loc = 0; _loc <= (_hash)->mask; ++_loc) {                     \
-            HashBucket *_bucket = (_hash)->index[_loc];                     \
-            while (_bucket) {                                               \
+        for (_loc = 0; _loc < N_SLOTS((_hash)->mask + 1); ++_loc) {         \
+            if ((_hash)->index[_loc].bucket) {                              \
+                HashBucket *_bucket =                                       \
+                    (_hash)->buckets + (_hash)->index[_loc].bucket - 1;     \
                 _code                                                       \
-                _bucket = _bucket->next;                                    \
             }                                                               \
         }                                                                   \
     }                                                                       \
@@ -123,6 +149,15 @@ enum ORDERED_HASH_ITEM_PART {
 /* HEADERIZER BEGIN: src/hash.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_EXPORT
+PARROT_HOT
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+size_t Parrot_hash_buffer(
+    ARGIN_NULLOK(const unsigned char *buf),
+    size_t len,
+    size_t hashval);
+
 PARROT_EXPORT
 void Parrot_hash_clone(PARROT_INTERP,
     ARGIN(const Hash *hash),
@@ -204,6 +239,13 @@ PARROT_CANNOT_RETURN_NULL
 Hash * Parrot_hash_new_pointer_hash(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+size_t Parrot_hash_pointer(
+    ARGIN_NULLOK(const void * const p),
+    size_t hashval);
+
 PARROT_EXPORT
 PARROT_IGNORABLE_RESULT
 PARROT_CAN_RETURN_NULL
@@ -221,6 +263,25 @@ PARROT_PURE_FUNCTION
 INTVAL Parrot_hash_size(PARROT_INTERP, ARGIN(const Hash *hash))
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_HOT
+void Parrot_hash_state_block(ARGMOD(Parrot_hash_state *st))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+PARROT_EXPORT
+PARROT_HOT
+PARROT_WARN_UNUSED_RESULT
+size_t Parrot_hash_state_finish(ARGMOD(Parrot_hash_state *st))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+PARROT_EXPORT
+PARROT_HOT
+void Parrot_hash_state_init(ARGOUT(Parrot_hash_state *st), size_t seed)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
 PARROT_EXPORT
 void Parrot_hash_update(PARROT_INTERP,
     ARGMOD(Hash *hash),
@@ -230,14 +291,6 @@ void Parrot_hash_update(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*hash);
 
-PARROT_HOT
-PARROT_WARN_UNUSED_RESULT
-PARROT_PURE_FUNCTION
-size_t Parrot_hash_buffer(
-    ARGIN_NULLOK(const unsigned char *buf),
-    size_t len,
-    size_t hashval);
-
 void Parrot_hash_chash_destroy(PARROT_INTERP, ARGMOD(Hash *hash))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -327,12 +380,6 @@ STRING* Parrot_hash_key_to_string(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
-PARROT_WARN_UNUSED_RESULT
-PARROT_PURE_FUNCTION
-size_t Parrot_hash_pointer(
-    ARGIN_NULLOK(const void * const p),
-    size_t hashval);
-
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 Hash * Parrot_hash_thaw(PARROT_INTERP, ARGMOD(PMC *info))
@@ -394,6 +441,7 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_Parrot_hash_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_hash_clone __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash) \
@@ -428,16 +476,22 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_hash_new_pointer_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_hash_pointer __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_hash_put __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_Parrot_hash_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_Parrot_hash_state_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_Parrot_hash_state_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_Parrot_hash_state_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
 #define ASSERT_ARGS_Parrot_hash_update __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash) \
     , PARROT_ASSERT_ARG(other))
-#define ASSERT_ARGS_Parrot_hash_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_hash_chash_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -479,7 +533,6 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_hash_key_to_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
-#define ASSERT_ARGS_Parrot_hash_pointer __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_hash_thaw __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(info))
@@ -17,6 +17,9 @@
 /* preallocate freeze image for aggregates with this estimation */
 #define FREEZE_BYTES_PER_ITEM 9
 
+/* bytes buffered at a time when freezing to a handle */
+#define IMAGE_STREAM_CHUNK 65536
+
 enum {
     enum_PackID_normal      = 0,
     enum_PackID_seen        = 1,
@@ -20,7 +20,7 @@ typedef enum {
     PARROT_EXTERN_CODE_FLAG = 0x100, /* reusing another interp's code */
     PARROT_DESTROY_FLAG     = 0x200, /* the last interpreter shall cleanup */
 
-    PARROT_IS_THREAD        = 0x1000, /* interpreter is a thread */
+    PARROT_IS_THREAD        = 0x1000, /* a thread, with a heap of its own */
     PARROT_THR_COPY_INTERP  = 0x2000, /* thread start copies interp state */
     PARROT_THR_THREAD_POOL  = 0x4000  /* type3 threads */
 
@@ -57,6 +57,8 @@ typedef enum {
     PARROT_SLOW_CORE,                       /* slow bounds/trace core */
     PARROT_FUNCTION_CORE    = PARROT_SLOW_CORE,
     PARROT_FAST_CORE        = 0x01,         /* fast DO_OP core */
+    PARROT_CGOTO_CORE       = 0x02,         /* direct-threaded computed goto core */
+    PARROT_JIT_CORE         = 0x04,         /* x86-64 baseline JIT core */
     PARROT_EXEC_CORE        = 0x20,         /* TODO Parrot_exec_run variants */
     PARROT_GC_DEBUG_CORE    = 0x40,         /* run GC before each op */
     PARROT_DEBUGGER_CORE    = 0x80,         /* used by parrot debugger */
@@ -230,6 +232,8 @@ struct parrot_interp_t {
 
     STRING     **const_cstring_table;         /* CONST_STRING(x) items */
     Hash        *const_cstring_hash;          /* cache of const_string items */
+    Hash        *intern_hash;                 /* interned strings */
+    struct _Parrot_String_Index *string_index; /* character offset cache */
 
     struct _handler_node_t *exit_handler_list;/* exit.c */
     int sleeping;                             /* used during sleep in events */
@@ -248,6 +252,8 @@ struct parrot_interp_t {
     /* during a call sequencer the caller fills these objects
      * inside the invoke these get moved to the context structure */
     PMC *current_cont;                        /* the return continuation PMC */
+    UINTVAL context_captures;                 /* bumped whenever a context may
+                                               * be reached after its return */
     Parrot_jump_buff *api_jmp_buf;            /* jmp point out of Parrot */
     PMC * final_exception;                    /* Final exception PMC */
     INTVAL exit_code;
@@ -52,6 +52,7 @@
 #define PIO_F_BLKBUF    00020000
 #define PIO_F_SOFT_SP   00040000        /* Python softspace */
 #define PIO_F_SHARED    00100000        /* Stream shares a file handle  */
+#define PIO_F_MMAP      00200000        /* Read through a memory map    */
 #define PIO_F_ASYNC     01000000        /* In Parrot async is default   */
 
 /* These macros will be removed */
@@ -323,6 +324,13 @@ PIOOFF_T Parrot_io_tell_handle(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_io_would_block(PARROT_INTERP, ARGMOD(PMC *pmc), INTVAL which)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_io_write_handle(PARROT_INTERP,
@@ -421,6 +429,9 @@ PIOOFF_T Parrot_io_make_offset_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
 #define ASSERT_ARGS_Parrot_io_tell_handle __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_Parrot_io_would_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_Parrot_io_write_handle __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc) \
@@ -448,6 +459,11 @@ INTVAL Parrot_io_flush_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle))
 INTVAL Parrot_io_init_buffer(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+INTVAL Parrot_io_map_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*filehandle);
+
 INTVAL Parrot_io_peek_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -474,6 +490,23 @@ STRING * Parrot_io_readline_buffer(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*filehandle);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING * Parrot_io_reads_mapped(PARROT_INTERP,
+    ARGMOD(PMC *filehandle),
+    size_t length,
+    ARGIN(const STR_VTABLE *encoding))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*filehandle);
+
+void Parrot_io_release_mapping(ARGIN(const void *start))
+        __attribute__nonnull__(1);
+
+void Parrot_io_retain_mapping(ARGIN(const void *start))
+        __attribute__nonnull__(1);
+
 PIOOFF_T Parrot_io_seek_buffer(PARROT_INTERP,
     ARGMOD(PMC *filehandle),
     PIOOFF_T offset,
@@ -510,6 +543,9 @@ size_t Parrot_io_write_buffer(PARROT_INTERP,
     , PARROT_ASSERT_ARG(filehandle))
 #define ASSERT_ARGS_Parrot_io_init_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_io_map_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle))
 #define ASSERT_ARGS_Parrot_io_peek_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(filehandle))
@@ -521,6 +557,14 @@ size_t Parrot_io_write_buffer(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(filehandle) \
     , PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_Parrot_io_reads_mapped __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle) \
+    , PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_Parrot_io_release_mapping __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(start))
+#define ASSERT_ARGS_Parrot_io_retain_mapping __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(start))
 #define ASSERT_ARGS_Parrot_io_seek_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(filehandle))
@@ -16,7 +16,6 @@
 #include "parrot/parrot.h"
 
 #define PARROT_MMD_MAX_CLASS_DEPTH 1000
-#define Parrot_mmd_cache_destroy(x, y)
 
 /* function typedefs */
 typedef PMC*    (*mmd_f_p_ppp)(PARROT_INTERP, PMC *, PMC *, PMC *);
@@ -54,7 +53,25 @@ typedef struct _multi_func_list {
     funcptr_t func_ptr;
 } multi_func_list;
 
-#define MMD_Cache PMC
+/* Dispatch results cached per name and argument type tuple.  Calls with more
+ * than MMD_CACHE_MAX_TYPES arguments are dispatched without the cache. */
+#define MMD_CACHE_MAX_TYPES   8
+#define MMD_CACHE_MIN_ENTRIES 16
+#define MMD_CACHE_MAX_ENTRIES 4096
+
+typedef struct _MMD_cache_entry {
+    PMC    *chosen;                       /* candidate, NULL if unused */
+    char   *name;                         /* multi name, NULL if none */
+    UINTVAL hashval;
+    INTVAL  n_types;
+    INTVAL  types[MMD_CACHE_MAX_TYPES];
+} MMD_cache_entry;
+
+typedef struct _MMD_Cache {
+    MMD_cache_entry *entries;             /* open addressing, linear probing */
+    UINTVAL          mask;                /* number of entries - 1 */
+    UINTVAL          used;
+} MMD_Cache;
 
 /* HEADERIZER BEGIN: src/multidispatch.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -96,21 +113,31 @@ PMC* Parrot_mmd_build_type_tuple_from_sig_obj(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_mmd_cache_clear(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cache);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 MMD_Cache * Parrot_mmd_cache_create(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+void Parrot_mmd_cache_destroy(PARROT_INTERP,
+    ARGFREE_NOTNULL(MMD_Cache *cache))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC * Parrot_mmd_cache_lookup_by_types(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *types))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*cache);
 
@@ -119,11 +146,10 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC * Parrot_mmd_cache_lookup_by_values(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *values))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*cache);
 
@@ -136,12 +162,11 @@ void Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 PARROT_EXPORT
 void Parrot_mmd_cache_store_by_types(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *types),
     ARGIN(PMC *chosen))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*cache);
@@ -149,12 +174,11 @@ void Parrot_mmd_cache_store_by_types(PARROT_INTERP,
 PARROT_EXPORT
 void Parrot_mmd_cache_store_by_values(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *values),
     ARGIN(PMC *chosen))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*cache);
@@ -220,19 +244,22 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sig_obj))
+#define ASSERT_ARGS_Parrot_mmd_cache_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache))
 #define ASSERT_ARGS_Parrot_mmd_cache_create __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_mmd_cache_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache))
 #define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_types \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(types))
 #define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_values \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(values))
 #define ASSERT_ARGS_Parrot_mmd_cache_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -241,14 +268,12 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(types) \
     , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_cache_store_by_values \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(values) \
     , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_find_multi_from_long_sig \
@@ -86,6 +86,30 @@ PMC * Parrot_find_method_with_cache(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_find_method_with_inline_cache(PARROT_INTERP,
+    ARGIN(const opcode_t *site),
+    ARGIN(PMC *object),
+    ARGIN(STRING *method_name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_get_attr_with_inline_cache(PARROT_INTERP,
+    ARGIN(const opcode_t *site),
+    ARGIN(PMC *object),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_EXPORT
 INTVAL Parrot_get_vtable_index(PARROT_INTERP, ARGIN(const STRING *name))
         __attribute__nonnull__(1)
@@ -140,6 +164,18 @@ PMC * Parrot_oo_new_class_pmc(PARROT_INTERP, ARGIN(PMC *classtype))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_set_attr_with_inline_cache(PARROT_INTERP,
+    ARGIN(const opcode_t *site),
+    ARGIN(PMC *object),
+    ARGIN(STRING *name),
+    ARGIN(PMC *value))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5);
+
 void destroy_object_cache(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -196,6 +232,18 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(_class) \
     , PARROT_ASSERT_ARG(method_name))
+#define ASSERT_ARGS_Parrot_find_method_with_inline_cache \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(site) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(method_name))
+#define ASSERT_ARGS_Parrot_get_attr_with_inline_cache \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(site) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_Parrot_get_vtable_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
@@ -221,6 +269,13 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_oo_new_class_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(classtype))
+#define ASSERT_ARGS_Parrot_set_attr_with_inline_cache \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(site) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(value))
 #define ASSERT_ARGS_destroy_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_init_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
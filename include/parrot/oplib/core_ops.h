@@ -1123,6 +1123,11 @@ op_lib_t *Parrot_DynOp_core_3_10_0(PARROT_INTERP, long init);
  opcode_t * Parrot_wait_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_wait_pc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_pass(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_mod_i_i_i__unless_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__branch_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_p_p__add_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_p_p__add_p_p__add_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_p__lt_p_ic_ic(opcode_t *, PARROT_INTERP);
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
@@ -0,0 +1,37 @@
+
+#ifndef PARROT_OPLIB_CORE_OPS_CG_H_GUARD
+#define PARROT_OPLIB_CORE_OPS_CG_H_GUARD
+
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/ops/core.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+opcode_t * Parrot_runops_core_ops_cg(PARROT_INTERP, ARGIN(opcode_t *cur_opcode))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+
+#endif /* PARROT_OPLIB_CORE_OPS_CG_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
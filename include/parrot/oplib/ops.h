@@ -1116,7 +1116,12 @@ typedef enum {
     PARROT_OP_receive_p,                       /* 1098 */
     PARROT_OP_wait_p,                          /* 1099 */
     PARROT_OP_wait_pc,                         /* 1100 */
-    PARROT_OP_pass                             /* 1101 */
+    PARROT_OP_pass,                            /* 1101 */
+    PARROT_OP_mod_i_i_i__unless_i_ic,          /* 1102 */
+    PARROT_OP_dec_i__branch_ic,                /* 1103 */
+    PARROT_OP_add_p_p__add_p_p,                /* 1104 */
+    PARROT_OP_add_p_p__add_p_p__add_p_p,       /* 1105 */
+    PARROT_OP_dec_p__lt_p_ic_ic                /* 1106 */
 
 } parrot_opcode_enums;
 
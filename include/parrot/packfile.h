@@ -217,6 +217,9 @@ struct PackFile_ByteCode {
     op_func_t                    *op_func_table;   /* opcode dispatch table */
     op_func_t                    *save_func_table; /* for when we hijack op_func_table */
     op_info_t                   **op_info_table;
+    void                        **cgoto_thread;    /* label per opcode_t for the cgoto core */
+    size_t                        cgoto_thread_size;
+    struct Parrot_jit_code       *jit_code;        /* machine code for the jit core */
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
 };
@@ -111,6 +111,22 @@ INTVAL Parrot_io_recv(PARROT_INTERP, PIOHANDLE handle, ARGOUT(char *buf), size_t
 INTVAL Parrot_io_poll(PARROT_INTERP, PIOHANDLE handle, int which, int sec, int usec);
 INTVAL Parrot_io_close_socket(PARROT_INTERP, PIOHANDLE handle);
 
+/*
+ * I/O readiness, for tasks parked by the scheduler
+ */
+
+#define PIO_POLL_READ   1
+#define PIO_POLL_WRITE  2
+
+void *Parrot_io_reactor_new(PARROT_INTERP);
+void Parrot_io_reactor_destroy(PARROT_INTERP, ARGFREE(void *reactor));
+INTVAL Parrot_io_reactor_ready(PARROT_INTERP, PIOHANDLE handle, INTVAL which);
+INTVAL Parrot_io_reactor_add(PARROT_INTERP, ARGMOD(void *reactor), PIOHANDLE handle,
+            INTVAL which);
+void Parrot_io_reactor_remove(PARROT_INTERP, ARGMOD(void *reactor), PIOHANDLE handle);
+INTVAL Parrot_io_reactor_wait(PARROT_INTERP, ARGMOD(void *reactor), FLOATVAL timeout,
+            ARGOUT(PIOHANDLE *ready), INTVAL size);
+
 /*
  * Files and directories
  */
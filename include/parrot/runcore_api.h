@@ -15,6 +15,11 @@ typedef struct runcore_t Parrot_runcore_t;
 
 #  define DO_OP(PC, INTERP) ((PC) = (((INTERP)->code->op_func_table)[*(PC)])((PC), (INTERP)))
 
+/* The cgoto core needs the GNU C "labels as values" extension. */
+#if defined(__GNUC__) && !defined(PARROT_NO_COMPUTED_GOTO)
+#  define PARROT_HAS_COMPUTED_GOTO 1
+#endif
+
 typedef opcode_t * (*runcore_runops_fn_type) (PARROT_INTERP, ARGIN(Parrot_runcore_t *), ARGIN(opcode_t *pc));
 typedef       void (*runcore_destroy_fn_type)(PARROT_INTERP, ARGIN(Parrot_runcore_t *));
 typedef     void * (*runcore_prepare_fn_type)(PARROT_INTERP, ARGIN(Parrot_runcore_t *));
@@ -130,6 +135,35 @@ oplib_init_f get_core_op_lib_init(PARROT_INTERP,
     ARGIN(Parrot_runcore_t *runcore))
         __attribute__nonnull__(2);
 
+void Parrot_runcore_cgoto_free(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+void Parrot_runcore_cgoto_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+void ** Parrot_runcore_cgoto_thread(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs),
+    ARGIN(void *translate))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*cs);
+
+PARROT_CANNOT_RETURN_NULL
+void * Parrot_runcore_cgoto_translate(PARROT_INTERP,
+    ARGIN(const PackFile_ByteCode *cs),
+    ARGIN(const opcode_t *pc),
+    ARGIN(void * const *labels),
+    ARGIN(void *dynop))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5);
+
 void Parrot_runcore_debugger_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -147,6 +181,22 @@ void Parrot_runcore_slow_init(PARROT_INTERP)
 
 #define ASSERT_ARGS_get_core_op_lib_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_thread __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs) \
+    , PARROT_ASSERT_ARG(translate))
+#define ASSERT_ARGS_Parrot_runcore_cgoto_translate \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs) \
+    , PARROT_ASSERT_ARG(pc) \
+    , PARROT_ASSERT_ARG(labels) \
+    , PARROT_ASSERT_ARG(dynop))
 #define ASSERT_ARGS_Parrot_runcore_debugger_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_exec_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
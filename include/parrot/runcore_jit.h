@@ -0,0 +1,58 @@
+/* runcore_jit.h
+ *  Copyright (C) 2011, Parrot Foundation.
+ *  Overview:
+ *     Data structures of the x86-64 baseline JIT runcore.
+ */
+
+#ifndef PARROT_RUNCORE_JIT_H_GUARD
+#define PARROT_RUNCORE_JIT_H_GUARD
+
+#include "parrot/runcore_api.h"
+
+/* The JIT emits x86-64 code for the System V calling convention and assumes
+ * that INTVAL, FLOATVAL and opcode_t are all 8 bytes wide. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__amd64__)) \
+    && !defined(_WIN32) && defined(PARROT_HAS_HEADER_SYSMMAN) \
+    && INTVAL_SIZE == 8 && NUMVAL_SIZE == 8 && !defined(PARROT_NO_JIT)
+#  define PARROT_HAS_JIT 1
+#endif
+
+typedef opcode_t * (*Parrot_jit_entry_t)(PARROT_INTERP, ARGIN(void *block));
+
+typedef struct Parrot_jit_code {
+    struct Parrot_jit_code *prev;      /* older translation of the segment */
+    size_t                  size;      /* segment size when it was translated */
+    void                  **blocks;    /* machine code per opcode_t, or NULL */
+    unsigned char          *code;      /* executable memory, NULL if none */
+    size_t                  code_size;
+    Parrot_jit_entry_t      entry;     /* jumps to a block, returns next pc */
+    INTVAL                  active;    /* runloops running this translation */
+} Parrot_jit_code;
+
+/* HEADERIZER BEGIN: src/runcore/jit.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_runcore_jit_free(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+void Parrot_runcore_jit_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_runcore_jit_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_Parrot_runcore_jit_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/jit.c */
+
+#endif /* PARROT_RUNCORE_JIT_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
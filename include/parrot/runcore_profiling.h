@@ -26,7 +26,8 @@ typedef enum Parrot_profiling_flags {
     PROFILING_FIRST_LOOP_FLAG         = 1 << 1,
     PROFILING_HAVE_PRINTED_CLI_FLAG   = 1 << 2,
     PROFILING_REPORT_ANNOTATIONS_FLAG = 1 << 3,
-    PROFILING_CANONICAL_OUTPUT_FLAG   = 1 << 4
+    PROFILING_CANONICAL_OUTPUT_FLAG   = 1 << 4,
+    PROFILING_FULL_OPNAMES_FLAG       = 1 << 5
 } Parrot_profiling_flags;
 
 typedef enum Parrot_profiling_line {
@@ -144,6 +145,13 @@ struct profiling_runcore_t {
 #define Profiling_canonical_output_CLEAR(o) \
     Profiling_flag_CLEAR(o, PROFILING_CANONICAL_OUTPUT_FLAG)
 
+#define Profiling_full_opnames_TEST(o) \
+    Profiling_flag_TEST(o, PROFILING_FULL_OPNAMES_FLAG)
+#define Profiling_full_opnames_SET(o) \
+    Profiling_flag_SET(o, PROFILING_FULL_OPNAMES_FLAG)
+#define Profiling_full_opnames_CLEAR(o) \
+    Profiling_flag_CLEAR(o, PROFILING_FULL_OPNAMES_FLAG)
+
 /* HEADERIZER BEGIN: src/runcore/profiling.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
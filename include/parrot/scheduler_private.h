@@ -53,7 +53,8 @@ typedef enum {
 typedef enum {
     TASK_active_FLAG     = PObj_private0_FLAG,
     TASK_in_preempt_FLAG = PObj_private1_FLAG,
-    TASK_recv_block_FLAG = PObj_private2_FLAG
+    TASK_recv_block_FLAG = PObj_private2_FLAG,
+    TASK_io_block_FLAG   = PObj_private3_FLAG
 } task_flags_enum;
 
 #define TASK_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -77,6 +78,11 @@ typedef enum {
 #define TASK_recv_block_SET(o)   TASK_flag_SET(recv_block, o)
 #define TASK_recv_block_CLEAR(o) TASK_flag_CLEAR(recv_block, o)
 
+/* Flag is set when the task has just parked to wait for I/O */
+#define TASK_io_block_TEST(o)  TASK_flag_TEST(io_block, o)
+#define TASK_io_block_SET(o)   TASK_flag_SET(io_block, o)
+#define TASK_io_block_CLEAR(o) TASK_flag_CLEAR(io_block, o)
+
 
 #endif /* PARROT_SCHEDULER_PRIVATE_H_GUARD */
 
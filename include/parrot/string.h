@@ -85,6 +85,24 @@ typedef struct _Parrot_String_Bounds {
     INTVAL  delim;
 } Parrot_String_Bounds;
 
+/* Private PObj flags of STRING headers */
+typedef enum {
+    /* the one string in the intern table with these contents and this
+     * encoding, see Parrot_str_intern */
+    STRING_interned_FLAG = PObj_private0_FLAG,
+    /* points into a file mapped by a handle, which stays mapped until it is
+     * freed, see Parrot_io_release_mapping */
+    STRING_mapped_FLAG   = PObj_private1_FLAG
+} STRING_flags;
+
+#define STRING_interned_TEST(s) (PObj_get_FLAGS(s) & STRING_interned_FLAG)
+#define STRING_mapped_TEST(s)   (PObj_get_FLAGS(s) & STRING_mapped_FLAG)
+
+/* Variable width encodings remember the byte offset of every
+ * STRING_INDEX_STEP'th character of long strings, see
+ * Parrot_str_get_char_index */
+#define STRING_INDEX_STEP 64
+
 /* constructors */
 typedef STRING * (*str_vtable_to_encoding_t)(PARROT_INTERP, ARGIN(const STRING *src));
 typedef STRING * (*str_vtable_chr_t)(PARROT_INTERP, UINTVAL codepoint);
@@ -221,6 +221,21 @@ PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_sub_find_lex_register(PARROT_INTERP,
+    ARGIN(const opcode_t *site),
+    ARGIN(STRING *lex_name),
+    ARGIN(PMC *ctx),
+    INTVAL reg_type,
+    ARGOUT(INTVAL *reg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*reg);
+
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC* Parrot_sub_find_pad(PARROT_INTERP,
@@ -242,6 +257,11 @@ INTVAL Parrot_sub_get_line_from_pc(PARROT_INTERP,
         __attribute__nonnull__(1);
 
 void Parrot_sub_mark_context_start(void);
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_sub_new_return_continuation(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_Parrot_get_sub_pmc_from_subclass \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -272,6 +292,12 @@ void Parrot_sub_mark_context_start(void);
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_sub_find_lex_register __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(site) \
+    , PARROT_ASSERT_ARG(lex_name) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(reg))
 #define ASSERT_ARGS_Parrot_sub_find_pad __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
@@ -282,6 +308,9 @@ void Parrot_sub_mark_context_start(void);
 #define ASSERT_ARGS_Parrot_sub_get_line_from_pc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_sub_mark_context_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_sub_new_return_continuation \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/sub.c */
 
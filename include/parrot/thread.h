@@ -0,0 +1,84 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+*/
+
+#ifndef PARROT_THREAD_H_GUARD
+#define PARROT_THREAD_H_GUARD
+
+typedef struct Parrot_Worker_Pool Parrot_Worker_Pool;
+
+/* HEADERIZER BEGIN: src/thread.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+void Parrot_thr_pool_destroy(PARROT_INTERP,
+    ARGFREE_NOTNULL(Parrot_Worker_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_MALLOC
+Parrot_Worker_Pool * Parrot_thr_pool_new(PARROT_INTERP, INTVAL n_workers)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+INTVAL Parrot_thr_pool_ready(PARROT_INTERP,
+    ARGMOD(Parrot_Worker_Pool *pool),
+    INTVAL id)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_thr_pool_result(PARROT_INTERP,
+    ARGMOD(Parrot_Worker_Pool *pool),
+    INTVAL id)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
+PARROT_EXPORT
+PARROT_PURE_FUNCTION
+INTVAL Parrot_thr_pool_size(ARGIN(const Parrot_Worker_Pool *pool))
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+INTVAL Parrot_thr_pool_submit(PARROT_INTERP,
+    ARGMOD(Parrot_Worker_Pool *pool),
+    ARGIN(PMC *sub),
+    ARGIN_NULLOK(PMC *arg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pool);
+
+#define ASSERT_ARGS_Parrot_thr_pool_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thr_pool_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_thr_pool_ready __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thr_pool_result __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thr_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thr_pool_submit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(sub))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/thread.c */
+
+#endif /* PARROT_THREAD_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
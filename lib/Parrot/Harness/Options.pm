@@ -80,10 +80,11 @@ sub remap_runcore_opts
     my ($opts_ref) = @_;
 
     my %remap      = (
-        'j' => '-runcore=fast',
+        'j' => '-runcore=jit',
         'G' => '-runcore=gcdebug',
         'b' => '-runcore=bounds',
         'f' => '-runcore=fast',
+        'g' => '-runcore=cgoto',
         'r' => '-run-pbc',
     );
 
@@ -106,7 +107,8 @@ perl t/harness [options] [testfiles]
     -b         ... run bounds checked
     --run-exec ... run exec core
     -f         ... run fast core
-    -j         ... run fast core
+    -g         ... run cgoto core
+    -j         ... run jit core (up to 3.10, the fast core, now -f)
     -r         ... run the compiled pbc
     -v         ... run parrot with -v : This is NOT the same as prove -v
                    All tests run with this option will probably fail
@@ -536,6 +536,7 @@ of the file, one regex or an array reference of regexes,  and an optional
 diagnostic message. This function generates PBC for the input file, then post
 processes this with the binary and captures the output. The output is then
 verified to match the single or multiple regular expressions given.
+The PBC is compiled with C<$ENV{TEST_PROG_ARGS}>, so tests can set C<-O1>.
 
     my $postprocess = File::Spec->catfile( ".", "pbc_dump" );
     my $file  = 'foo.pir';
@@ -558,9 +559,10 @@ sub pbc_postprocess_output_like {
     my $stdoutfn = "$0.$testno.stdout";
     my $f        = IO::File->new(">$codefn");
     my $parrot   = File::Spec->catfile( ".", $PConfig{test_prog} );
+    my $args     = $ENV{TEST_PROG_ARGS} || '';
     $f->print($file);
     $f->close();
-    system("$parrot -o $pbcfn $codefn 2>&1");
+    system("$parrot $args -o $pbcfn $codefn 2>&1");
     system("$postprocess $pbcfn >$stdoutfn 2>&1");
     $f = IO::File->new($stdoutfn);
 
@@ -407,6 +407,7 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
     ctx->n_regs_used[REGNO_NUM] = number_regs_used[REGNO_NUM];
     ctx->n_regs_used[REGNO_STR] = number_regs_used[REGNO_STR];
     ctx->n_regs_used[REGNO_PMC] = number_regs_used[REGNO_PMC];
+    ctx->capture_mark           = interp->context_captures;
 
     if (!reg_alloc) {
         ctx->registers = NULL;
@@ -511,6 +512,73 @@ Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
 }
 
 
+/*
+
+=item C<void Parrot_pcc_release_registers(PARROT_INTERP, PMC *pmcctx)>
+
+Hands the register frame of a context which has just returned back to the
+fixed size allocator, instead of waiting for the GC to collect the context.
+The free list of each size is LIFO, so a call sequence reuses its frames much
+like a stack.
+
+This is only done when nothing can reach the registers anymore: the context
+belongs to a plain Sub without a LexPad, which is nobody's outer, and no
+continuation or closure was captured while it was active (see
+C<Parrot_pcc_capture_contexts>).  Otherwise the registers are freed along
+with the context.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_release_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_release_registers)
+    Parrot_CallContext_attributes * const ctx = PARROT_CALLCONTEXT(pmcctx);
+    PMC * const sub = ctx->current_sub;
+
+    if (!ctx->registers
+    ||  ctx->capture_mark != interp->context_captures
+    ||  !PMC_IS_NULL(ctx->lex_pad)
+    ||  PMC_IS_NULL(sub)
+    ||  sub->vtable->base_type != enum_class_Sub
+    ||  PObj_get_FLAGS(sub) & SUB_FLAG_IS_OUTER)
+        return;
+
+    Parrot_pcc_free_registers(interp, pmcctx);
+
+    ctx->registers              = NULL;
+    ctx->bp.regs_i              = NULL;
+    ctx->bp_ps.regs_s           = NULL;
+    ctx->n_regs_used[REGNO_INT] = 0;
+    ctx->n_regs_used[REGNO_NUM] = 0;
+    ctx->n_regs_used[REGNO_STR] = 0;
+    ctx->n_regs_used[REGNO_PMC] = 0;
+}
+
+
+/*
+
+=item C<void Parrot_pcc_capture_contexts(PARROT_INTERP)>
+
+Notes that every active context may now be reached after it returns, e.g.
+because a continuation or closure was taken or a return continuation was
+handed out.  None of their register frames will be released early.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_capture_contexts(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_capture_contexts)
+    ++interp->context_captures;
+}
+
+
 /*
 
 =item C<PMC * Parrot_alloc_context(PARROT_INTERP, const UINTVAL
@@ -142,6 +142,7 @@ Parrot_api_make_interpreter(Parrot_PMC parent, Parrot_Int flags,
             gc_args.nursery_size      = args->gc_nursery_size;
             gc_args.dynamic_threshold = args->gc_dynamic_threshold;
             gc_args.min_threshold     = args->gc_min_threshold;
+            gc_args.threads           = args->gc_threads;
 
             if (args->hash_seed)
                 interp_raw->hash_seed = args->hash_seed;
@@ -185,8 +186,12 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
     else {
         if (STREQ(corename, "slow") || STREQ(corename, "bounds"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
-        else if (STREQ(corename, "fast") || STREQ(corename, "jit") || STREQ(corename, "function"))
+        else if (STREQ(corename, "fast") || STREQ(corename, "function"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
+        else if (STREQ(corename, "cgoto") || STREQ(corename, "threaded"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
+        else if (STREQ(corename, "jit"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "jit"));
         else if (STREQ(corename, "subprof_sub"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "subprof_sub"));
         else if (STREQ(corename, "subprof_hll") || STREQ(corename, "subprof"))
@@ -70,6 +70,13 @@ children into "work_list".
 
 6. Iterate over "work_list" calling VTABLE_mark on it.
 
+When collecting older generations with more than one marking thread
+(C<--gc-threads>), the "work_list" is dealt out to the threads instead.  Each
+thread traces from its own stack of grey objects and offers surplus to idle
+threads, which steal it.  The live flag is set atomically, so an object
+reached by several threads is traced once.  Objects found this way stay in
+their generation list; only the live flag tells the sweep to keep them.
+
 7. Soil nursery root PMCs from C-stack.
 
 Main reason for it:
@@ -86,6 +93,17 @@ methods (e.g. pmc2c vtable overrides).
     - Move live objects into generation max(K+1, N)
     - Paint them white.
 
+When the collection was triggered by an allocation, generations 1..K are not
+swept right away.  Their lists are set aside as "unswept" and every following
+PMC or STRING allocation sweeps one chunk of them, so the pause of an old
+generation collection doesn't grow with the size of the old generations.
+Until it is swept an object keeps the live flag it got during marking, which
+tells the Write Barrier which list holds it, and that it still has to be
+promoted.  Whatever is left is swept before
+the next collection starts.  The nursery and all strings are always swept
+immediately: nursery objects aren't sealed, and string compaction needs to
+know which strings are alive.
+
 9. ...
 
 10. Profit!
@@ -109,6 +127,43 @@ TBD
 #include "gc_private.h"
 #include "fixed_allocator.h"
 
+/* Marking of older generations can be spread over POSIX threads */
+#if defined(PARROT_HAS_THREADS) && defined(PARROT_HAS_HEADER_PTHREAD) \
+    && defined(__GNUC__)
+#  include <pthread.h>
+#  include <sched.h>
+#  include <signal.h>
+#  define GMS_PARALLEL_MARK 1
+#endif
+
+#ifdef GMS_PARALLEL_MARK
+typedef pthread_mutex_t gms_lock_t;
+typedef pthread_cond_t  gms_cond_t;
+#  define GMS_LOCK(l)           pthread_mutex_lock(l)
+#  define GMS_UNLOCK(l)         pthread_mutex_unlock(l)
+#  define GMS_WAIT(c, l)        pthread_cond_wait((c), (l))
+#  define GMS_SIGNAL(c)         pthread_cond_signal(c)
+#  define GMS_BROADCAST(c)      pthread_cond_broadcast(c)
+#  define GMS_YIELD()           sched_yield()
+#  define GMS_ATOMIC_INC(v)     __sync_fetch_and_add(&(v), 1)
+#  define GMS_ATOMIC_DEC(v)     __sync_fetch_and_sub(&(v), 1)
+#  define GMS_ATOMIC_OR(v, f)   __sync_fetch_and_or(&(v), (f))
+#  define GMS_THREAD_LOCAL      __thread
+#else
+typedef int gms_lock_t;
+typedef int gms_cond_t;
+#  define GMS_LOCK(l)
+#  define GMS_UNLOCK(l)
+#  define GMS_WAIT(c, l)
+#  define GMS_SIGNAL(c)
+#  define GMS_BROADCAST(c)
+#  define GMS_YIELD()
+#  define GMS_ATOMIC_INC(v)     ((v)++)
+#  define GMS_ATOMIC_DEC(v)     ((v)--)
+#  define GMS_ATOMIC_OR(v, f)   (((v) & (f)) ? (f) : ((v) |= (f), 0))
+#  define GMS_THREAD_LOCAL
+#endif
+
 #define PANIC_OUT_OF_MEM(size) failed_allocation(__LINE__, (size))
 
 /*
@@ -119,6 +174,12 @@ TBD
  */
 #define MAX_GENERATIONS     4
 
+/* Upper bound for the number of marking threads */
+#define GMS_MAX_MARK_THREADS 256
+
+/* Grey objects a marking thread keeps before offering the rest to others */
+#define GMS_MARK_STACK_KEEP  256
+
 /* We allocate additional space in front of PObj* to store additional pointer */
 typedef struct pmc_alloc_struct {
     void *ptr;
@@ -149,6 +210,38 @@ typedef struct string_alloc_struct {
 #define SET_GEN_FLAGS(pmc, gen) PObj_flags_SETTO((pmc), \
         ((pmc)->flags & ~PObj_GC_all_generation_FLAGS) | GEN2FLAGS(gen))
 
+/* Grey objects waiting to be traced */
+typedef struct GMS_Mark_Stack {
+    PMC    **items;
+    size_t   size;
+    size_t   alloc;
+} GMS_Mark_Stack;
+
+/* One marking thread. The first marker is the interpreter's own thread */
+typedef struct GMS_Marker {
+    struct GMS_Mark_Pool *pool;
+    GMS_Mark_Stack        local;    /* used by the owner only */
+    GMS_Mark_Stack        shared;   /* surplus other markers may steal */
+    gms_lock_t            lock;     /* protects shared */
+#ifdef GMS_PARALLEL_MARK
+    pthread_t             thread;
+#endif
+} GMS_Marker;
+
+/* Helper threads for marking, started with --gc-threads */
+typedef struct GMS_Mark_Pool {
+    Interp               *interp;       /* interpreter being collected */
+    GMS_Marker           *markers;
+    size_t                n_markers;
+    volatile size_t       active;       /* markers which may still have work */
+    gms_lock_t            lock;         /* protects the fields below */
+    gms_cond_t            start;
+    gms_cond_t            done;
+    size_t                round;        /* bumped to start marking */
+    size_t                finished;     /* helpers done with this round */
+    int                   shutdown;
+} GMS_Mark_Pool;
+
 /* Private information */
 typedef struct MarkSweep_GC {
     /* Allocator for PMC headers */
@@ -169,6 +262,15 @@ typedef struct MarkSweep_GC {
     /* Currently allocate objects. */
     struct Parrot_Pointer_Array     *objects[MAX_GENERATIONS];
 
+    /* Old generations left to sweep while allocating, NULL when swept */
+    struct Parrot_Pointer_Array     *unswept[MAX_GENERATIONS];
+
+    /* Oldest generation left in "unswept", 0 if none */
+    size_t                           sweep_gen;
+
+    /* Next chunk of "unswept[sweep_gen]" to sweep */
+    size_t                           sweep_chunk;
+
     /* Allocator for strings */
     struct Pool_Allocator           *string_allocator;
 
@@ -195,8 +297,14 @@ typedef struct MarkSweep_GC {
 
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
 
+    /* Marking threads, NULL when marking on the interpreter's thread only */
+    struct GMS_Mark_Pool   *mark_pool;
+
 } MarkSweep_GC;
 
+/* Marker of the running thread during parallel marking */
+static GMS_THREAD_LOCAL GMS_Marker *gms_current_marker;
+
 /* Callback to destroy PMC or free string storage */
 typedef void (*sweep_cb)(PARROT_INTERP, PObj *obj);
 
@@ -288,11 +396,25 @@ static size_t gc_gms_count_used_string_memory(PARROT_INTERP,
 static void gc_gms_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_gms_finish_sweep(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_free_buffer_header(PARROT_INTERP,
     ARGFREE(Parrot_Buffer *s),
     size_t size)
         __attribute__nonnull__(1);
 
+static void gc_gms_free_dead_pmc(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(pmc_alloc_struct *item))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*item);
+
 static void gc_gms_free_fixed_size_storage(PARROT_INTERP,
     size_t size,
     ARGMOD(void *data))
@@ -351,21 +473,99 @@ static void gc_gms_iterate_live_strings(PARROT_INTERP,
 static void gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         __attribute__nonnull__(1);
 
+static void gc_gms_mark_drain(PARROT_INTERP, ARGMOD(GMS_Marker *marker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*marker);
+
+static int gc_gms_mark_in_parallel(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array *work_list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+static void gc_gms_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+static void gc_gms_mark_pool_start(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    size_t n_threads)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_gms_mark_pool_stop(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_gms_mark_stack_move(
+    ARGMOD(GMS_Mark_Stack *from),
+    ARGMOD(GMS_Mark_Stack *to),
+    size_t n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*from)
+        FUNC_MODIFIES(*to);
+
+static void gc_gms_mark_stack_push(
+    ARGMOD(GMS_Mark_Stack *stack),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*stack);
+
 static void gc_gms_mark_str_header(PARROT_INTERP, ARGMOD(STRING *str))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+static void gc_gms_mark_str_header_parallel(PARROT_INTERP,
+    ARGMOD(STRING *str))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*str);
+
+PARROT_CAN_RETURN_NULL
+static void * gc_gms_mark_thread(ARGIN(void *arg))
+        __attribute__nonnull__(1);
+
+PARROT_CAN_RETURN_NULL
+static PMC * gc_gms_marker_pop(ARGMOD(GMS_Marker *marker))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*marker);
+
+static void gc_gms_marker_push(ARGMOD(GMS_Marker *marker), ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*marker);
+
+static int gc_gms_marker_steal(ARGMOD(GMS_Marker *thief))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*thief);
+
 static void gc_gms_pmc_get_youngest_generation(PARROT_INTERP,
     ARGIN(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Pointer_Array * gc_gms_pmc_list(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_gms_pmc_needs_early_collection(PARROT_INTERP,
     ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
@@ -427,7 +627,14 @@ static void gc_gms_str_get_youngest_generation(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
-static void gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+static void gc_gms_sweep_pools(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    int lazy)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
+static void gc_gms_sweep_step(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*self);
@@ -504,8 +711,15 @@ static int gen2flags(int gen);
     , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_gc_gms_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_finish_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_free_dead_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(item))
 #define ASSERT_ARGS_gc_gms_free_fixed_size_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -540,16 +754,56 @@ static int gen2flags(int gen);
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_mark_and_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_gms_mark_drain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(marker))
+#define ASSERT_ARGS_gc_gms_mark_in_parallel __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(work_list))
 #define ASSERT_ARGS_gc_gms_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_pmc_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_pool_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_mark_pool_stop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_mark_stack_move __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(from) \
+    , PARROT_ASSERT_ARG(to))
+#define ASSERT_ARGS_gc_gms_mark_stack_push __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stack) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_gms_mark_str_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_mark_str_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_mark_thread __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_gc_gms_marker_pop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(marker))
+#define ASSERT_ARGS_gc_gms_marker_push __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(marker) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_marker_steal __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(thief))
 #define ASSERT_ARGS_gc_gms_pmc_get_youngest_generation \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_pmc_list __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_gms_pmc_needs_early_collection \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -590,6 +844,9 @@ static int gen2flags(int gen);
 #define ASSERT_ARGS_gc_gms_sweep_pools __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_gms_sweep_step __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_unblock_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_unblock_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -626,6 +883,7 @@ Flags can be a combination of these values:
   GC_finish_FLAG
   GC_lazy_FLAG
   GC_trace_stack_FLAG
+  GC_incremental_sweep_FLAG
 
 =cut
 
@@ -715,7 +973,8 @@ Parrot_gc_gms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
 
     interp->gc_sys->get_gc_info                 = gc_gms_get_gc_info;
 
-    if (interp->parent_interpreter && interp->parent_interpreter->gc_sys) {
+    if (interp->parent_interpreter && interp->parent_interpreter->gc_sys
+    && !Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
         /* This is a "child" interpreter. Just reuse parent one */
         self = (MarkSweep_GC*)interp->parent_interpreter->gc_sys->gc_private;
     }
@@ -749,6 +1008,11 @@ Parrot_gc_gms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
         self->gc_threshold = Parrot_sysmem_amount(interp) * nursery_size / 100;
 
         Parrot_gc_str_initialize(interp, &self->string_gc);
+
+        if (args->threads > 1)
+            gc_gms_mark_pool_start(interp, self,
+                args->threads < GMS_MAX_MARK_THREADS
+                    ? args->threads : GMS_MAX_MARK_THREADS);
     }
 
     interp->gc_sys->gc_private = self;
@@ -766,14 +1030,20 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     if (self->gc_mark_block_level)
         return;
 
-    /* Ignore it. Will cleanup in gc_gms_finalize */
-    if (flags & GC_finish_FLAG)
+    /* Destroy objects found dead by the last collection. Will cleanup the
+     * rest in gc_gms_finalize */
+    if (flags & GC_finish_FLAG) {
+        gc_gms_finish_sweep(interp, self);
         return;
+    }
 
     /* Ignore calls from String GC. We know better when to trigger GC */
     if (flags & GC_strings_cb_FLAG)
         return;
 
+    /* Marking needs every object back in its generation list */
+    gc_gms_finish_sweep(interp, self);
+
     /* Block further GC calls */
     ++self->gc_mark_block_level;
     self->work_list = Parrot_pa_new(interp);
@@ -802,7 +1072,9 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     4. Trace root objects. According to "0. Pre-requirements" we will ignore all
     "old" objects. All relevant objects are moved into "work_list".
     */
-    gc_gms_mark_pmc_header(interp, PMCNULL);
+    /* PMCNULL is in the heap of the first interpreter */
+    if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        gc_gms_mark_pmc_header(interp, PMCNULL);
     Parrot_gc_trace_root(interp, NULL, GC_TRACE_FULL);
 
     if (interp->pdb && interp->pdb->debugger)
@@ -831,8 +1103,12 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         - Destroy all dead objects
         - Move live objects into generation max(K+1, N)
         - Paint them white.
+    Old generations are swept while allocating unless the caller wants dead
+    objects destroyed now.
     */
-    gc_gms_sweep_pools(interp, self);
+    gc_gms_sweep_pools(interp, self,
+        (flags & GC_incremental_sweep_FLAG)
+        && !self->num_early_gc_PMCs && !self->gc_sweep_block_level);
     gc_gms_check_sanity(interp);
 
     /* Update some stats */
@@ -1008,14 +1284,15 @@ gc_gms_process_work_list(PARROT_INTERP,
 {
     ASSERT_ARGS(gc_gms_process_work_list)
 
-    POINTER_ARRAY_ITER(work_list,
-        PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+    if (!gc_gms_mark_in_parallel(interp, self, work_list))
+        POINTER_ARRAY_ITER(work_list,
+            PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
 
-        if (PObj_custom_mark_TEST(pmc))
-            VTABLE_mark(interp, pmc);
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
 
-        if (PMC_metadata(pmc))
-            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
 
     gc_gms_print_stats(interp, "Before cleaning work_list");
 
@@ -1034,71 +1311,460 @@ gc_gms_process_work_list(PARROT_INTERP,
 
 /*
 
-=item C<static void gc_gms_sweep_pools(PARROT_INTERP, MarkSweep_GC *self)>
+=item C<static void gc_gms_mark_pool_start(PARROT_INTERP, MarkSweep_GC *self,
+size_t n_threads)>
+
+Starts C<n_threads - 1> helper threads which join the interpreter's thread in
+marking older generations.  The helpers block all signals and sleep between
+collections.  Does nothing on platforms without POSIX threads.
+
+=cut
+
+*/
+static void
+gc_gms_mark_pool_start(PARROT_INTERP, ARGMOD(MarkSweep_GC *self), size_t n_threads)
+{
+    ASSERT_ARGS(gc_gms_mark_pool_start)
+#ifdef GMS_PARALLEL_MARK
+    GMS_Mark_Pool * const pool = mem_allocate_zeroed_typed(GMS_Mark_Pool);
+    sigset_t              all, old;
+    size_t                i;
+
+    pool->markers   = mem_allocate_n_zeroed_typed(n_threads, GMS_Marker);
+    pool->n_markers = n_threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (i = 0; i < n_threads; ++i) {
+        pool->markers[i].pool = pool;
+        pthread_mutex_init(&pool->markers[i].lock, NULL);
+    }
+
+    /* Signals belong to the interpreter's thread, see src/alarm.c */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    for (i = 1; i < n_threads; ++i)
+        if (pthread_create(&pool->markers[i].thread, NULL,
+                gc_gms_mark_thread, &pool->markers[i])) {
+            /* Make do with the threads we got */
+            pool->n_markers = i;
+            break;
+        }
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    self->mark_pool = pool;
+#else
+    UNUSED(self);
+    UNUSED(n_threads);
+#endif
+}
+
+/*
+
+=item C<static void gc_gms_mark_pool_stop(PARROT_INTERP, MarkSweep_GC *self)>
+
+Stops the helper threads and frees the marking stacks.
+
+=cut
+
+*/
+static void
+gc_gms_mark_pool_stop(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_mark_pool_stop)
+#ifdef GMS_PARALLEL_MARK
+    GMS_Mark_Pool * const pool = self->mark_pool;
+    size_t                i;
+
+    if (!pool)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 1; i < pool->n_markers; ++i)
+        pthread_join(pool->markers[i].thread, NULL);
+
+    for (i = 0; i < pool->n_markers; ++i) {
+        mem_sys_free(pool->markers[i].local.items);
+        mem_sys_free(pool->markers[i].shared.items);
+        pthread_mutex_destroy(&pool->markers[i].lock);
+    }
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    mem_sys_free(pool->markers);
+    mem_sys_free(pool);
+
+    self->mark_pool = NULL;
+#else
+    UNUSED(self);
+#endif
+}
+
+/*
+
+=item C<static void * gc_gms_mark_thread(void *arg)>
+
+Main loop of a helper thread: waits for a marking round, takes part in it and
+reports back to the interpreter's thread.
+
+=cut
+
+*/
+PARROT_CAN_RETURN_NULL
+static void *
+gc_gms_mark_thread(ARGIN(void *arg))
+{
+    ASSERT_ARGS(gc_gms_mark_thread)
+    GMS_Marker    * const marker = (GMS_Marker *)arg;
+    GMS_Mark_Pool * const pool   = marker->pool;
+    size_t                round  = 0;
+
+    gms_current_marker = marker;
+
+    GMS_LOCK(&pool->lock);
+    for (;;) {
+        while (pool->round == round && !pool->shutdown)
+            GMS_WAIT(&pool->start, &pool->lock);
+
+        if (pool->shutdown)
+            break;
+
+        round = pool->round;
+        GMS_UNLOCK(&pool->lock);
+
+        gc_gms_mark_drain(pool->interp, marker);
+
+        GMS_LOCK(&pool->lock);
+        if (++pool->finished == pool->n_markers - 1)
+            GMS_SIGNAL(&pool->done);
+    }
+    GMS_UNLOCK(&pool->lock);
+
+    return NULL;
+}
+
+/*
+
+=item C<static int gc_gms_mark_in_parallel(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array *work_list)>
+
+Traces everything reachable from the objects in C<work_list> with all marking
+threads.  Returns 0 without doing anything when there are no helper threads or
+only the nursery is being collected, which traces too little to be worth
+waking them.
+
+=cut
+
+*/
+static int
+gc_gms_mark_in_parallel(PARROT_INTERP,
+        ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array *work_list))
+{
+    ASSERT_ARGS(gc_gms_mark_in_parallel)
+    GMS_Mark_Pool * const pool = self->mark_pool;
+    size_t                i    = 0;
+
+    if (!pool || !self->gen_to_collect)
+        return 0;
+
+    /* Deal the grey objects found so far out to all markers */
+    POINTER_ARRAY_ITER(work_list,
+        PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+        gc_gms_mark_stack_push(&pool->markers[i++ % pool->n_markers].local, pmc););
+
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header_parallel;
+    interp->gc_sys->mark_str_header = gc_gms_mark_str_header_parallel;
+
+    pool->interp       = interp;
+    pool->active       = pool->n_markers;
+    gms_current_marker = &pool->markers[0];
+
+    GMS_LOCK(&pool->lock);
+    pool->finished = 0;
+    ++pool->round;
+    GMS_BROADCAST(&pool->start);
+    GMS_UNLOCK(&pool->lock);
+
+    gc_gms_mark_drain(interp, &pool->markers[0]);
+
+    GMS_LOCK(&pool->lock);
+    while (pool->finished < pool->n_markers - 1)
+        GMS_WAIT(&pool->done, &pool->lock);
+    GMS_UNLOCK(&pool->lock);
+
+    gms_current_marker              = NULL;
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
+    interp->gc_sys->mark_str_header = gc_gms_mark_str_header;
+
+    return 1;
+}
+
+/*
+
+=item C<static void gc_gms_mark_drain(PARROT_INTERP, GMS_Marker *marker)>
+
+Traces grey objects until no marker has any left, stealing from the others
+once C<marker> runs dry.
+
+=cut
+
+*/
+static void
+gc_gms_mark_drain(PARROT_INTERP, ARGMOD(GMS_Marker *marker))
+{
+    ASSERT_ARGS(gc_gms_mark_drain)
+    GMS_Mark_Pool * const pool = marker->pool;
+
+    for (;;) {
+        PMC *pmc;
+
+        while ((pmc = gc_gms_marker_pop(marker)) != NULL) {
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+        }
+
+        /* Our stacks are empty and nobody can refill them but us */
+        GMS_ATOMIC_DEC(pool->active);
+
+        while (!gc_gms_marker_steal(marker)) {
+            if (!pool->active)
+                return;
+            GMS_YIELD();
+        }
+    }
+}
+
+/*
+
+=item C<static void gc_gms_marker_push(GMS_Marker *marker, PMC *pmc)>
+
+Pushes a grey object onto the marker's own stack.  Moves the older half of
+the stack where other markers can steal it once the stack grows large, or
+sooner when some marker is idle.
+
+=item C<static PMC * gc_gms_marker_pop(GMS_Marker *marker)>
+
+Pops the next grey object, taking back the surplus nobody stole when the
+marker's own stack is empty.  Returns NULL when both are empty.
+
+=item C<static int gc_gms_marker_steal(GMS_Marker *thief)>
+
+Takes half of the surplus of the first marker which has any.  The thief
+counts as active while looking, so the others can't finish meanwhile.
+Returns 0 if there was nothing to steal.
+
+=cut
+
+*/
+static void
+gc_gms_marker_push(ARGMOD(GMS_Marker *marker), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_marker_push)
+    GMS_Mark_Pool  * const pool  = marker->pool;
+    GMS_Mark_Stack * const local = &marker->local;
+
+    gc_gms_mark_stack_push(local, pmc);
+
+    if (local->size >= 2 * GMS_MARK_STACK_KEEP
+    || (local->size >= 16 && pool->active < pool->n_markers
+        && !*(volatile size_t *)&marker->shared.size)) {
+        GMS_LOCK(&marker->lock);
+        gc_gms_mark_stack_move(local, &marker->shared, local->size / 2);
+        GMS_UNLOCK(&marker->lock);
+    }
+}
+
+PARROT_CAN_RETURN_NULL
+static PMC *
+gc_gms_marker_pop(ARGMOD(GMS_Marker *marker))
+{
+    ASSERT_ARGS(gc_gms_marker_pop)
+    GMS_Mark_Stack * const local = &marker->local;
+
+    if (!local->size) {
+        GMS_LOCK(&marker->lock);
+        gc_gms_mark_stack_move(&marker->shared, local, marker->shared.size);
+        GMS_UNLOCK(&marker->lock);
+
+        if (!local->size)
+            return NULL;
+    }
+
+    return local->items[--local->size];
+}
+
+static int
+gc_gms_marker_steal(ARGMOD(GMS_Marker *thief))
+{
+    ASSERT_ARGS(gc_gms_marker_steal)
+    GMS_Mark_Pool * const pool = thief->pool;
+    const size_t          me   = thief - pool->markers;
+    size_t                i;
+
+    GMS_ATOMIC_INC(pool->active);
+
+    for (i = 1; i < pool->n_markers; ++i) {
+        GMS_Marker * const victim = &pool->markers[(me + i) % pool->n_markers];
+
+        if (!*(volatile size_t *)&victim->shared.size)
+            continue;
+
+        GMS_LOCK(&victim->lock);
+        gc_gms_mark_stack_move(&victim->shared, &thief->local,
+            (victim->shared.size + 1) / 2);
+        GMS_UNLOCK(&victim->lock);
+
+        if (thief->local.size)
+            return 1;
+    }
+
+    GMS_ATOMIC_DEC(pool->active);
+    return 0;
+}
+
+/*
+
+=item C<static void gc_gms_mark_stack_push(GMS_Mark_Stack *stack, PMC *pmc)>
+
+Pushes C<pmc> onto C<stack>.
+
+=item C<static void gc_gms_mark_stack_move(GMS_Mark_Stack *from, GMS_Mark_Stack
+*to, size_t n)>
+
+Moves the C<n> oldest entries of C<from> on top of C<to>.  The oldest grey
+objects tend to lead to the largest unexplored parts of the graph, which makes
+them the best to hand to another thread.
+
+=cut
+
+*/
+static void
+gc_gms_mark_stack_push(ARGMOD(GMS_Mark_Stack *stack), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_stack_push)
+
+    if (stack->size == stack->alloc) {
+        stack->alloc = stack->alloc ? stack->alloc * 2 : GMS_MARK_STACK_KEEP;
+        mem_realloc_n_typed(stack->items, stack->alloc, PMC *);
+    }
+
+    stack->items[stack->size++] = pmc;
+}
+
+static void
+gc_gms_mark_stack_move(ARGMOD(GMS_Mark_Stack *from), ARGMOD(GMS_Mark_Stack *to), size_t n)
+{
+    ASSERT_ARGS(gc_gms_mark_stack_move)
+
+    if (!n)
+        return;
+
+    if (to->size + n > to->alloc) {
+        to->alloc = to->size + n > 2 * to->alloc ? to->size + n : 2 * to->alloc;
+        mem_realloc_n_typed(to->items, to->alloc, PMC *);
+    }
+
+    memcpy(to->items + to->size, from->items, n * sizeof (PMC *));
+    to->size   += n;
+    from->size -= n;
+    memmove(from->items, from->items + n, from->size * sizeof (PMC *));
+}
+
+/*
+
+=item C<static void gc_gms_sweep_pools(PARROT_INTERP, MarkSweep_GC *self, int
+lazy)>
 
 Sweep generations starting from K:
     - Destroy all dead objects
     - Move live objects into generation max(K+1, N)
     - Paint them white.
 
+With C<lazy> set PMCs of generations 1..K are moved to "unswept" and left for
+C<gc_gms_sweep_step>.  Dead ones with a custom destroy are still destroyed
+right away, oldest generation first, while the strings and younger PMCs they
+may look at still exist.
+
 =cut
 
 */
 static void
-gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self), int lazy)
 {
     ASSERT_ARGS(gc_gms_sweep_pools)
 
     INTVAL i;
 
-    for (i = self->gen_to_collect; i >= 0; i--) {
-        /* Don't move to generation beyond last */
-        const int move_to_old = (i + 1) != MAX_GENERATIONS;
+    /* Survivors of younger generations go into fresh lists */
+    if (lazy && self->gen_to_collect) {
+        for (i = self->gen_to_collect; i > 0; i--) {
+            self->unswept[i] = self->objects[i];
+            self->objects[i] = Parrot_pa_new(interp);
 
-        POINTER_ARRAY_ITER(self->objects[i],
-            pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
-            PMC              * const pmc  = &(item->pmc);
+            POINTER_ARRAY_ITER(self->unswept[i],
+                pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+                PMC              * const pmc  = &(item->pmc);
 
-            PARROT_ASSERT(PObj_constant_TEST(pmc) || (int)POBJ2GEN(pmc) == i);
+                if (PObj_custom_destroy_TEST(pmc)
+                && !PObj_live_TEST(pmc) && !PObj_constant_TEST(pmc)) {
+                    Parrot_pa_remove(interp, self->unswept[i], item->ptr);
+                    gc_gms_free_dead_pmc(interp, self, item);
+                });
+        }
 
-            /* Paint live objects white */
-            if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
-                PObj_live_CLEAR(pmc);
+        self->sweep_gen   = self->gen_to_collect;
+        self->sweep_chunk = 0;
+    }
 
-                if (move_to_old) {
-                    SET_GEN_FLAGS(pmc, i + 1);
+    for (i = self->gen_to_collect; i >= 0; i--) {
+        /* Don't move to generation beyond last */
+        const int move_to_old = (i + 1) != MAX_GENERATIONS;
 
-                    Parrot_pa_remove(interp, self->objects[i], item->ptr);
-                    /* If this was freshly allocated object in C stack - move it to dirty list */
-                    if (PObj_GC_soil_root_TEST(pmc)) {
-                        item->ptr = Parrot_pa_insert(interp, self->dirty_list, item);
-                        PObj_GC_soil_root_CLEAR(pmc);
-                        PObj_GC_on_dirty_list_SET(pmc);
-                    }
-                    else {
-                        item->ptr = Parrot_pa_insert(interp, self->objects[i + 1], item);
-                        gc_gms_seal_object(interp, pmc);
+        if (!self->unswept[i]) {
+            POINTER_ARRAY_ITER(self->objects[i],
+                pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+                PMC              * const pmc  = &(item->pmc);
+
+                PARROT_ASSERT(PObj_constant_TEST(pmc) || (int)POBJ2GEN(pmc) == i);
+
+                /* Paint live objects white */
+                if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
+                    PObj_live_CLEAR(pmc);
+
+                    if (move_to_old) {
+                        SET_GEN_FLAGS(pmc, i + 1);
+
+                        Parrot_pa_remove(interp, self->objects[i], item->ptr);
+                        /* Freshly allocated object in C stack - move it to dirty list */
+                        if (PObj_GC_soil_root_TEST(pmc)) {
+                            item->ptr = Parrot_pa_insert(interp, self->dirty_list, item);
+                            PObj_GC_soil_root_CLEAR(pmc);
+                            PObj_GC_on_dirty_list_SET(pmc);
+                        }
+                        else {
+                            item->ptr = Parrot_pa_insert(interp, self->objects[i + 1], item);
+                            gc_gms_seal_object(interp, pmc);
+                        }
                     }
                 }
-            }
-            else {
-                Parrot_pa_remove(interp, self->objects[i], item->ptr);
-
-                interp->gc_sys->stats.memory_used -= sizeof (PMC);
-
-                /* this is manual inlining of Parrot_pmc_destroy() */
-                if (PObj_custom_destroy_TEST(pmc))
-                    VTABLE_destroy(interp, pmc);
-
-                if (pmc->vtable->attr_size && PMC_data(pmc))
-                    Parrot_gc_free_pmc_attributes(interp, pmc);
-                PMC_data(pmc) = NULL;
-
-                PObj_on_free_list_SET(pmc);
-                PObj_gc_CLEAR(pmc);
+                else {
+                    Parrot_pa_remove(interp, self->objects[i], item->ptr);
+                    gc_gms_free_dead_pmc(interp, self, item);
+                });
 
-                Parrot_gc_pool_free(interp, self->pmc_allocator, ptr);
-            });
+        }
 
         POINTER_ARRAY_ITER(self->strings[i],
             string_alloc_struct * const item = (string_alloc_struct *)ptr;
@@ -1121,6 +1787,8 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
                 if (Buffer_bufstart(str) && !PObj_external_TEST(str))
                     Parrot_gc_str_free_buffer_storage(
                         interp, &self->string_gc, (Parrot_Buffer*)str);
+                else if (STRING_mapped_TEST(str))
+                    Parrot_io_release_mapping(Buffer_bufstart(str));
 
                 interp->gc_sys->stats.memory_used -= sizeof (STRING);
 
@@ -1132,6 +1800,150 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
 }
 
+/*
+
+=item C<static void gc_gms_sweep_step(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweeps one chunk of the oldest "unswept" generation, or releases its list when
+all of it is swept.  Called on allocation while C<self-E<gt>sweep_gen> is set.
+
+=cut
+
+*/
+static void
+gc_gms_sweep_step(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_sweep_step)
+
+    const size_t                 gen  = self->sweep_gen;
+    Parrot_Pointer_Array * const list = self->unswept[gen];
+
+    /* Don't move to generation beyond last */
+    const size_t                 to   = gen + 1 < MAX_GENERATIONS ? gen + 1 : gen;
+
+    /* Destructors can allocate. Don't collect or reenter the sweep then */
+    ++self->gc_mark_block_level;
+
+    if (self->sweep_chunk < list->total_chunks) {
+        Parrot_Pointer_Array_Chunk * const chunk = list->chunks[self->sweep_chunk++];
+        size_t j;
+
+        for (j = 0; j < CELL_PER_CHUNK - chunk->num_free; j++) {
+            pmc_alloc_struct * const item = (pmc_alloc_struct *)chunk->data[j];
+            PMC                     *pmc;
+
+            if ((UINTVAL)item & 1)
+                continue;
+
+            pmc = &(item->pmc);
+            PARROT_ASSERT(PObj_constant_TEST(pmc) || POBJ2GEN(pmc) == gen);
+
+            Parrot_pa_remove(interp, list, item->ptr);
+
+            /* Paint live objects white */
+            if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
+                PObj_live_CLEAR(pmc);
+                SET_GEN_FLAGS(pmc, to);
+                item->ptr = Parrot_pa_insert(interp, self->objects[to], item);
+                gc_gms_seal_object(interp, pmc);
+            }
+            else
+                gc_gms_free_dead_pmc(interp, self, item);
+        }
+    }
+    else {
+        Parrot_pa_destroy(interp, list);
+        self->unswept[gen] = NULL;
+        self->sweep_chunk  = 0;
+        --self->sweep_gen;
+    }
+
+    --self->gc_mark_block_level;
+}
+
+/*
+
+=item C<static void gc_gms_finish_sweep(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweeps whatever the last collection left in "unswept".
+
+=cut
+
+*/
+static void
+gc_gms_finish_sweep(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_finish_sweep)
+
+    while (self->sweep_gen)
+        gc_gms_sweep_step(interp, self);
+}
+
+/*
+
+=item C<static void gc_gms_free_dead_pmc(PARROT_INTERP, MarkSweep_GC *self,
+pmc_alloc_struct *item)>
+
+Destroys a PMC the sweep found dead and returns its memory to the pool.  The
+caller has already removed it from its list.
+
+=cut
+
+*/
+static void
+gc_gms_free_dead_pmc(PARROT_INTERP, ARGMOD(MarkSweep_GC *self),
+        ARGMOD(pmc_alloc_struct *item))
+{
+    ASSERT_ARGS(gc_gms_free_dead_pmc)
+    PMC * const pmc = &(item->pmc);
+
+    interp->gc_sys->stats.memory_used -= sizeof (PMC);
+
+    /* this is manual inlining of Parrot_pmc_destroy() */
+    if (PObj_custom_destroy_TEST(pmc))
+        VTABLE_destroy(interp, pmc);
+
+    if (pmc->vtable->attr_size && PMC_data(pmc))
+        Parrot_gc_free_pmc_attributes(interp, pmc);
+    PMC_data(pmc) = NULL;
+
+    PObj_on_free_list_SET(pmc);
+    PObj_gc_CLEAR(pmc);
+
+    Parrot_gc_pool_free(interp, self->pmc_allocator, item);
+}
+
+/*
+
+=item C<static Parrot_Pointer_Array * gc_gms_pmc_list(PARROT_INTERP,
+MarkSweep_GC *self, PMC *pmc)>
+
+Returns the list holding C<pmc>: "unswept" while the lazy sweep hasn't reached
+it yet, its generation list otherwise.
+
+=cut
+
+*/
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Pointer_Array *
+gc_gms_pmc_list(PARROT_INTERP, ARGIN(MarkSweep_GC *self), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_pmc_list)
+    const size_t                 gen     = POBJ2GEN(pmc);
+    Parrot_Pointer_Array * const unswept = self->unswept[gen];
+
+    /* Outside of GC only unswept objects carry the live flag. Constants
+     * don't, so look them up */
+    if (unswept
+    && (PObj_live_TEST(pmc)
+     || (PObj_constant_TEST(pmc)
+      && Parrot_pa_is_owned(interp, unswept, PMC2PAC(pmc), PMC2PAC(pmc)->ptr))))
+        return unswept;
+
+    return self->objects[gen];
+}
+
 
 /*
 
@@ -1177,7 +1989,8 @@ gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
 
 =item C<static void gc_gms_mark_str_header(PARROT_INTERP, STRING *str)>
 
-Mark String
+Mark String.  Constant strings are never freed, so they aren't marked; some of
+them, like the C<CONST_STRING> table, are shared with other threads.
 
 =cut
 
@@ -1188,9 +2001,54 @@ gc_gms_mark_str_header(PARROT_INTERP, ARGMOD(STRING *str))
 {
     ASSERT_ARGS(gc_gms_mark_str_header)
 
-    PObj_live_SET(str);
+    if (!PObj_constant_TEST(str))
+        PObj_live_SET(str);
+}
+
+
+/*
+
+=item C<static void gc_gms_mark_pmc_header_parallel(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void gc_gms_mark_str_header_parallel(PARROT_INTERP, STRING *str)>
+
+Versions of C<gc_gms_mark_pmc_header> and C<gc_gms_mark_str_header> used
+while marking in parallel.  Several threads may reach an object at once; the
+one which sets its live flag pushes it onto its own stack.  The object stays
+in its generation list.
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_pmc_header_parallel)
+    const MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    PARROT_ASSERT(!PObj_on_free_list_TEST(pmc)
+        || !"Resurrecting of dead objects is not supported");
+
+    if (PObj_live_TEST(pmc)
+    ||  POBJ2GEN(pmc) > self->gen_to_collect
+    ||  PObj_GC_on_dirty_list_TEST(pmc))
+        return;
+
+    if (GMS_ATOMIC_OR(pmc->flags, PObj_live_FLAG) & PObj_live_FLAG)
+        return;
+
+    gc_gms_marker_push(gms_current_marker, pmc);
 }
 
+static void
+gc_gms_mark_str_header_parallel(PARROT_INTERP, ARGMOD(STRING *str))
+{
+    ASSERT_ARGS(gc_gms_mark_str_header_parallel)
+
+    if (!PObj_live_TEST(str) && !PObj_constant_TEST(str))
+        GMS_ATOMIC_OR(str->flags, PObj_live_FLAG);
+}
 
 /*
 
@@ -1333,6 +2191,8 @@ gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
         size_t i;
         for (i = 0; i < MAX_GENERATIONS; i++) {
             ret += Parrot_pa_count_allocated(interp, self->objects[i]);
+            if (self->unswept[i])
+                ret += Parrot_pa_count_allocated(interp, self->unswept[i]);
         }
         return ret;
     }
@@ -1342,6 +2202,8 @@ gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
         size_t i;
         for (i = 0; i < MAX_GENERATIONS; i++) {
             ret += Parrot_pa_count_used(interp, self->objects[i]);
+            if (self->unswept[i])
+                ret += Parrot_pa_count_used(interp, self->unswept[i]);
         }
         return ret;
     }
@@ -1365,11 +2227,14 @@ gc_gms_finalize(PARROT_INTERP)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     size_t        i;
 
+    gc_gms_mark_pool_stop(interp, self);
     Parrot_gc_str_finalize(interp, &self->string_gc);
 
     for (i = 0; i < MAX_GENERATIONS; i++) {
         Parrot_pa_destroy(interp, self->objects[i]);
         Parrot_pa_destroy(interp, self->strings[i]);
+        if (self->unswept[i])
+            Parrot_pa_destroy(interp, self->unswept[i]);
     }
 
     Parrot_gc_pool_destroy(interp, self->pmc_allocator);
@@ -1382,7 +2247,7 @@ gc_gms_finalize(PARROT_INTERP)
 =item C<gc_gms_maybe_mark_and_sweep(PARROT_INTERP)>
 
 Maybe M&S. Depends on total allocated memory, memory allocated since last alloc
-and phase of the Moon.
+and phase of the Moon.  Otherwise sweep a bit of what the last M&S left.
 
 =cut
 
@@ -1392,10 +2257,13 @@ and phase of the Moon.
     do { \
         MarkSweep_GC * const self = (MarkSweep_GC *)(i)->gc_sys->gc_private; \
     \
-        /* Collect every gc_threshold. */ \
-        if (!self->gc_mark_block_level \
-        &&  (i)->gc_sys->stats.mem_used_last_collect > self->gc_threshold) \
-            gc_gms_mark_and_sweep(interp, 0); \
+        if (!self->gc_mark_block_level) { \
+            /* Collect every gc_threshold. */ \
+            if ((i)->gc_sys->stats.mem_used_last_collect > self->gc_threshold) \
+                gc_gms_mark_and_sweep(interp, GC_incremental_sweep_FLAG); \
+            else if (self->sweep_gen && !self->gc_sweep_block_level) \
+                gc_gms_sweep_step((i), self); \
+        } \
     } while (0)
 
 PARROT_MALLOC
@@ -1429,15 +2297,13 @@ gc_gms_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
     if (pmc) {
-        const size_t gen = POBJ2GEN(pmc);
-
         /* We should never free objects from dirty list directly! */
         PARROT_ASSERT(!PObj_GC_on_dirty_list_TEST(pmc));
 
         if (PObj_on_free_list_TEST(pmc))
             return;
 
-        Parrot_pa_remove(interp, self->objects[gen], PMC2PAC(pmc)->ptr);
+        Parrot_pa_remove(interp, gc_gms_pmc_list(interp, self, pmc), PMC2PAC(pmc)->ptr);
         PObj_on_free_list_SET(pmc);
 
         Parrot_pmc_destroy(interp, pmc);
@@ -1554,6 +2420,8 @@ gc_gms_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
         if (Buffer_bufstart(s) && !PObj_external_TEST(s))
             Parrot_gc_str_free_buffer_storage(interp,
                 &self->string_gc, (Parrot_Buffer *)s);
+        else if (STRING_mapped_TEST(s))
+            Parrot_io_release_mapping(Buffer_bufstart(s));
 
         PObj_on_free_list_SET(s);
 
@@ -1931,6 +2799,7 @@ gc_gms_write_barrier(PARROT_INTERP, ARGMOD(PMC *pmc))
     MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     const size_t             gen  = POBJ2GEN(pmc);
     pmc_alloc_struct * const item = PMC2PAC(pmc);
+    Parrot_Pointer_Array    *list;
 
     if (pmc->flags & PObj_GC_on_dirty_list_FLAG)
         return;
@@ -1938,9 +2807,18 @@ gc_gms_write_barrier(PARROT_INTERP, ARGMOD(PMC *pmc))
     if (!gen)
         return;
 
-    Parrot_pa_remove(interp, self->objects[gen], item->ptr);
+    list = gc_gms_pmc_list(interp, self, pmc);
+    Parrot_pa_remove(interp, list, item->ptr);
     item->ptr = Parrot_pa_insert(interp, self->dirty_list, item);
 
+    /* Survived the last collection if it wasn't swept yet.  The sweep won't
+     * get to promote it now, so do it here: parents it already promoted
+     * aren't traced when its current generation is collected */
+    if (list != self->objects[gen] && gen + 1 < MAX_GENERATIONS)
+        SET_GEN_FLAGS(pmc, gen + 1);
+
+    PObj_live_CLEAR(pmc);
+
     pmc->flags |= PObj_GC_on_dirty_list_FLAG;
 
     /* We don't need it anymore */
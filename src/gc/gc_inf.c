@@ -290,8 +290,11 @@ static void
 gc_inf_free_string_header(SHIM_INTERP, ARGFREE(STRING *s))
 {
     ASSERT_ARGS(gc_inf_free_string_header)
-    if (s)
+    if (s) {
+        if (STRING_mapped_TEST(s))
+            Parrot_io_release_mapping(Buffer_bufstart(s));
         free(s);
+    }
 }
 
 PARROT_MALLOC
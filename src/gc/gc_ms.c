@@ -107,6 +107,12 @@ static void gc_ms_finalize_memory_pools(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_ms_finish_sweep(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*mem_pools);
+
 static void gc_ms_free_attributes_from_pool(
     ARGMOD(PMC_Attribute_Pool *pool),
     ARGMOD(void *data))
@@ -293,6 +299,9 @@ static void Parrot_gc_initialize_fixed_size_pools(PARROT_INTERP,
 #define ASSERT_ARGS_gc_ms_finalize_memory_pools __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools))
+#define ASSERT_ARGS_gc_ms_finish_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools))
 #define ASSERT_ARGS_gc_ms_free_attributes_from_pool \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool) \
@@ -528,6 +537,9 @@ gc_ms_destroy_child_interp(ARGMOD(Interp *dest_interp), ARGIN(Interp *source_int
 
     Memory_Pools * const dest_arena   = (Memory_Pools*)dest_interp->gc_sys->gc_private;
     Memory_Pools * const source_arena = (Memory_Pools*)source_interp->gc_sys->gc_private;
+
+    gc_ms_finish_sweep(dest_interp, dest_arena);
+    gc_ms_finish_sweep(source_interp, source_arena);
     Parrot_gc_merge_memory_pools(dest_interp, dest_arena, source_arena);
 }
 
@@ -577,7 +589,9 @@ Parrot_gc_ms_needed(PARROT_INTERP)
 
 =item C<static void gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)>
 
-Runs the stop-the-world mark & sweep (MS) collector.
+Runs the stop-the-world mark & sweep (MS) collector.  When it was run because
+the PMC pool ran out, dead PMCs are swept one arena at a time as more are
+needed.
 
 =cut
 
@@ -593,6 +607,9 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     if (mem_pools->gc_mark_block_level)
         return;
 
+    /* Marking needs the live flags of the last collection cleared */
+    gc_ms_finish_sweep(interp, mem_pools);
+
     if (interp->pdb && interp->pdb->debugger) {
         /* The debugger could have performed a mark. Make sure everything is
            marked dead here, so that when we sweep it all gets collected */
@@ -614,15 +631,23 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
        false means it was a lazy trace. */
     if (gc_ms_trace_active_PMCs(interp, (flags & GC_trace_stack_FLAG)
         ? GC_TRACE_FULL : GC_TRACE_ROOT_ONLY)) {
+        /* We've done the mark, now do the sweep. Pass the sweep callback
+           function to the PMC pool and all the sized pools. When we ran out
+           of PMCs, sweep only as many arenas of them as it takes to get some
+           back and leave the rest to later allocations. PMCs go first so that
+           destructors still find the buffers they point to. */
+        const int lazy = (flags & GC_incremental_sweep_FLAG)
+                      && !mem_pools->num_early_gc_PMCs
+                      && !mem_pools->gc_sweep_block_level;
 
         mem_pools->gc_trace_ptr = NULL;
         mem_pools->gc_mark_ptr  = NULL;
 
-        /* We've done the mark, now do the sweep. Pass the sweep callback
-           function to the PMC pool and all the sized pools. */
-       header_pools_iterate_callback(interp, mem_pools,
-            POOL_BUFFER | POOL_PMC, (void *)&total_free, gc_ms_sweep_cb);
+        if (lazy)
+            Parrot_gc_sweep_pool_lazily(interp, mem_pools, mem_pools->pmc_pool);
 
+        header_pools_iterate_callback(interp, mem_pools,
+            POOL_BUFFER | (lazy ? 0 : POOL_PMC), (void *)&total_free, gc_ms_sweep_cb);
     }
     else {
         ++interp->gc_sys->stats.gc_lazy_mark_runs;
@@ -644,6 +669,25 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
 /*
 
+=item C<static void gc_ms_finish_sweep(PARROT_INTERP, Memory_Pools *mem_pools)>
+
+Sweeps the PMC arenas the last collection left for later allocations.
+
+=cut
+
+*/
+
+static void
+gc_ms_finish_sweep(PARROT_INTERP, ARGMOD(Memory_Pools *mem_pools))
+{
+    ASSERT_ARGS(gc_ms_finish_sweep)
+
+    while (Parrot_gc_sweep_pool_step(interp, mem_pools, mem_pools->pmc_pool))
+        /* nothing */ ;
+}
+
+/*
+
 =item C<void gc_ms_compact_memory_pool(PARROT_INTERP)>
 
 Scan the string pools and compact them. This does not perform a GC mark or
@@ -821,9 +865,19 @@ gc_ms_free_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
                                    ? mem_pools->constant_pmc_pool
                                    : mem_pools->pmc_pool;
 
+    /* Only PMCs in arenas which weren't swept yet are still live. Leave it
+       to the sweep to put these on the free list. */
+    const int unswept = PObj_live_TEST(pmc);
+
     Parrot_pmc_destroy(interp, pmc);
 
     PObj_flags_SETTO((PObj *)pmc, PObj_on_free_list_FLAG);
+
+    if (unswept) {
+        interp->gc_sys->stats.memory_used -= pool->object_size;
+        return;
+    }
+
     pool->add_free_object(interp, mem_pools, pool, (PObj *)pmc);
     ++pool->num_free_objects;
 }
@@ -952,6 +1006,8 @@ gc_ms_free_string_header(PARROT_INTERP, ARGMOD(STRING *s))
     Memory_Pools * const mem_pools = (Memory_Pools *)interp->gc_sys->gc_private;
     if (!PObj_constant_TEST(s)) {
         Fixed_Size_Pool * const pool = mem_pools->string_header_pool;
+        if (STRING_mapped_TEST(s))
+            Parrot_io_release_mapping(Buffer_bufstart(s));
         PObj_flags_SETTO((PObj *)s, PObj_on_free_list_FLAG);
         pool->add_free_object(interp, mem_pools, pool, s);
         ++pool->num_free_objects;
@@ -962,7 +1018,8 @@ gc_ms_free_string_header(PARROT_INTERP, ARGMOD(STRING *s))
 
 =item C<static void gc_ms_mark_str_header(PARROT_INTERP, STRING *obj)>
 
-mark *obj as live
+mark *obj as live.  Constant strings are never swept, so they aren't marked;
+some of them are shared with other threads.
 
 =cut
 
@@ -972,7 +1029,7 @@ static void
 gc_ms_mark_str_header(SHIM_INTERP, ARGMOD_NULLOK(STRING *obj))
 {
     ASSERT_ARGS(gc_ms_mark_str_header)
-    if (obj) {
+    if (obj && !PObj_constant_TEST(obj)) {
         /* mark it live */
         PObj_live_SET(obj);
     }
@@ -1553,16 +1610,30 @@ gc_ms_more_traceable_objects(PARROT_INTERP,
     ASSERT_ARGS(gc_ms_more_traceable_objects)
     Memory_Pools * const mem_pools = (Memory_Pools *)interp->gc_sys->gc_private;
 
-    if (pool->skip == GC_ONE_SKIP)
-        pool->skip = GC_NO_SKIP;
-    else if (pool->skip == GC_NEVER_SKIP
-         || (pool->skip == GC_NO_SKIP
-         &&  Parrot_gc_ms_needed(interp)))
-            Parrot_gc_mark_and_sweep(interp, GC_trace_stack_FLAG);
+    /* Sweep what the last collection left before collecting again */
+    while (!pool->free_list
+    &&      Parrot_gc_sweep_pool_step(interp, mem_pools, pool))
+        /* nothing */ ;
+
+    if (!pool->free_list) {
+        if (pool->skip == GC_ONE_SKIP)
+            pool->skip = GC_NO_SKIP;
+        else if (pool->skip == GC_NEVER_SKIP
+             || (pool->skip == GC_NO_SKIP
+             &&  Parrot_gc_ms_needed(interp)))
+                Parrot_gc_mark_and_sweep(interp,
+                    GC_trace_stack_FLAG | GC_incremental_sweep_FLAG);
+
+        while (!pool->free_list
+        &&      Parrot_gc_sweep_pool_step(interp, mem_pools, pool))
+            /* nothing */ ;
+    }
 
-    /* requires that num_free_objects be updated in Parrot_gc_mark_and_sweep.
-       If gc is disabled, then we must check the free list directly. */
-    if ((!pool->free_list || pool->num_free_objects < pool->replenish_level)
+    /* requires that num_free_objects be updated in Parrot_gc_mark_and_sweep,
+       which it is only once all arenas are swept. If gc is disabled, then we
+       must check the free list directly. */
+    if ((!pool->free_list
+      || (!pool->sweep_arena && pool->num_free_objects < pool->replenish_level))
         && !pool->newfree)
         (*pool->alloc_objects) (interp, mem_pools, pool);
 }
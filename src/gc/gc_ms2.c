@@ -627,7 +627,8 @@ Parrot_gc_ms2_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
 
     interp->gc_sys->get_gc_info             = gc_ms2_get_gc_info;
 
-    if (interp->parent_interpreter && interp->parent_interpreter->gc_sys) {
+    if (interp->parent_interpreter && interp->parent_interpreter->gc_sys
+    && !Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
         /* This is a "child" interpreter. Just reuse parent one */
         self = (MarkSweep_GC*)interp->parent_interpreter->gc_sys->gc_private;
     }
@@ -674,7 +675,8 @@ gc_ms2_finalize(PARROT_INTERP)
 {
     ASSERT_ARGS(gc_ms2_finalize)
 
-    if (!interp->parent_interpreter) {
+    if (!interp->parent_interpreter
+    ||  Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
         MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
         Parrot_gc_str_finalize(interp, &self->string_gc);
@@ -836,6 +838,8 @@ gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
         if (Buffer_bufstart(s) && !PObj_external_TEST(s))
             Parrot_gc_str_free_buffer_storage(interp,
                 &self->string_gc, (Parrot_Buffer *)s);
+        else if (STRING_mapped_TEST(s))
+            Parrot_io_release_mapping(Buffer_bufstart(s));
 
         PObj_on_free_list_SET(s);
 
@@ -944,7 +948,8 @@ gc_ms2_reallocate_buffer_storage(PARROT_INTERP, ARGMOD(Parrot_Buffer *str), size
 
 =item C<static void gc_ms2_mark_str_header(PARROT_INTERP, STRING *s)>
 
-Marks STRING as live.
+Marks STRING as live.  Constant strings are never freed, so they aren't
+marked; some of them are shared with other threads.
 
 =cut
 
@@ -955,7 +960,8 @@ gc_ms2_mark_str_header(SHIM_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(gc_ms2_mark_str_header)
 
-    PObj_live_SET(s);
+    if (!PObj_constant_TEST(s))
+        PObj_live_SET(s);
 }
 
 
@@ -1015,7 +1021,9 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
     }
     else {
         /* Trace "roots" into new_objects */
-        gc_ms2_mark_pmc_header(interp, PMCNULL);
+        /* PMCNULL is in the heap of the first interpreter */
+        if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+            gc_ms2_mark_pmc_header(interp, PMCNULL);
 
         Parrot_gc_trace_root(interp, NULL, GC_TRACE_FULL);
 
@@ -1051,8 +1059,9 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     if (self->gc_mark_block_level)
         return;
 
-    /* avoid global destruction for child interps */
-    if (flags & GC_finish_FLAG && interp->parent_interpreter)
+    /* avoid global destruction for child interps sharing the heap */
+    if (flags & GC_finish_FLAG && interp->parent_interpreter
+    && !Interp_flags_TEST(interp, PARROT_IS_THREAD))
         return;
 
     ++self->gc_mark_block_level;
@@ -1105,7 +1114,8 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
 =item C<void Parrot_gc_maybe_mark_and_sweep(PARROT_INTERP, UINTVAL flags)>
 
-Run a GC if memory used is above threshold.
+Run a GC if memory used is above threshold.  The shared allocators call this
+whichever GC is in use, but only MS2 wants to be run from them.
 
 =cut
 
@@ -1117,6 +1127,9 @@ Parrot_gc_maybe_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     ASSERT_ARGS(Parrot_gc_maybe_mark_and_sweep)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
+    if (interp->gc_sys->sys_type != MS2)
+        return;
+
     if (!self->gc_mark_block_level
     &&   interp->gc_sys->stats.memory_used > self->gc_threshold)
         gc_ms2_mark_and_sweep(interp, flags);
@@ -1230,6 +1243,8 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
             Parrot_pa_remove(interp, list, STR2PAC(obj)->ptr);
             if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
                 Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Parrot_Buffer*)obj);
+            else if (STRING_mapped_TEST(obj))
+                Parrot_io_release_mapping(Buffer_bufstart(obj));
 
             interp->gc_sys->stats.memory_used -= sizeof (STRING);
 
@@ -266,6 +266,7 @@ typedef struct Fixed_Size_Pool {
     size_t end_arena_memory;            /* And the highest one. */
 
     Fixed_Size_Arena *last_Arena;       /* Pointer to most recent arena. */
+    Fixed_Size_Arena *sweep_arena;      /* Next arena to sweep lazily, or NULL. */
     GC_MS_PObj_Wrapper * free_list;     /* List of free object slots, or NULL. */
     size_t num_free_objects;            /* Number of objects on the free list. */
     size_t total_objects;               /* Total objects in the pool. */
@@ -430,6 +431,24 @@ void Parrot_gc_sweep_pool(PARROT_INTERP,
         FUNC_MODIFIES(*mem_pools)
         FUNC_MODIFIES(*pool);
 
+void Parrot_gc_sweep_pool_lazily(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool);
+
+int Parrot_gc_sweep_pool_step(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool);
+
 int Parrot_gc_trace_root(PARROT_INTERP,
     ARGMOD_NULLOK(Memory_Pools *mem_pools),
     Parrot_gc_trace_type trace)
@@ -468,6 +487,14 @@ int Parrot_gc_trace_root(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools) \
     , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_gc_sweep_pool_lazily __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_gc_sweep_pool_step __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_Parrot_gc_trace_root __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -30,6 +30,18 @@ throughout the rest of Parrot.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void destroy_dead_objects(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool),
+    ARGMOD(Fixed_Size_Arena *arena))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*arena);
+
 static void free_buffer(PARROT_INTERP,
     ARGMOD(Memory_Pools *mem_pools),
     Fixed_Size_Pool *pool,
@@ -82,6 +94,24 @@ static Fixed_Size_Pool * new_string_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*mem_pools);
 
+static UINTVAL sweep_arena(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool),
+    ARGMOD(Fixed_Size_Arena *arena),
+    int relink)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*arena);
+
+#define ASSERT_ARGS_destroy_dead_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(arena))
 #define ASSERT_ARGS_free_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools) \
@@ -102,6 +132,11 @@ static Fixed_Size_Pool * new_string_pool(PARROT_INTERP,
 #define ASSERT_ARGS_new_string_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools))
+#define ASSERT_ARGS_sweep_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(arena))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -261,7 +296,8 @@ mark_interp(PARROT_INTERP)
     if (!PMC_IS_NULL(interp->final_exception))
         Parrot_gc_mark_PMC_alive(interp, interp->final_exception);
 
-    if (interp->parent_interpreter)
+    if (interp->parent_interpreter
+    && !Interp_flags_TEST(interp, PARROT_IS_THREAD))
         mark_interp(interp->parent_interpreter);
 
     mark_code_segment(interp);
@@ -316,46 +352,185 @@ Parrot_gc_sweep_pool(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_sweep_pool)
 
-    PObj               *b;
     Fixed_Size_Arena   *cur_arena;
     UINTVAL             total_used  = 0;
+
+    /* Run through all the PObj header pools and mark */
+    for (cur_arena = pool->last_Arena; cur_arena; cur_arena = cur_arena->prev)
+        total_used += sweep_arena(interp, mem_pools, pool, cur_arena, 0);
+
+    pool->num_free_objects = pool->total_objects - total_used;
+}
+
+/*
+
+=item C<void Parrot_gc_sweep_pool_lazily(PARROT_INTERP, Memory_Pools *mem_pools,
+Fixed_Size_Pool *pool)>
+
+Starts sweeping C<pool> one arena at a time with C<Parrot_gc_sweep_pool_step>.
+Only the newest arena, which new objects still come from, is swept right away.
+The free list is built again from the arenas as they get swept, so no object
+is handed out of an arena before the sweep is through with it.
+
+Dead objects with a custom destroy are destroyed right away in every arena.
+Call this before sweeping the buffer pools, which their destructors may still
+look at.
+
+=cut
+
+*/
+
+void
+Parrot_gc_sweep_pool_lazily(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool))
+{
+    ASSERT_ARGS(Parrot_gc_sweep_pool_lazily)
+    Fixed_Size_Arena *arena;
+
+    for (arena = pool->last_Arena; arena; arena = arena->prev)
+        destroy_dead_objects(interp, mem_pools, pool, arena);
+
+    pool->free_list        = NULL;
+    pool->num_free_objects = pool->newfree
+        ? ((char *)pool->newlast - (char *)pool->newfree) / pool->object_size
+        : 0;
+    pool->sweep_arena      = pool->last_Arena;
+
+    Parrot_gc_sweep_pool_step(interp, mem_pools, pool);
+}
+
+/*
+
+=item C<int Parrot_gc_sweep_pool_step(PARROT_INTERP, Memory_Pools *mem_pools,
+Fixed_Size_Pool *pool)>
+
+Sweeps the next arena left by C<Parrot_gc_sweep_pool_lazily>.  Returns 0 if
+there was nothing left to sweep.
+
+=cut
+
+*/
+
+int
+Parrot_gc_sweep_pool_step(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool))
+{
+    ASSERT_ARGS(Parrot_gc_sweep_pool_step)
+    Fixed_Size_Arena * const arena = pool->sweep_arena;
+
+    if (!arena)
+        return 0;
+
+    /* Destructors can allocate. Don't collect before this arena is done */
+    ++mem_pools->gc_mark_block_level;
+
+    pool->sweep_arena       = arena->prev;
+    pool->num_free_objects += arena->used
+                            - sweep_arena(interp, mem_pools, pool, arena, 1);
+
+    --mem_pools->gc_mark_block_level;
+
+    return 1;
+}
+
+/*
+
+=item C<static void destroy_dead_objects(PARROT_INTERP, Memory_Pools *mem_pools,
+Fixed_Size_Pool *pool, Fixed_Size_Arena *arena)>
+
+Frees the dead objects of C<arena> which have a custom destroy.  They are
+marked free but left off the free list; C<sweep_arena> puts them back on it.
+
+=cut
+
+*/
+
+static void
+destroy_dead_objects(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool),
+        ARGMOD(Fixed_Size_Arena *arena))
+{
+    ASSERT_ARGS(destroy_dead_objects)
+
+    PObj               *b           = (PObj *)arena->start_objects;
     const UINTVAL       object_size = pool->object_size;
+    UINTVAL             i;
 
-    const gc_object_fn_type       gc_object       = pool->gc_object;
-    const add_free_object_fn_type add_free_object = pool->add_free_object;
+    for (i = arena->used; i; --i) {
+        if (PObj_custom_destroy_TEST(b)
+        && !PObj_live_TEST(b) && !PObj_on_free_list_TEST(b)) {
+            pool->gc_object(interp, mem_pools, pool, b);
 
-    /* Run through all the PObj header pools and mark */
-    for (cur_arena = pool->last_Arena; cur_arena; cur_arena = cur_arena->prev) {
-        const size_t objects_end = cur_arena->used;
-        UINTVAL      i;
-        b = (PObj *)cur_arena->start_objects;
+            PObj_flags_SETTO(b, PObj_on_free_list_FLAG);
+            interp->gc_sys->stats.memory_used -= object_size;
+        }
 
-        /* loop only while there are objects in the arena */
-        for (i = objects_end; i; --i) {
+        b = (PObj *)((char *)b + object_size);
+    }
+}
 
-            /* if it's on free list, do nothing */
+/*
 
-            if (PObj_live_TEST(b)) {
-                ++total_used;
-                PObj_live_CLEAR(b);
-            }
-            else if (!PObj_on_free_list_TEST(b)) {
-                /* it must be dead */
+=item C<static UINTVAL sweep_arena(PARROT_INTERP, Memory_Pools *mem_pools,
+Fixed_Size_Pool *pool, Fixed_Size_Arena *arena, int relink)>
 
-                if (gc_object)
-                    gc_object(interp, mem_pools, pool, b);
+Frees the dead objects of C<arena> and paints the live ones white.  Constant
+strings count as live.  With C<relink> set objects already free are put back
+on the free list too.
+Returns the number of live objects.
 
-                add_free_object(interp, mem_pools, pool, b);
-            }
-next:
-            b = (PObj *)((char *)b + object_size);
+=cut
+
+*/
+
+static UINTVAL
+sweep_arena(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool),
+        ARGMOD(Fixed_Size_Arena *arena),
+        int relink)
+{
+    ASSERT_ARGS(sweep_arena)
+
+    PObj               *b           = (PObj *)arena->start_objects;
+    UINTVAL             total_used  = 0;
+    const UINTVAL       object_size = pool->object_size;
+    UINTVAL             i;
+
+    const gc_object_fn_type       gc_object       = pool->gc_object;
+    const add_free_object_fn_type add_free_object = pool->add_free_object;
+
+    /* loop only while there are objects in the arena */
+    for (i = arena->used; i; --i) {
+
+        /* constant strings aren't marked, but stay alive */
+        if (PObj_live_TEST(b)
+        || (PObj_constant_TEST(b) && !PObj_is_PMC_TEST(b))) {
+            ++total_used;
+            PObj_live_CLEAR(b);
         }
+        else if (!PObj_on_free_list_TEST(b)) {
+            /* it must be dead */
+
+            if (gc_object)
+                gc_object(interp, mem_pools, pool, b);
+
+            add_free_object(interp, mem_pools, pool, b);
+        }
+        else if (relink) {
+            ((GC_MS_PObj_Wrapper *)b)->next_ptr = pool->free_list;
+            pool->free_list = (GC_MS_PObj_Wrapper *)b;
+        }
+
+        b = (PObj *)((char *)b + object_size);
     }
 
-    pool->num_free_objects = pool->total_objects - total_used;
+    return total_used;
 }
 
-
 /*
 
 =item C<INTVAL contained_in_pool(const Fixed_Size_Pool *pool, const void *ptr)>
@@ -697,6 +872,9 @@ free_buffer(PARROT_INTERP, ARGMOD(Memory_Pools *mem_pools),
 {
     ASSERT_ARGS(free_buffer)
 
+    if (PObj_is_string_TEST(b) && STRING_mapped_TEST(b))
+        Parrot_io_release_mapping(Buffer_bufstart(b));
+
     /* If there is no allocated buffer - bail out */
     if (Buffer_buflen(b) == 0)
         return;
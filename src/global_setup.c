@@ -117,6 +117,14 @@ Parrot_gbl_set_config_hash_interpreter(PARROT_INTERP)
     PMC *config_hash = parrot_config_hash_global;
     if (config_hash == NULL)
         config_hash = Parrot_pmc_new(interp, enum_class_Hash);
+    else if (Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
+        /* The hash lives in another heap, so a thread gets a copy */
+        STRING * const image = Parrot_freeze(interp->parent_interpreter, config_hash);
+
+        config_hash = Parrot_thaw(interp, Parrot_str_new_init(interp,
+                            image->strstart, image->bufused,
+                            Parrot_binary_encoding_ptr, 0));
+    }
     else {
         /* On initialization, we probably set up an empty hash for our first
            interpreter. We should use this branch here to insert some sane
@@ -243,8 +251,9 @@ Parrot_gbl_setup_2(PARROT_INTERP)
 
     create_initial_context(interp);
 
-    /* initialize the ops hash */
-    if (interp->parent_interpreter) {
+    /* initialize the ops hash; a thread may load dynops into its own */
+    if (interp->parent_interpreter
+    && !Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
         interp->op_hash = interp->parent_interpreter->op_hash;
     }
     else {
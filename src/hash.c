@@ -32,6 +32,61 @@ C<< hash->buckets >> bucket store points to this region.
  * else we use system allocator */
 #define SPLIT_POINT  16
 
+/* 64-bit constant from two 32-bit halves, for compilers without long long
+ * literals */
+#define HASH_C64(hi, lo) (((Parrot_UInt8)(hi) << 32) | (Parrot_UInt8)(lo))
+
+#define SIP_ROTL(x, b) (Parrot_UInt8)(((x) << (b)) | ((x) >> (64 - (b))))
+
+#define SIP_ROUND(st)                                                       \
+do {                                                                        \
+    (st)->v0 += (st)->v1; (st)->v1 = SIP_ROTL((st)->v1, 13);                \
+    (st)->v1 ^= (st)->v0; (st)->v0 = SIP_ROTL((st)->v0, 32);                \
+    (st)->v2 += (st)->v3; (st)->v3 = SIP_ROTL((st)->v3, 16);                \
+    (st)->v3 ^= (st)->v2;                                                   \
+    (st)->v0 += (st)->v3; (st)->v3 = SIP_ROTL((st)->v3, 21);                \
+    (st)->v3 ^= (st)->v0;                                                   \
+    (st)->v2 += (st)->v1; (st)->v1 = SIP_ROTL((st)->v1, 17);                \
+    (st)->v1 ^= (st)->v2; (st)->v2 = SIP_ROTL((st)->v2, 32);                \
+} while (0)
+
+/* SipHash-1-3: one round per message word */
+#define SIP_COMPRESS(st, m)                                                 \
+do {                                                                        \
+    const Parrot_UInt8 _m = (m);                                            \
+    (st)->v3 ^= _m;                                                         \
+    SIP_ROUND(st);                                                          \
+    (st)->v0 ^= _m;                                                         \
+} while (0)
+
+/* key the state from the hash seed */
+#define SIP_INIT(st, seed)                                                  \
+do {                                                                        \
+    const Parrot_UInt8 _k0 = (Parrot_UInt8)(seed);                          \
+    const Parrot_UInt8 _k1 = (_k0 ^ HASH_C64(0x9E3779B9UL, 0x7F4A7C15UL))   \
+                           * HASH_C64(0xBF58476DUL, 0x1CE4E5B9UL);          \
+    (st)->v0 = _k0 ^ HASH_C64(0x736f6d65UL, 0x70736575UL);                  \
+    (st)->v1 = _k1 ^ HASH_C64(0x646f7261UL, 0x6e646f6dUL);                  \
+    (st)->v2 = _k0 ^ HASH_C64(0x6c796765UL, 0x6e657261UL);                  \
+    (st)->v3 = _k1 ^ HASH_C64(0x74656462UL, 0x79746573UL);                  \
+} while (0)
+
+/* mix in the last word, holding the length in its top byte */
+#define SIP_FINISH(st, m)                                                   \
+do {                                                                        \
+    SIP_COMPRESS((st), (m));                                                \
+    (st)->v2 ^= 0xff;                                                       \
+    SIP_ROUND(st);                                                          \
+    SIP_ROUND(st);                                                          \
+    SIP_ROUND(st);                                                          \
+} while (0)
+
+/* multiply-shift over a pointer or integer key, see Parrot_hash_pointer */
+#define HASH_POINTER(p, seed)                                               \
+    HASH_FOLD(((Parrot_UInt8)(size_t)(p) ^ (Parrot_UInt8)(seed))            \
+              * HASH_C64(0x9E3779B9UL, 0x7F4A7C15UL))
+#define HASH_FOLD(h) (size_t)((h) ^ ((h) >> 32))
+
 /* HEADERIZER HFILE: include/parrot/hash.h */
 
 /* HEADERIZER BEGIN: static */
@@ -84,6 +139,38 @@ static int hash_compare_string_enc(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PARROT_INLINE
+static HashSlot * hash_find_slot(PARROT_INTERP,
+    ARGIN(const Hash *hash),
+    ARGIN_NULLOK(void *key),
+    size_t hashval)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_INLINE
+static void hash_index_insert(
+    ARGMOD(Hash *hash),
+    size_t hashval,
+    UINTVAL bucket_no)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*hash);
+
+static void hash_index_remove(ARGMOD(Hash *hash), ARGMOD(HashSlot *slot))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*hash)
+        FUNC_MODIFIES(*slot);
+
+static void hash_state_compress_wide(
+    ARGMOD(Parrot_hash_state *st),
+    ARGIN(const UINTVAL *cps),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*st);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 PARROT_INLINE
@@ -153,6 +240,17 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 #define ASSERT_ARGS_hash_compare_string_enc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(search_key) \
     , PARROT_ASSERT_ARG(bucket_key))
+#define ASSERT_ARGS_hash_find_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_hash_index_insert __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_hash_index_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hash) \
+    , PARROT_ASSERT_ARG(slot))
+#define ASSERT_ARGS_hash_state_compress_wide __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(cps))
 #define ASSERT_ARGS_key_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -180,15 +278,137 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 
 /*
 
+=item C<static void hash_state_compress_wide(Parrot_hash_state *st, const
+UINTVAL *cps, UINTVAL n)>
+
+Mixes C<n> codepoints into the hash state when at least one of them does not
+fit in a byte.  Three 21-bit codepoints go into each word, with the top bit set,
+which no word of ASCII codepoints has.
+
+=cut
+
+*/
+
+static void
+hash_state_compress_wide(ARGMOD(Parrot_hash_state *st), ARGIN(const UINTVAL *cps), UINTVAL n)
+{
+    ASSERT_ARGS(hash_state_compress_wide)
+    UINTVAL i;
+
+    for (i = 0; i < n; i += 3) {
+        Parrot_UInt8 m = HASH_C64(0x80000000UL, 0) | (cps[i] & 0x1FFFFF);
+
+        if (i + 1 < n)
+            m |= (Parrot_UInt8)(cps[i + 1] & 0x1FFFFF) << 21;
+        if (i + 2 < n)
+            m |= (Parrot_UInt8)(cps[i + 2] & 0x1FFFFF) << 42;
+
+        SIP_COMPRESS(st, m);
+    }
+}
+
+/*
+
+=item C<void Parrot_hash_state_init(Parrot_hash_state *st, size_t seed)>
+
+Starts hashing a new string with the key derived from C<seed>.  Feed it
+codepoints with C<PARROT_HASH_ADD_CODEPOINT> and get the hash value from
+C<Parrot_hash_state_finish>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_HOT
+void
+Parrot_hash_state_init(ARGOUT(Parrot_hash_state *st), size_t seed)
+{
+    ASSERT_ARGS(Parrot_hash_state_init)
+    SIP_INIT(st, seed);
+    st->len = 0;
+}
+
+/*
+
+=item C<void Parrot_hash_state_block(Parrot_hash_state *st)>
+
+Mixes a full block of eight codepoints into the hash state.  Called by
+C<PARROT_HASH_ADD_CODEPOINT>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_HOT
+void
+Parrot_hash_state_block(ARGMOD(Parrot_hash_state *st))
+{
+    ASSERT_ARGS(Parrot_hash_state_block)
+    const UINTVAL * const b = st->block;
+
+    if ((b[0] | b[1] | b[2] | b[3] | b[4] | b[5] | b[6] | b[7]) < 256)
+        SIP_COMPRESS(st, (Parrot_UInt8)b[0]
+                      | ((Parrot_UInt8)b[1] <<  8) | ((Parrot_UInt8)b[2] << 16)
+                      | ((Parrot_UInt8)b[3] << 24) | ((Parrot_UInt8)b[4] << 32)
+                      | ((Parrot_UInt8)b[5] << 40) | ((Parrot_UInt8)b[6] << 48)
+                      | ((Parrot_UInt8)b[7] << 56));
+    else
+        hash_state_compress_wide(st, b, 8);
+}
+
+/*
+
+=item C<size_t Parrot_hash_state_finish(Parrot_hash_state *st)>
+
+Mixes in the codepoints left over and the length, and returns the hash value.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_HOT
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_hash_state_finish(ARGMOD(Parrot_hash_state *st))
+{
+    ASSERT_ARGS(Parrot_hash_state_finish)
+    const UINTVAL n   = st->len & 7;
+    Parrot_UInt8  m   = (Parrot_UInt8)st->len << 56;
+    UINTVAL       all = 0;
+    UINTVAL       i;
+
+    for (i = 0; i < n; ++i)
+        all |= st->block[i];
+
+    if (all < 256) {
+        for (i = 0; i < n; ++i)
+            m |= (Parrot_UInt8)st->block[i] << (8 * i);
+    }
+    else
+        hash_state_compress_wide(st, st->block, n);
+
+    SIP_FINISH(st, m);
+
+    return (size_t)(st->v0 ^ st->v1 ^ st->v2 ^ st->v3);
+}
+
+/*
+
 =item C<size_t Parrot_hash_buffer(const unsigned char *buf, size_t len, size_t
 hashval)>
 
-Compute the hash of a buffer.
+Compute the hash of a buffer, reading it eight bytes at a time.  The result is
+the same as feeding the bytes one by one to C<PARROT_HASH_ADD_CODEPOINT>, so
+fixed-width 8-bit strings hash like their wider equivalents.
 
 =cut
 
 */
 
+PARROT_EXPORT
 PARROT_HOT
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
@@ -196,45 +416,65 @@ size_t
 Parrot_hash_buffer(ARGIN_NULLOK(const unsigned char *buf), size_t len, size_t hashval)
 {
     ASSERT_ARGS(Parrot_hash_buffer)
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *buf++;
+    Parrot_hash_state st;
+    Parrot_UInt8      m = (Parrot_UInt8)len << 56;
+
+    SIP_INIT(&st, hashval);
+
+    if (len) {
+        const unsigned char * const end = buf + (len & ~(size_t)7);
+
+        for (; buf != end; buf += 8) {
+            Parrot_UInt8 w;
+#if PARROT_BIGENDIAN
+            w = (Parrot_UInt8)buf[0]         | ((Parrot_UInt8)buf[1] <<  8)
+              | ((Parrot_UInt8)buf[2] << 16) | ((Parrot_UInt8)buf[3] << 24)
+              | ((Parrot_UInt8)buf[4] << 32) | ((Parrot_UInt8)buf[5] << 40)
+              | ((Parrot_UInt8)buf[6] << 48) | ((Parrot_UInt8)buf[7] << 56);
+#else
+            memcpy(&w, buf, sizeof (w));
+#endif
+            SIP_COMPRESS(&st, w);
+        }
+
+        switch (len & 7) {
+          case 7: m |= (Parrot_UInt8)buf[6] << 48; /* fall through */
+          case 6: m |= (Parrot_UInt8)buf[5] << 40; /* fall through */
+          case 5: m |= (Parrot_UInt8)buf[4] << 32; /* fall through */
+          case 4: m |= (Parrot_UInt8)buf[3] << 24; /* fall through */
+          case 3: m |= (Parrot_UInt8)buf[2] << 16; /* fall through */
+          case 2: m |= (Parrot_UInt8)buf[1] <<  8; /* fall through */
+          case 1: m |= (Parrot_UInt8)buf[0];       break;
+          default: break;
+        }
     }
-    return hashval;
+
+    SIP_FINISH(&st, m);
+
+    return (size_t)(st.v0 ^ st.v1 ^ st.v2 ^ st.v3);
 }
 
 /*
 
 =item C<size_t Parrot_hash_pointer(const void * const p, size_t hashval)>
 
-A (weak) perfect hash over pointers.
+A multiply-shift hash over pointers.  Multiplying by an odd constant and
+folding the high half back down are both invertible, so this is still a
+perfect hash, but unlike the raw address all the bits of the result depend on
+the pointer, not only the high ones left over by alignment.
 
 =cut
 
 */
 
+PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 size_t
 Parrot_hash_pointer(ARGIN_NULLOK(const void * const p), size_t hashval)
 {
     ASSERT_ARGS(Parrot_hash_pointer)
-    size_t x = (size_t)p;
-    hashval ^= x;
-
-    {
-        unsigned char *c = (unsigned char *)&hashval;
-        unsigned int i, j;
-        for (i = 0; i < sizeof hashval; i++) {
-            /* swap bitsex of every byte */
-            unsigned char tmp = 0;
-            for (j = 0; j < CHAR_BIT; j++)
-                tmp |= (0x1 & c[i] >> j) << (CHAR_BIT - j - 1);
-            c[i] = tmp;
-        }
-    }
-
-    return hashval;
+    return HASH_POINTER(p, hashval);
 }
 
 /*
@@ -301,6 +541,8 @@ hash_compare_string_enc(ARGIN(const void *search_key), ARGIN(const void *bucket_
         return 1;
     if (s1->encoding != s2->encoding)
         return 1;
+    if (STRING_interned_TEST(s1) && STRING_interned_TEST(s2))
+        return 1;
     else
         return memcmp(s1->strstart, s2->strstart, s1->bufused);
 }
@@ -329,13 +571,8 @@ static size_t
 key_hash_cstring(SHIM_INTERP, ARGIN(const void *value), size_t seed)
 {
     ASSERT_ARGS(key_hash_cstring)
-    const unsigned char *p = (const unsigned char *) value;
-    size_t h = seed;
-    while (*p) {
-        h += h << 5;
-        h += *p++;
-    }
-    return h;
+    const char * const p = (const char *)value;
+    return Parrot_hash_buffer((const unsigned char *)p, strlen(p), seed);
 }
 
 
@@ -400,7 +637,7 @@ key_hash(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(void *key))
     if (hash->key_type == Hash_key_type_PMC)
         return VTABLE_hashvalue(interp, (PMC *)key);
 
-    return ((size_t) key) ^ hash->seed;
+    return HASH_POINTER(key, hash->seed);
 
 }
 
@@ -449,6 +686,129 @@ hash_compare(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(void *a),
 
 /*
 
+=item C<static void hash_index_insert(Hash *hash, size_t hashval, UINTVAL
+bucket_no)>
+
+Adds bucket number C<bucket_no> to the index.  Slots are probed linearly from
+the home slot of C<hashval>; an entry further from its home slot than the one
+found in a slot takes that slot over, and the displaced entry moves on.  This
+keeps every probe sequence short and sorted by distance.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+hash_index_insert(ARGMOD(Hash *hash), size_t hashval, UINTVAL bucket_no)
+{
+    ASSERT_ARGS(hash_index_insert)
+    const UINTVAL imask = N_SLOTS(hash->mask + 1) - 1;
+    HashSlot      cur;
+    UINTVAL       pos   = hashval & imask;
+    UINTVAL       dist  = 0;
+
+    cur.hashval = (Parrot_UInt4)hashval;
+    cur.bucket  = (Parrot_UInt4)bucket_no + 1;
+
+    for (;;) {
+        HashSlot * const slot = hash->index + pos;
+        UINTVAL          slot_dist;
+
+        if (!slot->bucket) {
+            *slot = cur;
+            return;
+        }
+
+        slot_dist = (pos - slot->hashval) & imask;
+        if (slot_dist < dist) {
+            const HashSlot tmp = *slot;
+            *slot = cur;
+            cur   = tmp;
+            dist  = slot_dist;
+        }
+
+        pos = (pos + 1) & imask;
+        ++dist;
+    }
+}
+
+/*
+
+=item C<static HashSlot * hash_find_slot(PARROT_INTERP, const Hash *hash, void
+*key, size_t hashval)>
+
+Returns the index slot of C<key>, or NULL if it is not in the hash.  The probe
+stops at the first slot whose entry is closer to its home slot than C<key>
+would be, since Robin Hood insertion would have put C<key> there.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PARROT_INLINE
+static HashSlot *
+hash_find_slot(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(void *key),
+    size_t hashval)
+{
+    ASSERT_ARGS(hash_find_slot)
+    const UINTVAL      imask = N_SLOTS(hash->mask + 1) - 1;
+    const Parrot_UInt4 tag   = (Parrot_UInt4)hashval;
+    UINTVAL            pos   = hashval & imask;
+    UINTVAL            dist  = 0;
+
+    for (;;) {
+        HashSlot * const slot = hash->index + pos;
+
+        if (!slot->bucket || ((pos - slot->hashval) & imask) < dist)
+            return NULL;
+
+        if (slot->hashval == tag
+        &&  hash_compare(interp, hash, key,
+                hash->buckets[slot->bucket - 1].key) == 0)
+            return slot;
+
+        pos = (pos + 1) & imask;
+        ++dist;
+    }
+}
+
+/*
+
+=item C<static void hash_index_remove(Hash *hash, HashSlot *slot)>
+
+Removes C<slot> from the index, shifting the entries after it back by one
+until one is found in its home slot, so no tombstones are needed.
+
+=cut
+
+*/
+
+static void
+hash_index_remove(ARGMOD(Hash *hash), ARGMOD(HashSlot *slot))
+{
+    ASSERT_ARGS(hash_index_remove)
+    const UINTVAL imask = N_SLOTS(hash->mask + 1) - 1;
+    UINTVAL       pos   = slot - hash->index;
+
+    for (;;) {
+        const UINTVAL    next_pos = (pos + 1) & imask;
+        HashSlot * const next     = hash->index + next_pos;
+
+        if (!next->bucket || ((next_pos - next->hashval) & imask) == 0)
+            break;
+
+        hash->index[pos] = *next;
+        pos              = next_pos;
+    }
+
+    hash->index[pos].bucket = 0;
+}
+
+/*
+
 =item C<void Parrot_hash_dump(PARROT_INTERP, const Hash *hash)>
 
 Prints out the hash in human-readable form, at least once someone implements
@@ -794,14 +1154,15 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
 
     hash->mask      = new_size - 1;
     hash->buckets   = new_buckets;
-    hash->index     = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    hash->index     = (HashSlot *)(new_buckets + N_BUCKETS(new_size));
 
     /* add new buckets to free_list
      * lowest bucket is top on free list and will be used first */
 
+    hash->free_list = NULL;
     bucket = hash->buckets + N_BUCKETS(new_size) - 1;
     for (i = 0; i < N_BUCKETS(new_size); ++i, --bucket) {
-        bucket->next    = hash->free_list;
+        bucket->value   = hash->free_list;
         hash->free_list = bucket;
     }
 }
@@ -812,26 +1173,14 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
 
 Expands a hash when necessary.
 
-For a hashtable of size N, we use C<MAXFULL_PERCENT> % of N as the
-number of buckets. This way, as soon as we run out of buckets on the
-free list, we know that it's time to resize the hashtable.
-
-Algorithm for expansion: We exactly double the size of the hashtable.
-Keys are assigned to buckets with the formula
-
-    bucket_index = hash(key) % Parrot_hash_size
-
-When doubling the size of the hashtable, we know that every key is either
-already in the correct bucket, or belongs in the current bucket plus
-C<Parrot_hash_size> (the old C<Parrot_hash_size>). In fact, because the
-hashtable is always a power of two in size, it depends only on the next bit
-in the hash value, after the ones previously used.
+The hash has as many buckets as C<mask + 1>, and twice as many index slots,
+so the index is never more than half full.  As soon as we run out of buckets
+on the free list, we know that it's time to resize the hashtable.
 
-We scan through all the buckets in order, moving the buckets that need to be
-moved. No bucket will be scanned twice, and the cache should be reasonably
-happy because the hashtable accesses will be two parallel sequential scans.
-(Of course, this also mucks with the C<< ->next >> pointers, and they'll be
-all over memory.)
+Algorithm for expansion: We exactly double the number of buckets, copy them
+over in the same order, and rebuild the index from the hash values kept in
+the old slots.  No key is hashed or compared again, and both the bucket copy
+and the walk over the old index are sequential scans.
 
 =cut
 
@@ -841,28 +1190,23 @@ static void
 expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
 {
     ASSERT_ARGS(expand_hash)
-    HashBucket  **new_index,  **index;
+    HashSlot     *old_index  = hash->index;
     HashBucket   *new_buckets, *bucket;
 
     void *        new_mem;
     void * const  old_mem    = hash->buckets;
     const UINTVAL old_size   = hash->mask + 1;
     const UINTVAL new_size   = old_size  << 1; /* Double. Right-shift is 2x */
-    const UINTVAL new_mask   = new_size   - 1;
-    size_t        offset, i;
+    size_t        i;
 
     /*
-       allocate some less buckets
-       e.g. 3 buckets, 4 pointers:
-
-         +---+---+---+-+-+-+-+
-         | --> buckets |     |
-         +---+---+---+-+-+-+-+
-         ^             ^
-         | old_mem     | hash->index
+         +---+---+---+---+-+-+-+-+-+-+-+-+
+         |    buckets    |     index     |
+         +---+---+---+---+-+-+-+-+-+-+-+-+
+         ^               ^
+         | mem           | hash->index
     */
 
-    /* resize mem */
     if (new_size > SPLIT_POINT)
         new_mem  = Parrot_gc_allocate_memory_chunk(
                         interp, HASH_ALLOC_SIZE(new_size));
@@ -870,87 +1214,38 @@ expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
         new_mem  = Parrot_gc_allocate_fixed_size_storage(
                         interp, HASH_ALLOC_SIZE(new_size));
 
-    offset = (char *)new_mem - (char *)old_mem;
+    new_buckets = (HashBucket *)new_mem;
 
-    new_buckets = (HashBucket *)  new_mem;
-    new_index   = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
-
-    /* copy buckets and index */
+    /* copy buckets, clear the rest of the buckets and the new index */
     mem_sys_memcopy(new_buckets, hash->buckets,
             N_BUCKETS(old_size) * sizeof (HashBucket));
-    mem_sys_memcopy(new_index, hash->index, old_size * sizeof (HashBucket *));
-
-    /* free */
-    if (old_size > SPLIT_POINT)
-        Parrot_gc_free_memory_chunk(interp, old_mem);
-    else
-        Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(old_size), old_mem);
-
-
-    /* clear second half of the buckets, freed by old the index */
     memset(new_buckets + N_BUCKETS(old_size), 0,
-            sizeof (HashBucket) * old_size);
-
-    /* clear second half of the index */
-    memset(new_index + (old_size), 0, sizeof (HashBucket *) * old_size);
-
-
-
-    /*
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         |  buckets  | old_index |  new_index    |
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         ^                       ^
-         | new_mem               | hash->index
-    */
+            HASH_ALLOC_SIZE(new_size) - N_BUCKETS(old_size) * sizeof (HashBucket));
 
     /* update hash data */
-    hash->index     = new_index;
     hash->buckets   = new_buckets;
-    hash->mask      = new_mask;
-
-    /* reloc pointers and recalc bucket indices */
-    for (i = 0; i < old_size; ++i) {
-        index = new_index + i;
-
-        while (*index != NULL) {
-            size_t new_loc;
-            size_t hashval;
-
-            bucket = (HashBucket *)((char *)*index + offset);
-
-            /* rehash the bucket */
-            if (hash->key_type == Hash_key_type_STRING
-            ||  hash->key_type == Hash_key_type_STRING_enc) {
-                STRING *s = (STRING *)bucket->key;
-                hashval   = s->hashval;
-            }
-            else {
-                hashval = key_hash(interp, hash, bucket->key);
-            }
+    hash->index     = (HashSlot *)(new_buckets + N_BUCKETS(new_size));
+    hash->mask      = new_size - 1;
 
-            new_loc = hashval & new_mask;
+    /* reinsert the entries; the stored hash values cover the new mask */
+    for (i = 0; i < N_SLOTS(old_size); ++i)
+        if (old_index[i].bucket)
+            hash_index_insert(hash, old_index[i].hashval, old_index[i].bucket - 1);
 
-            if (i != new_loc) {
-                *index              = bucket->next;
-                bucket->next        = new_index[new_loc];
-                new_index[new_loc]  = bucket;
-            }
-            else {
-                *index = bucket;
-                index  = &bucket->next;
-            }
-        }
-    }
+    /* free */
+    if (old_size > SPLIT_POINT)
+        Parrot_gc_free_memory_chunk(interp, old_mem);
+    else
+        Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(old_size), old_mem);
 
     /* add new buckets to free_list
      * lowest bucket is top on free list and will be used first */
     bucket = new_buckets + N_BUCKETS(old_size);
     for (i = N_BUCKETS(old_size)-1 ; i > 0; --i, ++bucket) {
-        bucket->next = bucket + 1;
+        bucket->value = bucket + 1;
     }
 
-    bucket->next = NULL;
+    bucket->value   = NULL;
     hash->free_list = new_buckets + N_BUCKETS(old_size);
 }
 
@@ -1237,19 +1532,11 @@ Parrot_hash_get_bucket(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(cons
     }
     else {
         /* The const casts are needed for PMC keys */
-        const size_t hashval = key_hash(interp, hash,
-                                    PARROT_const_cast(void *, key));
-        HashBucket  *bucket  = hash->index[hashval & hash->mask];
-
-        while (bucket) {
-            if (hash_compare(interp, hash,
-                    PARROT_const_cast(void *, key),
-                    bucket->key) == 0)
-                break;
-            bucket = bucket->next;
-        }
+        void * const          k       = PARROT_const_cast(void *, key);
+        const size_t          hashval = key_hash(interp, hash, k);
+        const HashSlot * const slot   = hash_find_slot(interp, hash, k, hashval);
 
-        return bucket;
+        return slot ? hash->buckets + slot->bucket - 1 : NULL;
     }
 }
 
@@ -1331,26 +1618,38 @@ parrot_hash_get_bucket_string(PARROT_INTERP, ARGIN(const Hash *hash),
         ARGIN(const STRING *s), UINTVAL hashval)
 {
     ASSERT_ARGS(parrot_hash_get_bucket_string)
-    HashBucket *bucket = hash->index[hashval & hash->mask];
-
-    while (bucket) {
-        const STRING *s2 = (const STRING *)bucket->key;
-        if (s == s2)
-            break;
-
-        /* manually inline part of string_equal  */
-        if (hashval == s2->hashval) {
-            if (s->encoding == s2->encoding) {
-                if ((STRING_byte_length(s) == STRING_byte_length(s2))
-                && (memcmp(s->strstart, s2->strstart, STRING_byte_length(s)) == 0))
-                    break;
-            } else if (STRING_equal(interp, s, s2))
-                    break;
+    const UINTVAL      imask = N_SLOTS(hash->mask + 1) - 1;
+    const Parrot_UInt4 tag   = (Parrot_UInt4)hashval;
+    UINTVAL            pos   = hashval & imask;
+    UINTVAL            dist  = 0;
+
+    for (;;) {
+        const HashSlot * const slot = hash->index + pos;
+
+        if (!slot->bucket || ((pos - slot->hashval) & imask) < dist)
+            return NULL;
+
+        if (slot->hashval == tag) {
+            HashBucket * const bucket = hash->buckets + slot->bucket - 1;
+            const STRING      *s2     = (const STRING *)bucket->key;
+
+            if (s == s2)
+                return bucket;
+
+            /* manually inline part of string_equal  */
+            if (hashval == s2->hashval) {
+                if (s->encoding == s2->encoding) {
+                    if ((STRING_byte_length(s) == STRING_byte_length(s2))
+                    && (memcmp(s->strstart, s2->strstart, STRING_byte_length(s)) == 0))
+                        return bucket;
+                } else if (STRING_equal(interp, s, s2))
+                        return bucket;
+            }
         }
-        bucket = bucket->next;
-    }
 
-    return bucket;
+        pos = (pos + 1) & imask;
+        ++dist;
+    }
 }
 
 
@@ -1390,11 +1689,10 @@ parrot_hash_store_value_in_bucket(PARROT_INTERP, ARGMOD(Hash *hash),
 
         /* Add the value to the new bucket, increasing the count of elements */
         ++hash->entries;
-        hash->free_list                   = bucket->next;
-        bucket->key                       = key;
-        bucket->value                     = value;
-        bucket->next                      = hash->index[hashval & hash->mask];
-        hash->index[hashval & hash->mask] = bucket;
+        hash->free_list = (HashBucket *)bucket->value;
+        bucket->key     = key;
+        bucket->value   = value;
+        hash_index_insert(hash, hashval, bucket - hash->buckets);
     }
 }
 
@@ -1432,14 +1730,13 @@ Parrot_hash_put(PARROT_INTERP, ARGMOD(Hash *hash),
             bucket  = parrot_hash_get_bucket_string(interp, hash, s, hashval);
         }
         else {
+            const HashSlot *slot;
+
             hashval = key_hash(interp, hash, key);
-            bucket  = hash->index[hashval & hash->mask];
+            slot    = hash_find_slot(interp, hash, key, hashval);
 
-            while (bucket) {
-                if (hash_compare(interp, hash, key, bucket->key) == 0)
-                    break;
-                bucket = bucket->next;
-            }
+            if (slot)
+                bucket = hash->buckets + slot->bucket - 1;
         }
     }
 
@@ -1465,19 +1762,16 @@ void
 Parrot_hash_delete(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN_NULLOK(void *key))
 {
     ASSERT_ARGS(Parrot_hash_delete)
-    const UINTVAL hashval = key_hash(interp, hash, key) & hash->mask;
+    const size_t hashval = key_hash(interp, hash, key);
     if (hash->buckets){
-        HashBucket   **prev   = &hash->index[hashval];
-        for (; *prev; prev = &(*prev)->next) {
-            HashBucket * const current = *prev;
-            if (hash_compare(interp, hash, key, current->key) == 0) {
-                *prev = current->next;
-                --hash->entries;
-                current->next    = hash->free_list;
-                current->key     = NULL;
-                hash->free_list = current;
-                return;
-            }
+        HashSlot * const slot = hash_find_slot(interp, hash, key, hashval);
+        if (slot) {
+            HashBucket * const current = hash->buckets + slot->bucket - 1;
+            hash_index_remove(hash, slot);
+            --hash->entries;
+            current->value  = hash->free_list;
+            current->key    = NULL;
+            hash->free_list = current;
         }
     }
 }
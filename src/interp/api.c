@@ -132,6 +132,12 @@ flags)>
 
 Create the Parrot interpreter. Allocate memory and clear the registers.
 
+A child interpreter shares its parent's heap, unless C<flags> has
+C<PARROT_IS_THREAD>: a thread gets a heap of its own so that it can run on
+another OS thread, and shares only immutable data such as the constant
+strings with its parent.  It has to be created and destroyed on the parent's
+thread, and the thread running it must set its stack top first.
+
 =cut
 
 */
@@ -269,7 +275,6 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
 
     /* Set up MMD; MMD cache for builtins. */
     interp->op_mmd_cache = Parrot_mmd_cache_create(interp);
-    Parrot_pmc_gc_register(interp, interp->op_mmd_cache);
 
     Parrot_gbl_init_world_once(interp);
 
@@ -451,7 +456,9 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     ||    Interp_flags_TEST(interp, PARROT_DESTROY_FLAG)))
         return;
 
-    if (interp->parent_interpreter)
+    /* a thread's objects die with its heap */
+    if (interp->parent_interpreter
+    && !Interp_flags_TEST(interp, PARROT_IS_THREAD))
         Parrot_gc_destroy_child_interp(interp->parent_interpreter, interp);
 
     Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
@@ -461,6 +468,9 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     /* cache structure */
     destroy_object_cache(interp);
 
+    Parrot_mmd_cache_destroy(interp, interp->op_mmd_cache);
+    interp->op_mmd_cache = NULL;
+
     if (interp->evc_func_table) {
         mem_gc_free(interp, interp->evc_func_table);
         interp->evc_func_table      = NULL;
@@ -470,7 +480,9 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     /* strings, encodings - only once */
     Parrot_str_finish(interp);
 
-    PARROT_CORE_OPLIB_INIT(interp, 0);
+    /* other threads may still be looking up core ops */
+    if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        PARROT_CORE_OPLIB_INIT(interp, 0);
 
     if (!interp->parent_interpreter) {
         /* get rid of ops */
@@ -487,6 +499,9 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     }
 
     else {
+        if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+            Parrot_hash_destroy(interp, interp->op_hash);
+
         Parrot_vtbl_free_vtables(interp);
 
         /* Finalize GC */
@@ -872,6 +887,7 @@ Parrot_interp_info_p(PARROT_INTERP, INTVAL what)
         break;
       case CURRENT_CONT:
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        Parrot_pcc_capture_contexts(interp);
         break;
       case CURRENT_OBJECT:
         result = Parrot_pcc_get_object(interp, CURRENT_CONTEXT(interp));
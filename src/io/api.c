@@ -62,7 +62,8 @@ static const STR_VTABLE * get_encoding(PARROT_INTERP, ARGIN(PMC *pmc))
 *mode_str)>
 
 Parses a Parrot string for file open mode flags (C<r> for read, C<w> for write,
-C<a> for append, and C<p> for pipe) and returns the combined generic bit flags.
+C<a> for append, C<p> for pipe, and C<m> to read a file through a memory map)
+and returns the combined generic bit flags.
 
 =cut
 
@@ -102,6 +103,9 @@ Parrot_io_parse_open_flags(PARROT_INTERP, ARGIN(const STRING *mode_str))
           case 'p':
             flags |= PIO_F_PIPE;
             break;
+          case 'm':
+            flags |= PIO_F_MMAP;
+            break;
           default:
             break;
         }
@@ -228,7 +232,11 @@ Parrot_io_open_handle(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(STRING *path), ARGIN
         SETATTR_FileHandle_filename(interp, filehandle, path);
         SETATTR_FileHandle_mode(interp, filehandle, mode);
 
-        Parrot_io_setbuf(interp, filehandle, PIO_UNBOUND);
+        /* Map files only read from; fall back to a buffer when that fails */
+        if (!(flags & PIO_F_MMAP)
+        ||   (flags & (PIO_F_PIPE | PIO_F_WRITE))
+        ||   !Parrot_io_map_buffer(interp, filehandle))
+            Parrot_io_setbuf(interp, filehandle, PIO_UNBOUND);
     }
     else
         Parrot_pcc_invoke_method_from_c_args(interp, filehandle, CONST_STRING(interp, "open"), "SS->P", path, mode, &filehandle);
@@ -325,6 +333,8 @@ string data, as it may be wanted later (for capturing the results).
 If it is a C<FileHandle> call the C<close> method on the
 filehandle-PMC object.
 
+A task parked waiting on a C<FileHandle> or C<Socket> is woken up first.
+
 =cut
 
 */
@@ -340,6 +350,7 @@ Parrot_io_close_handle(PARROT_INTERP, ARGMOD(PMC *pmc))
         return -1;
 
     if (pmc->vtable->base_type == enum_class_FileHandle) {
+        Parrot_cx_wake_io(interp, Parrot_io_get_os_handle(interp, pmc));
         result = Parrot_io_close_filehandle(interp, pmc);
         SETATTR_FileHandle_flags(interp, pmc, 0);
     }
@@ -348,8 +359,10 @@ Parrot_io_close_handle(PARROT_INTERP, ARGMOD(PMC *pmc))
         if (PARROT_SOCKET(pmc)) {
             Parrot_Socket_attributes *data_struct = PARROT_SOCKET(pmc);
 
-            if (data_struct->os_handle != PIO_INVALID_HANDLE)
+            if (data_struct->os_handle != PIO_INVALID_HANDLE) {
+                Parrot_cx_wake_io(interp, data_struct->os_handle);
                 result = Parrot_io_close_socket(interp, data_struct->os_handle);
+            }
             data_struct->os_handle = PIO_INVALID_HANDLE;
         }
     }
@@ -492,6 +505,9 @@ Parrot_io_reads(PARROT_INTERP, ARGMOD(PMC *pmc), size_t length)
             length = (length + encoding->bytes_per_unit - 1)
                    & ~(encoding->bytes_per_unit - 1);
 
+        if (Parrot_io_get_buffer_flags(interp, pmc) & PIO_BF_MMAP)
+            return Parrot_io_reads_mapped(interp, pmc, length, encoding);
+
         /* Allocate 3 bytes more for partial multi-byte characters */
         result           = Parrot_str_new_noinit(interp, length + 3);
         result->bufused  = length;
@@ -1069,6 +1085,46 @@ Parrot_io_is_async(PARROT_INTERP, ARGMOD(PMC *pmc))
 
 /*
 
+=item C<INTVAL Parrot_io_would_block(PARROT_INTERP, PMC *pmc, INTVAL which)>
+
+Returns a boolean value indicating whether reading from (C<PIO_POLL_READ>) or
+writing to (C<PIO_POLL_WRITE>) the FileHandle or Socket C<*pmc> right now
+would have to wait for the operating system.  Data left in a FileHandle's
+read buffer can be read without waiting.  Closed handles and other kinds of
+handles never block here, so that the operation itself reports the problem.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_io_would_block(PARROT_INTERP, ARGMOD(PMC *pmc), INTVAL which)
+{
+    ASSERT_ARGS(Parrot_io_would_block)
+
+    if (pmc->vtable->base_type == enum_class_Socket) {
+        if (Parrot_io_socket_is_closed(interp, pmc))
+            return 0;
+    }
+    else if (pmc->vtable->base_type == enum_class_FileHandle) {
+        if (Parrot_io_is_closed_filehandle(interp, pmc))
+            return 0;
+
+        if ((which & PIO_POLL_READ)
+        &&  (Parrot_io_get_buffer_flags(interp, pmc) & PIO_BF_READBUF)
+        &&  Parrot_io_get_buffer_next(interp, pmc) < Parrot_io_get_buffer_end(interp, pmc))
+            return 0;
+    }
+    else
+        return 0;
+
+    return !Parrot_io_reactor_ready(interp, Parrot_io_get_os_handle(interp, pmc), which);
+}
+
+/*
+
 =back
 
 =head2 C<Parrot_io_STD*> Functions
@@ -21,15 +21,69 @@ This file implements a collection of utility functions for I/O buffering.
 #include "io_private.h"
 #include "pmc/pmc_handle.h"
 
+/* Strings may be copied and freed on several threads */
+#if defined(PARROT_HAS_THREADS) && defined(__GNUC__)
+#  define IO_MAPPING_INC(v) __sync_add_and_fetch(&(v), 1)
+#  define IO_MAPPING_DEC(v) __sync_sub_and_fetch(&(v), 1)
+#else
+#  define IO_MAPPING_INC(v) (++(v))
+#  define IO_MAPPING_DEC(v) (--(v))
+#endif
+
+#if defined(PARROT_HAS_HEADER_SYSMMAN) && !defined(MAP_ANON)
+#  define MAP_ANON MAP_ANONYMOUS
+#endif
+
 /* HEADERIZER HFILE: include/parrot/io.h */
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
-static INTVAL io_is_end_of_line(ARGIN(const char *c))
-        __attribute__nonnull__(1);
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const char * io_mapped_next(PARROT_INTERP,
+    ARGIN(PMC *filehandle),
+    ARGOUT(size_t *avail))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*avail);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * io_mapped_string(PARROT_INTERP,
+    ARGIN(PMC *filehandle),
+    ARGIN(const char *start),
+    size_t bytes,
+    INTVAL chars,
+    ARGIN(const STR_VTABLE *encoding))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(6);
 
-#define ASSERT_ARGS_io_is_end_of_line __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(c))
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * io_readline_mapped(PARROT_INTERP,
+    ARGMOD(PMC *filehandle),
+    ARGIN(const STR_VTABLE *encoding))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*filehandle);
+
+#define ASSERT_ARGS_io_mapped_next __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle) \
+    , PARROT_ASSERT_ARG(avail))
+#define ASSERT_ARGS_io_mapped_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle) \
+    , PARROT_ASSERT_ARG(start) \
+    , PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_io_readline_mapped __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle) \
+    , PARROT_ASSERT_ARG(encoding))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -77,6 +131,10 @@ Parrot_io_setbuf(PARROT_INTERP, ARGMOD(PMC *filehandle), size_t bufsize)
     unsigned char *buffer_next  = Parrot_io_get_buffer_next(interp, filehandle);
     size_t         buffer_size;
 
+    /* A mapped file is its own buffer */
+    if (buffer_flags & PIO_BF_MMAP)
+        return;
+
     /* If there is already a buffer, make sure we flush before modifying it. */
     if (buffer_start)
         Parrot_io_flush_buffer(interp, filehandle);
@@ -160,6 +218,143 @@ Parrot_io_setlinebuf(PARROT_INTERP, ARGMOD(PMC *filehandle))
 
 /*
 
+=item C<INTVAL Parrot_io_map_buffer(PARROT_INTERP, PMC *filehandle)>
+
+Maps the whole file open in C<filehandle> into memory and makes the mapping
+its buffer, so that reads from the handle return strings which point into
+the mapping instead of copies.  The mapping is never written to.  It stays
+until the handle is closed and the last of those strings is freed, see
+C<Parrot_io_release_mapping>.  Returns false if the file can't be mapped,
+e.g. when it is empty or isn't a regular file.
+
+The file must not be truncated while it is mapped.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_map_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle))
+{
+    ASSERT_ARGS(Parrot_io_map_buffer)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    const PIOHANDLE  os_handle = Parrot_io_get_os_handle(interp, filehandle);
+    const PIOOFF_T   size      = PIO_SEEK(interp, os_handle, 0, SEEK_END);
+    const size_t     page      = (size_t)sysconf(_SC_PAGESIZE);
+    ParrotIOMapping *mapping;
+    char            *region;
+    void            *start;
+
+    PIO_SEEK(interp, os_handle, 0, SEEK_SET);
+
+    if (size <= 0 || (PIOOFF_T)(size_t)size != size
+    ||  (size_t)size > (size_t)-1 - page)
+        return 0;
+
+    /* Reserve a page for the header in front of the file, then map the file
+     * over the rest of the reservation */
+    region = (char *)mmap(NULL, page + (size_t)size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANON, -1, 0);
+
+    if (region == (char *)MAP_FAILED)
+        return 0;
+
+    start = mmap(region + page, (size_t)size, PROT_READ, MAP_PRIVATE | MAP_FIXED,
+            os_handle, 0);
+
+    if (start == MAP_FAILED) {
+        munmap(region, page + (size_t)size);
+        return 0;
+    }
+
+#  ifdef MADV_SEQUENTIAL
+    madvise(start, (size_t)size, MADV_SEQUENTIAL);
+#  endif
+
+    /* The handle is the first user */
+    mapping         = (ParrotIOMapping *)start - 1;
+    mapping->offset = page;
+    mapping->size   = (size_t)size;
+    mapping->users  = 1;
+
+    Parrot_io_set_buffer_start(interp, filehandle, (unsigned char *)start);
+    Parrot_io_set_buffer_next(interp, filehandle, (unsigned char *)start);
+    Parrot_io_set_buffer_end(interp, filehandle, (unsigned char *)start + size);
+    Parrot_io_set_buffer_size(interp, filehandle, (size_t)size);
+    Parrot_io_set_buffer_flags(interp, filehandle, PIO_BF_MMAP);
+    Parrot_io_set_file_position(interp, filehandle, 0);
+    Parrot_io_set_flags(interp, filehandle,
+            (Parrot_io_get_flags(interp, filehandle) & ~PIO_F_LINEBUF) | PIO_F_BLKBUF);
+
+    return 1;
+#else
+    UNUSED(interp);
+    UNUSED(filehandle);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<void Parrot_io_retain_mapping(const void *start)>
+
+Adds a user to the file mapped at C<start>, the C<Buffer_bufstart> of a string
+with C<STRING_mapped_FLAG> set.  Called for every new string which points
+into the mapping, including copies.
+
+=cut
+
+*/
+
+void
+Parrot_io_retain_mapping(ARGIN(const void *start))
+{
+    ASSERT_ARGS(Parrot_io_retain_mapping)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    DECL_CONST_CAST;
+    ParrotIOMapping * const mapping =
+        (ParrotIOMapping *)PARROT_const_cast(void *, start) - 1;
+
+    IO_MAPPING_INC(mapping->users);
+#else
+    UNUSED(start);
+#endif
+}
+
+/*
+
+=item C<void Parrot_io_release_mapping(const void *start)>
+
+Drops a user of the file mapped at C<start>, and unmaps the file if it was
+the last one.  The handle calls this when it is closed, and the GC when it
+frees a string with C<STRING_mapped_FLAG> set.
+
+Strings still alive when their interpreter is destroyed aren't freed one by
+one, so their file stays mapped until the process exits.
+
+=cut
+
+*/
+
+void
+Parrot_io_release_mapping(ARGIN(const void *start))
+{
+    ASSERT_ARGS(Parrot_io_release_mapping)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    DECL_CONST_CAST;
+    ParrotIOMapping * const mapping =
+        (ParrotIOMapping *)PARROT_const_cast(void *, start) - 1;
+
+    if (IO_MAPPING_DEC(mapping->users) == 0)
+        munmap((char *)PARROT_const_cast(void *, start) - mapping->offset,
+                mapping->offset + mapping->size);
+#else
+    UNUSED(start);
+#endif
+}
+
+/*
+
 =item C<INTVAL Parrot_io_flush_buffer(PARROT_INTERP, PMC *filehandle)>
 
 Flush the I/O buffer for a given filehandle object.
@@ -278,6 +473,21 @@ Parrot_io_read_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle), ARGOUT(char *dest)
     INTVAL         buffer_flags = Parrot_io_get_buffer_flags(interp, filehandle);
     PIOOFF_T       file_pos     = Parrot_io_get_file_position(interp, filehandle);
 
+    if (buffer_flags & PIO_BF_MMAP) {
+        const char * const next = io_mapped_next(interp, filehandle, &current);
+
+        if (current == 0)
+            Parrot_io_set_flags(interp, filehandle,
+                    Parrot_io_get_flags(interp, filehandle) | PIO_F_EOF);
+        else if (current > len)
+            current = len;
+
+        memcpy(dest, next, current);
+        Parrot_io_set_file_position(interp, filehandle, file_pos + current);
+
+        return current;
+    }
+
     /* write buffer flush */
     if (buffer_flags & PIO_BF_WRITEBUF) {
         Parrot_io_flush_buffer(interp, filehandle);
@@ -385,6 +595,13 @@ Parrot_io_peek_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle))
     unsigned char *buffer_next;
     INTVAL         buffer_flags = Parrot_io_get_buffer_flags(interp, filehandle);
 
+    if (buffer_flags & PIO_BF_MMAP) {
+        size_t avail;
+        const char * const next = io_mapped_next(interp, filehandle, &avail);
+
+        return avail ? (unsigned char)*next : -1;
+    }
+
     /* write buffer flush */
     if (buffer_flags & PIO_BF_WRITEBUF) {
         Parrot_io_flush_buffer(interp, filehandle);
@@ -439,6 +656,9 @@ Parrot_io_readline_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle),
     STRING        *s;
     INTVAL         rs;
 
+    if (buffer_flags & PIO_BF_MMAP)
+        return io_readline_mapped(interp, filehandle, encoding);
+
     /* write buffer flush */
     if (buffer_flags & PIO_BF_WRITEBUF) {
         Parrot_io_flush_buffer(interp, filehandle);
@@ -616,6 +836,63 @@ Parrot_io_readline_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle),
 
 /*
 
+=item C<STRING * Parrot_io_reads_mapped(PARROT_INTERP, PMC *filehandle, size_t
+length, const STR_VTABLE *encoding)>
+
+Returns a string of up to C<length> bytes from the mapped file of
+C<filehandle>, plus the rest of a character split at the end.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING *
+Parrot_io_reads_mapped(PARROT_INTERP, ARGMOD(PMC *filehandle), size_t length,
+        ARGIN(const STR_VTABLE *encoding))
+{
+    ASSERT_ARGS(Parrot_io_reads_mapped)
+    const PIOOFF_T       file_pos = Parrot_io_get_file_position(interp, filehandle);
+    size_t               avail;
+    const char * const   next     = io_mapped_next(interp, filehandle, &avail);
+    Parrot_String_Bounds bounds;
+    INTVAL               needed;
+
+    if (avail == 0) {
+        Parrot_io_set_flags(interp, filehandle,
+                Parrot_io_get_flags(interp, filehandle) | PIO_F_EOF);
+        return io_mapped_string(interp, filehandle, next, 0, 0, encoding);
+    }
+
+    if (length > avail)
+        length = avail;
+
+    bounds.bytes = length;
+    bounds.chars = -1;
+    bounds.delim = -1;
+
+    needed = encoding->partial_scan(interp, next, &bounds);
+
+    /* Complete a character split at the end */
+    if (needed > 0) {
+        bounds.bytes = length + needed;
+        bounds.chars = -1;
+
+        if (bounds.bytes > avail
+        ||  encoding->partial_scan(interp, next, &bounds) > 0)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_CHARACTER,
+                "Unaligned end in %s string\n", encoding->name);
+    }
+
+    Parrot_io_set_file_position(interp, filehandle, file_pos + bounds.bytes);
+
+    return io_mapped_string(interp, filehandle, next, bounds.bytes, bounds.chars, encoding);
+}
+
+/*
+
 =item C<size_t Parrot_io_write_buffer(PARROT_INTERP, PMC *filehandle, const
 STRING *s)>
 
@@ -678,16 +955,8 @@ Parrot_io_write_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle), ARGIN(const STRIN
 #endif
     }
     else if (Parrot_io_get_flags(interp, filehandle) & PIO_F_LINEBUF) {
-        /* scan from end, it's likely that EOL is at end of string */
-        const char *p = (char*)(s->strstart) + len - 1;
-        size_t      i;
-
-        for (i = 0; i < len; ++i, --p) {
-            if (io_is_end_of_line(p)) {
-                need_flush = 1;
-                break;
-            }
-        }
+        if (memchr(s->strstart, '\n', len))
+            need_flush = 1;
     }
 
     /*
@@ -773,6 +1042,21 @@ Parrot_io_seek_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle),
         whence  = SEEK_SET;
     }
 
+    /* A mapped file is read at file_pos, the OS handle isn't used */
+    if (buffer_flags & PIO_BF_MMAP) {
+        if (whence == SEEK_END)
+            offset += Parrot_io_get_buffer_size(interp, filehandle);
+
+        if (offset < 0)
+            return -1;
+
+        Parrot_io_set_flags(interp, filehandle,
+                (Parrot_io_get_flags(interp, filehandle) & ~PIO_F_EOF));
+        Parrot_io_set_file_position(interp, filehandle, offset);
+
+        return offset;
+    }
+
     if (buffer_flags & PIO_BF_READBUF
     &&  whence != SEEK_END) {
         /* Try to seek inside the read buffer */
@@ -806,27 +1090,128 @@ Parrot_io_seek_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle),
 
 /*
 
-=item C<static INTVAL io_is_end_of_line(const char *c)>
+=item C<static const char * io_mapped_next(PARROT_INTERP, PMC *filehandle,
+size_t *avail)>
+
+Returns the position of C<filehandle> in its mapped file and stores the
+number of bytes after it in C<avail>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const char *
+io_mapped_next(PARROT_INTERP, ARGIN(PMC *filehandle), ARGOUT(size_t *avail))
+{
+    ASSERT_ARGS(io_mapped_next)
+    const char * const start    = (const char *)Parrot_io_get_buffer_start(interp, filehandle);
+    const size_t       size     = Parrot_io_get_buffer_size(interp, filehandle);
+    const PIOOFF_T     file_pos = Parrot_io_get_file_position(interp, filehandle);
+
+    if (file_pos >= (PIOOFF_T)size) {
+        *avail = 0;
+        return start + size;
+    }
+
+    *avail = size - (size_t)file_pos;
+    return start + file_pos;
+}
+
+/*
+
+=item C<static STRING * io_mapped_string(PARROT_INTERP, PMC *filehandle, const
+char *start, size_t bytes, INTVAL chars, const STR_VTABLE *encoding)>
+
+Returns a string of C<chars> characters in C<encoding> which points to
+C<bytes> bytes at C<start> in the mapped file of C<filehandle>.  The string
+keeps the file mapped until it is freed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+io_mapped_string(PARROT_INTERP, ARGIN(PMC *filehandle), ARGIN(const char *start),
+        size_t bytes, INTVAL chars, ARGIN(const STR_VTABLE *encoding))
+{
+    ASSERT_ARGS(io_mapped_string)
+    DECL_CONST_CAST;
+    STRING *s;
+
+    if (!bytes)
+        return Parrot_str_new_init(interp, NULL, 0, encoding, 0);
+
+    s = Parrot_gc_new_string_header(interp,
+            PObj_external_FLAG | STRING_mapped_FLAG);
 
-Determine if the current character is the end of the line.
+    /* The whole file is the buffer, so that copies find the mapping's
+     * header in front of it */
+    Buffer_bufstart(s) = Parrot_io_get_buffer_start(interp, filehandle);
+    Buffer_buflen(s)   = Parrot_io_get_buffer_size(interp, filehandle);
+    s->strstart        = PARROT_const_cast(char *, start);
+    s->bufused         = bytes;
+    s->strlen          = chars;
+    s->encoding        = encoding;
 
-Note that this is not a portable solution, but it is what the old architecture
-was doing, once you boil away the useless macros. This will need to change to
-support the Strings PDD, but is left as-is for now, for a smooth transition to
-the new architecture.
+    Parrot_io_retain_mapping(Buffer_bufstart(s));
+
+    return s;
+}
+
+/*
+
+=item C<static STRING * io_readline_mapped(PARROT_INTERP, PMC *filehandle, const
+STR_VTABLE *encoding)>
+
+Returns the next line from the mapped file of C<filehandle>.
 
 =cut
 
 */
 
-static INTVAL
-io_is_end_of_line(ARGIN(const char *c))
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+io_readline_mapped(PARROT_INTERP, ARGMOD(PMC *filehandle),
+        ARGIN(const STR_VTABLE *encoding))
 {
-    ASSERT_ARGS(io_is_end_of_line)
-    if ((*(c)) == '\n')
-        return 1;
+    ASSERT_ARGS(io_readline_mapped)
+    const PIOOFF_T       file_pos = Parrot_io_get_file_position(interp, filehandle);
+    size_t               avail;
+    const char * const   next     = io_mapped_next(interp, filehandle, &avail);
+    Parrot_String_Bounds bounds;
+    INTVAL               rs;
 
-    return 0;
+    GETATTR_Handle_record_separator(interp, filehandle, rs);
+
+    bounds.bytes = avail;
+    bounds.chars = -1;
+    bounds.delim = rs;
+
+    if (avail)
+        encoding->partial_scan(interp, next, &bounds);
+
+    /* The last line has no separator */
+    if (!avail || bounds.delim != rs) {
+        if (bounds.bytes != avail)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_CHARACTER,
+                "Unaligned end in %s string\n", encoding->name);
+
+        Parrot_io_set_flags(interp, filehandle,
+                Parrot_io_get_flags(interp, filehandle) | PIO_F_EOF);
+
+        if (!avail)
+            bounds.chars = 0;
+    }
+
+    Parrot_io_set_file_position(interp, filehandle, file_pos + bounds.bytes);
+
+    return io_mapped_string(interp, filehandle, next, bounds.bytes, bounds.chars, encoding);
 }
 
 /*
@@ -436,7 +436,8 @@ Parrot_io_set_buffer_size(SHIM_INTERP, ARGMOD(PMC *filehandle), size_t new_size)
 
 =item C<void Parrot_io_clear_buffer(PARROT_INTERP, PMC *filehandle)>
 
-Clear the filehandle buffer and free the associated memory.
+Clear the filehandle buffer and free the associated memory.  A mapped file
+is unmapped once no strings point into it any more.
 
 Currently, this pokes directly into the C struct of the FileHandle PMC. This
 needs to change to a general interface that can be used by all subclasses and
@@ -453,10 +454,13 @@ Parrot_io_clear_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle))
 {
     ASSERT_ARGS(Parrot_io_clear_buffer)
     Parrot_FileHandle_attributes * const io = PARROT_FILEHANDLE(filehandle);
-    if (io->buffer_start && (io->flags & PIO_BF_MALLOC)) {
+    if (io->buffer_start && (io->buffer_flags & PIO_BF_MALLOC))
         mem_gc_free(interp, io->buffer_start);
-        io->buffer_start = NULL;
-    }
+    else if (io->buffer_start && (io->buffer_flags & PIO_BF_MMAP))
+        Parrot_io_release_mapping(io->buffer_start);
+
+    io->buffer_start = io->buffer_next = io->buffer_end = NULL;
+    io->buffer_flags = 0;
 }
 
 /*
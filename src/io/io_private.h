@@ -43,6 +43,16 @@ struct _ParrotIOData {
     ParrotIOTable table;
 };
 
+/* The header of a file mapped by a handle opened with "m".  It sits at the
+ * end of an anonymous page mapped just before the file, so a string pointing
+ * into the file finds it from its Buffer_bufstart, which is the file's start.
+ * The handle and every such string are users; the last one unmaps both. */
+typedef struct _ParrotIOMapping {
+    size_t          offset;     /* from the start of the anonymous page */
+    size_t          size;       /* of the file */
+    volatile size_t users;
+} ParrotIOMapping;
+
 /* redefine PIO_STD* for internal use */
 #define _PIO_STDIN(i)   ((i)->piodata->table[PIO_STDIN_FILENO])
 #define _PIO_STDOUT(i)  ((i)->piodata->table[PIO_STDOUT_FILENO])
@@ -45,6 +45,7 @@ them, with default behaviour.
 #include "pmc/pmc_nativepccmethod.h"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_fixedintegerarray.h"
 
 /* HEADERIZER HFILE: include/parrot/multidispatch.h */
 
@@ -82,22 +83,48 @@ static PMC* mmd_build_type_tuple_from_type_list(PARROT_INTERP,
         __attribute__nonnull__(2);
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_types(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *types))
+PARROT_CANNOT_RETURN_NULL
+static MMD_cache_entry * mmd_cache_find(PARROT_INTERP,
+    ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *ids),
+    INTVAL n_types,
+    ARGOUT(UINTVAL *hashval))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*hashval);
+
+static void mmd_cache_store(PARROT_INTERP,
+    ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *ids),
+    INTVAL n_types,
+    ARGIN(PMC *chosen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*cache);
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_values(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *values))
+static INTVAL mmd_cache_types_from_types(PARROT_INTERP,
+    ARGIN(PMC *types),
+    ARGOUT(INTVAL *ids))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*ids);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_values(PARROT_INTERP,
+    ARGIN(PMC *values),
+    ARGOUT(INTVAL *ids))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*ids);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -167,14 +194,24 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(type_list))
-#define ASSERT_ARGS_mmd_cache_key_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_find __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(types))
-#define ASSERT_ARGS_mmd_cache_key_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(ids) \
+    , PARROT_ASSERT_ARG(hashval))
+#define ASSERT_ARGS_mmd_cache_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(values))
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(ids) \
+    , PARROT_ASSERT_ARG(chosen))
+#define ASSERT_ARGS_mmd_cache_types_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(ids))
+#define ASSERT_ARGS_mmd_cache_types_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(values) \
+    , PARROT_ASSERT_ARG(ids))
 #define ASSERT_ARGS_mmd_cvt_to_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(multi_sig))
@@ -1080,6 +1117,10 @@ Parrot_mmd_add_multi_list_from_c_args(PARROT_INTERP,
 
 Creates and returns a new MMD cache.
 
+The cache is keyed on the multi name and the tuple of argument type ids, which
+are hashed and compared as integers, so neither a lookup nor a store creates
+any GC objects.
+
 =cut
 
 */
@@ -1090,156 +1131,301 @@ MMD_Cache *
 Parrot_mmd_cache_create(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_mmd_cache_create)
-    /* String hash. */
-    PMC *cache = Parrot_pmc_new(interp, enum_class_Hash);
+    MMD_Cache * const cache = mem_gc_allocate_zeroed_typed(interp, MMD_Cache);
+
+    cache->entries = mem_gc_allocate_n_zeroed_typed(interp,
+                        MMD_CACHE_MIN_ENTRIES, MMD_cache_entry);
+    cache->mask    = MMD_CACHE_MIN_ENTRIES - 1;
     return cache;
 }
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_values(PARROT_INTERP, const char
-*name, PMC *values)>
+=item C<void Parrot_mmd_cache_clear(PARROT_INTERP, MMD_Cache *cache)>
+
+Forgets all cached dispatch results, for example because candidates were
+added.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_cache_clear(SHIM_INTERP, ARGMOD(MMD_Cache *cache))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_clear)
+    UINTVAL i;
+
+    if (!cache->used)
+        return;
+
+    for (i = 0; i <= cache->mask; ++i)
+        if (cache->entries[i].name)
+            mem_sys_free(cache->entries[i].name);
+
+    memset(cache->entries, 0, (cache->mask + 1) * sizeof (MMD_cache_entry));
+    cache->used = 0;
+}
+
+/*
+
+=item C<void Parrot_mmd_cache_destroy(PARROT_INTERP, MMD_Cache *cache)>
+
+Frees an MMD cache.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_cache_destroy(PARROT_INTERP, ARGFREE_NOTNULL(MMD_Cache *cache))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_destroy)
+    Parrot_mmd_cache_clear(interp, cache);
+    mem_gc_free(interp, cache->entries);
+    mem_gc_free(interp, cache);
+}
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_values(PARROT_INTERP, PMC *values,
+INTVAL *ids)>
 
-Generates an MMD cache key from an array of values.
+Fills C<ids> with the types of the array of values and returns how many there
+are, or -1 if the call can't be cached.
 
 =cut
 
 */
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_values(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *values))
+static INTVAL
+mmd_cache_types_from_values(PARROT_INTERP, ARGIN(PMC *values),
+    ARGOUT(INTVAL *ids))
 {
-    ASSERT_ARGS(mmd_cache_key_from_values)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
+    ASSERT_ARGS(mmd_cache_types_from_values)
     const INTVAL num_values = VTABLE_elements(interp, values);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_values * sizeof (INTVAL) + name_len;
-    INTVAL *type_ids        = mem_gc_allocate_n_typed(interp, num_values + name_len, INTVAL);
-    STRING *key;
-    INTVAL  i;
+    INTVAL       i;
+
+    if (num_values > MMD_CACHE_MAX_TYPES)
+        return -1;
 
     for (i = 0; i < num_values; ++i) {
-        const INTVAL id = VTABLE_type(interp, VTABLE_get_pmc_keyed_int(interp, values, i));
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
+        ids[i] = VTABLE_type(interp, VTABLE_get_pmc_keyed_int(interp, values, i));
 
-        type_ids[i] = id;
+        if (ids[i] == 0)
+            return -1;
     }
 
-    if (name)
-        strcpy((char *)(type_ids + num_values), name);
+    return num_values;
+}
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_types(PARROT_INTERP, PMC *types,
+INTVAL *ids)>
+
+Fills C<ids> from the array of types and returns how many there are, or -1 if
+the call can't be cached.  The type tuples of CallContexts are
+FixedIntegerArrays, which are read directly.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_types_from_types(PARROT_INTERP, ARGIN(PMC *types),
+    ARGOUT(INTVAL *ids))
+{
+    ASSERT_ARGS(mmd_cache_types_from_types)
+    const INTVAL num_types = VTABLE_elements(interp, types);
+    INTVAL       i;
+
+    if (num_types > MMD_CACHE_MAX_TYPES)
+        return -1;
+
+    if (types->vtable->base_type == enum_class_FixedIntegerArray) {
+        INTVAL *int_array;
+        GETATTR_FixedIntegerArray_int_array(interp, types, int_array);
+        if (num_types)
+            memcpy(ids, int_array, num_types * sizeof (INTVAL));
+    }
+    else
+        for (i = 0; i < num_types; ++i)
+            ids[i] = VTABLE_get_integer_keyed_int(interp, types, i);
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
-    mem_gc_free(interp, type_ids);
+    for (i = 0; i < num_types; ++i)
+        if (ids[i] == 0)
+            return -1;
 
-    return key;
+    return num_types;
 }
 
 /*
 
-=item C<PMC * Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, MMD_Cache *cache,
-const char *name, PMC *values)>
+=item C<static MMD_cache_entry * mmd_cache_find(PARROT_INTERP, MMD_Cache *cache,
+const char *name, const INTVAL *ids, INTVAL n_types, UINTVAL *hashval)>
 
-Takes an array of values for the call and does a lookup in the MMD cache.
+Returns the cache entry for C<name> and the C<n_types> types in C<ids>, or the
+unused entry where it belongs.  The hash of the key is stored in C<hashval>.
 
 =cut
 
 */
 
-PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-PMC *
-Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *values))
+PARROT_CANNOT_RETURN_NULL
+static MMD_cache_entry *
+mmd_cache_find(PARROT_INTERP, ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(const INTVAL *ids), INTVAL n_types,
+    ARGOUT(UINTVAL *hashval))
 {
-    ASSERT_ARGS(Parrot_mmd_cache_lookup_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    ASSERT_ARGS(mmd_cache_find)
+    size_t  seed = interp->hash_seed;
+    UINTVAL i;
 
-    if (key)
-        return VTABLE_get_pmc_keyed_str(interp, cache, key);
+    if (name)
+        seed = Parrot_hash_buffer((const unsigned char *)name, strlen(name), seed);
 
-    return PMCNULL;
+    *hashval = Parrot_hash_buffer((const unsigned char *)ids,
+                    n_types * sizeof (INTVAL), seed);
+
+    for (i = *hashval & cache->mask; ; i = (i + 1) & cache->mask) {
+        MMD_cache_entry * const e = cache->entries + i;
+
+        if (!e->chosen)
+            return e;
+
+        if (e->hashval == *hashval && e->n_types == n_types
+        &&  !memcmp(e->types, ids, n_types * sizeof (INTVAL))
+        &&  (e->name ? name && STREQ(e->name, name) : !name))
+            return e;
+    }
 }
 
 /*
 
-=item C<void Parrot_mmd_cache_store_by_values(PARROT_INTERP, MMD_Cache *cache,
-const char *name, PMC *values, PMC *chosen)>
+=item C<static void mmd_cache_store(PARROT_INTERP, MMD_Cache *cache, const char
+*name, const INTVAL *ids, INTVAL n_types, PMC *chosen)>
 
-Takes an array of values for the call along with a chosen candidate and puts
-it into the cache.
+Stores C<chosen> for C<name> and the given types.  The cache doubles when it
+gets three quarters full, and starts over once it reaches
+C<MMD_CACHE_MAX_ENTRIES>.
 
 =cut
 
 */
 
-PARROT_EXPORT
-void
-Parrot_mmd_cache_store_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *values), ARGIN(PMC *chosen))
+static void
+mmd_cache_store(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(const INTVAL *ids), INTVAL n_types,
+    ARGIN(PMC *chosen))
 {
-    ASSERT_ARGS(Parrot_mmd_cache_store_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    ASSERT_ARGS(mmd_cache_store)
+    MMD_cache_entry *e;
+    UINTVAL          hashval;
+
+    if ((cache->used + 1) * 4 > (cache->mask + 1) * 3) {
+        const UINTVAL    old_size = cache->mask + 1;
+        MMD_cache_entry *old      = cache->entries;
+        UINTVAL          i;
+
+        if (old_size >= MMD_CACHE_MAX_ENTRIES) {
+            Parrot_mmd_cache_clear(interp, cache);
+        }
+        else {
+            cache->entries = mem_gc_allocate_n_zeroed_typed(interp,
+                                old_size * 2, MMD_cache_entry);
+            cache->mask    = old_size * 2 - 1;
+
+            for (i = 0; i < old_size; ++i) {
+                if (old[i].chosen) {
+                    UINTVAL j = old[i].hashval & cache->mask;
+
+                    while (cache->entries[j].chosen)
+                        j = (j + 1) & cache->mask;
+
+                    cache->entries[j] = old[i];
+                }
+            }
+
+            mem_gc_free(interp, old);
+        }
+    }
+
+    e = mmd_cache_find(interp, cache, name, ids, n_types, &hashval);
 
-    if (key)
-        VTABLE_set_pmc_keyed_str(interp, cache, key, chosen);
+    if (!e->chosen) {
+        e->name    = name ? mem_sys_strdup(name) : NULL;
+        e->hashval = hashval;
+        e->n_types = n_types;
+        if (n_types)
+            memcpy(e->types, ids, n_types * sizeof (INTVAL));
+        ++cache->used;
+    }
+
+    e->chosen = chosen;
 }
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_types(PARROT_INTERP, const char
-*name, PMC *types)>
+=item C<PMC * Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, MMD_Cache *cache,
+const char *name, PMC *values)>
 
-Generates an MMD cache key from an array of types.
+Takes an array of values for the call and does a lookup in the MMD cache.
 
 =cut
 
 */
 
+PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_types(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *types))
+PMC *
+Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *values))
 {
-    ASSERT_ARGS(mmd_cache_key_from_types)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
-    const INTVAL num_types  = VTABLE_elements(interp, types);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_types * sizeof (INTVAL) + name_len;
-    INTVAL * const type_ids = mem_gc_allocate_n_typed(interp, num_types + name_len, INTVAL);
-
-    STRING *key;
-    INTVAL  i;
-
-    for (i = 0; i < num_types; ++i) {
-        const INTVAL id = VTABLE_get_integer_keyed_int(interp, types, i);
-
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
-
-        type_ids[i] = id;
+    ASSERT_ARGS(Parrot_mmd_cache_lookup_by_values)
+    INTVAL        ids[MMD_CACHE_MAX_TYPES];
+    const INTVAL  n = mmd_cache_types_from_values(interp, values, ids);
+    UINTVAL       hashval;
+
+    if (n >= 0) {
+        PMC * const chosen = mmd_cache_find(interp, cache, name, ids, n,
+                                &hashval)->chosen;
+        if (chosen)
+            return chosen;
     }
 
-    if (name)
-        strcpy((char *)(type_ids + num_types), name);
+    return PMCNULL;
+}
+
+/*
+
+=item C<void Parrot_mmd_cache_store_by_values(PARROT_INTERP, MMD_Cache *cache,
+const char *name, PMC *values, PMC *chosen)>
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
+Takes an array of values for the call along with a chosen candidate and puts
+it into the cache.
 
-    mem_gc_free(interp, type_ids);
-    return key;
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_cache_store_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *values), ARGIN(PMC *chosen))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_store_by_values)
+    INTVAL        ids[MMD_CACHE_MAX_TYPES];
+    const INTVAL  n = mmd_cache_types_from_values(interp, values, ids);
+
+    if (n >= 0)
+        mmd_cache_store(interp, cache, name, ids, n, chosen);
 }
 
 /*
@@ -1258,13 +1444,19 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC *
 Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *types))
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *types))
 {
     ASSERT_ARGS(Parrot_mmd_cache_lookup_by_types)
-    STRING * const key = mmd_cache_key_from_types(interp, name, types);
-
-    if (key)
-        return VTABLE_get_pmc_keyed_str(interp, cache, key);
+    INTVAL        ids[MMD_CACHE_MAX_TYPES];
+    const INTVAL  n = mmd_cache_types_from_types(interp, types, ids);
+    UINTVAL       hashval;
+
+    if (n >= 0) {
+        PMC * const chosen = mmd_cache_find(interp, cache, name, ids, n,
+                                &hashval)->chosen;
+        if (chosen)
+            return chosen;
+    }
 
     return PMCNULL;
 }
@@ -1285,13 +1477,14 @@ tied to an individual multi can be null.
 PARROT_EXPORT
 void
 Parrot_mmd_cache_store_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *types), ARGIN(PMC *chosen))
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *types), ARGIN(PMC *chosen))
 {
     ASSERT_ARGS(Parrot_mmd_cache_store_by_types)
-    STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    INTVAL        ids[MMD_CACHE_MAX_TYPES];
+    const INTVAL  n = mmd_cache_types_from_types(interp, types, ids);
 
-    if (key)
-        VTABLE_set_pmc_keyed_str(interp, cache, key, chosen);
+    if (n >= 0)
+        mmd_cache_store(interp, cache, name, ids, n, chosen);
 }
 
 /*
@@ -1309,10 +1502,13 @@ void
 Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 {
     ASSERT_ARGS(Parrot_mmd_cache_mark)
-    /* As a small future optimization, note that we only *really* need to mark
-    * keys - the candidates will be referenced outside the cache, provided it's
-    * invalidated properly. */
-    Parrot_gc_mark_PMC_alive(interp, cache);
+    UINTVAL i;
+
+    /* The candidates are normally referenced from their MultiSubs as well,
+     * but a stale entry must not point to a freed PMC. */
+    for (i = 0; i <= cache->mask; ++i)
+        if (cache->entries[i].chosen)
+            Parrot_gc_mark_PMC_alive(interp, cache->entries[i].chosen);
 }
 
 /*
@@ -75,6 +75,13 @@ static void store_sub_in_multi(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static int store_sub_in_namespace(PARROT_INTERP,
+    ARGIN(PMC *sub_pmc),
+    ARGIN(PMC *ns))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 #define ASSERT_ARGS_get_namespace_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
@@ -98,6 +105,10 @@ static void store_sub_in_multi(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc) \
     , PARROT_ASSERT_ARG(ns))
+#define ASSERT_ARGS_store_sub_in_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_pmc) \
+    , PARROT_ASSERT_ARG(ns))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -341,6 +352,46 @@ store_sub_in_multi(PARROT_INTERP, ARGIN(PMC *sub_pmc), ARGIN(PMC *ns))
 
 /*
 
+=item C<static int store_sub_in_namespace(PARROT_INTERP, PMC *sub_pmc, PMC *ns)>
+
+Attaches the sub C<sub_pmc> to the namespace C<ns> and stores it there, either
+under its own name or in a multi of that name.  Returns true if the sub was
+stored as a plain global, in which case the caller must invalidate method
+caches for the namespace.
+
+=cut
+
+*/
+
+static int
+store_sub_in_namespace(PARROT_INTERP, ARGIN(PMC *sub_pmc), ARGIN(PMC *ns))
+{
+    ASSERT_ARGS(store_sub_in_namespace)
+    Parrot_Sub_attributes *sub;
+
+    PMC_get_sub(interp, sub_pmc, sub);
+
+    /* attach a namespace to the sub for lookups */
+    sub->namespace_stash = ns;
+
+    /* store a :multi sub */
+    if (!PMC_IS_NULL(sub->multi_signature)) {
+        store_sub_in_multi(interp, sub_pmc, ns);
+        return 0;
+    }
+
+    /* store other subs (as long as they're not :anon) */
+    if (!(PObj_get_FLAGS(sub_pmc) & SUB_FLAG_PF_ANON)
+    ||  sub->vtable_index != -1) {
+        Parrot_ns_store_global(interp, ns, sub->ns_entry_name, sub_pmc);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+
 =back
 
 =head1 NameSpace API Functions
@@ -734,20 +785,8 @@ Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 
     ns = get_namespace_pmc(interp, sub_pmc);
 
-    /* attach a namespace to the sub for lookups */
-    sub->namespace_stash = ns;
-
-    /* store a :multi sub */
-    if (!PMC_IS_NULL(sub->multi_signature))
-        store_sub_in_multi(interp, sub_pmc, ns);
-
-    /* store other subs (as long as they're not :anon) */
-    else if (!(PObj_get_FLAGS(sub_pmc) & SUB_FLAG_PF_ANON)
-        || sub->vtable_index != -1) {
-        STRING * const ns_entry_name = sub->ns_entry_name;
-        PMC    * const nsname        = sub->namespace_name;
-
-        Parrot_ns_store_global(interp, ns, ns_entry_name, sub_pmc);
+    if (store_sub_in_namespace(interp, sub_pmc, ns)) {
+        PMC * const nsname = sub->namespace_name;
 
         /* TT #1224:
            TEMPORARY HACK - cache invalidation should be a namespace function
@@ -764,6 +803,65 @@ Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 
 /*
 
+=item C<void Parrot_ns_store_subs(PARROT_INTERP, PMC **pmcs, INTVAL n)>
+
+Stores every Sub among the C<n> PMCs in C<pmcs> as C<Parrot_ns_store_sub>
+would, skipping other PMCs.  This is the bulk form used when a constant table
+is loaded: the namespace is only looked up again when the namespace key or HLL
+changes from the previous sub, and method caches are invalidated once for the
+whole batch rather than once per sub.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_ns_store_subs(PARROT_INTERP, ARGIN(PMC **pmcs), INTVAL n)
+{
+    ASSERT_ARGS(Parrot_ns_store_subs)
+    STRING * const sub_str = CONST_STRING(interp, "Sub");
+    const INTVAL   cur_id  = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
+    PMC           *ns      = PMCNULL;
+    PMC           *nsname  = PMCNULL;
+    INTVAL         hll_id  = -1;
+    int            stale   = 0;
+    INTVAL         i;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const sub_pmc = pmcs[i];
+        Parrot_Sub_attributes *sub;
+
+        if (!VTABLE_isa(interp, sub_pmc, sub_str))
+            continue;
+
+        PMC_get_sub(interp, sub_pmc, sub);
+
+        if (sub->HLL_id != hll_id) {
+            hll_id = sub->HLL_id;
+            ns     = PMCNULL;
+            Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), hll_id);
+        }
+
+        /* subs of one namespace share its key constant */
+        if (PMC_IS_NULL(ns) || sub->namespace_name != nsname) {
+            nsname = sub->namespace_name;
+            ns     = get_namespace_pmc(interp, sub_pmc);
+        }
+
+        if (store_sub_in_namespace(interp, sub_pmc, ns) && !PMC_IS_NULL(nsname))
+            stale = 1;
+    }
+
+    /* TT #1224: see Parrot_ns_store_sub */
+    if (stale)
+        Parrot_invalidate_method_cache(interp, NULL);
+
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_id);
+}
+
+/*
+
 =item C<Parrot_PMC Parrot_ns_get_root_namespace(PARROT_INTERP)>
 
 Return the root namespace
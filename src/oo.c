@@ -48,6 +48,28 @@ static INTVAL fail_if_type_exists(PARROT_INTERP, ARGIN(PMC *name))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void fill_attrib_ic(PARROT_INTERP,
+    ARGIN(const opcode_t *site),
+    ARGIN(PMC *object),
+    ARGIN(STRING *name),
+    ARGIN(STRING *override))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Attrib_ic * find_attrib_ic(PARROT_INTERP,
+    ARGIN(const opcode_t *site),
+    ARGIN(PMC *object),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_INLINE
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -70,6 +92,17 @@ static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
 #define ASSERT_ARGS_fail_if_type_exists __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_fill_attrib_ic __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(site) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(override))
+#define ASSERT_ARGS_find_attrib_ic __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(site) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_get_pmc_proxy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_all_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -768,6 +801,52 @@ mark_object_cache(PARROT_INTERP)
             }
         }
     }
+
+    /* inline cache entries must stay alive, as they are compared by address */
+    if (mc->ics) {
+        for (entry = 0; entry < METHOD_IC_SIZE; ++entry) {
+            Method_ic * const ic = &mc->ics[entry];
+            UINTVAL i;
+
+            if (ic->version != mc->ic_version)
+                continue;
+
+            for (i = 0; i < ic->n_entries; ++i) {
+                Parrot_gc_mark_PMC_alive(interp, ic->entries[i]._class);
+                Parrot_gc_mark_STRING_alive(interp, ic->entries[i].name);
+                Parrot_gc_mark_PMC_alive(interp, ic->entries[i].method);
+            }
+        }
+    }
+
+    if (mc->attrib_ics) {
+        for (entry = 0; entry < ATTRIB_IC_SIZE; ++entry) {
+            Attrib_ic * const ic = &mc->attrib_ics[entry];
+
+            if (ic->version != mc->ic_version)
+                continue;
+
+            Parrot_gc_mark_PMC_alive(interp, ic->_class);
+            Parrot_gc_mark_PMC_alive(interp, ic->attrib_index);
+            Parrot_gc_mark_STRING_alive(interp, ic->name);
+        }
+    }
+
+    if (mc->lex_ics) {
+        for (entry = 0; entry < LEX_IC_SIZE; ++entry) {
+            Lex_ic * const ic = &mc->lex_ics[entry];
+            UINTVAL i;
+
+            if (ic->version != mc->ic_version)
+                continue;
+
+            Parrot_gc_mark_STRING_alive(interp, ic->name);
+
+            for (i = 0; i <= ic->depth; ++i)
+                if (ic->lexinfo[i])
+                    Parrot_gc_mark_PMC_alive(interp, ic->lexinfo[i]);
+        }
+    }
 }
 
 
@@ -786,7 +865,11 @@ init_object_cache(PARROT_INTERP)
 {
     ASSERT_ARGS(init_object_cache)
     Caches * const mc = interp->caches = mem_gc_allocate_zeroed_typed(interp, Caches);
-    mc->idx = NULL;
+    mc->idx        = NULL;
+    mc->ics        = NULL;
+    mc->ic_version = 1;
+    mc->attrib_ics = NULL;
+    mc->lex_ics    = NULL;
 }
 
 
@@ -814,6 +897,15 @@ destroy_object_cache(PARROT_INTERP)
             invalidate_type_caches(interp, i);
     }
 
+    if (mc->ics)
+        mem_gc_free(interp, mc->ics);
+
+    if (mc->attrib_ics)
+        mem_gc_free(interp, mc->attrib_ics);
+
+    if (mc->lex_ics)
+        mem_gc_free(interp, mc->lex_ics);
+
     mem_gc_free(interp, mc->idx);
     mem_gc_free(interp, mc);
 }
@@ -884,7 +976,8 @@ invalidate_all_caches(PARROT_INTERP)
 =item C<void Parrot_invalidate_method_cache(PARROT_INTERP, STRING *_class)>
 
 Clear method cache for the given class. If class is NULL, caches for
-all classes are invalidated.
+all classes are invalidated. All inline caches of call sites are
+invalidated in either case.
 
 =cut
 
@@ -897,6 +990,9 @@ Parrot_invalidate_method_cache(PARROT_INTERP, ARGIN_NULLOK(STRING *_class))
     ASSERT_ARGS(Parrot_invalidate_method_cache)
     INTVAL type;
 
+    if (interp->caches)
+        ++interp->caches->ic_version;
+
     /* during interp creation and NCI registration the class_hash
      * isn't yet up */
     if (!interp->class_hash)
@@ -1006,8 +1102,15 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
     Meth_cache_entry *e;
     UINTVAL type, bits;
 
-    if (! PObj_constant_TEST(method_name))
-        return Parrot_find_method_direct(interp, _class, method_name);
+    /* The cache is keyed on the buffer of the name, which only constants
+     * keep; other names use the interned constant with the same contents,
+     * such as the name of the method itself */
+    if (! PObj_constant_TEST(method_name)) {
+        method_name = Parrot_str_intern(interp, method_name);
+
+        if (! PObj_constant_TEST(method_name))
+            return Parrot_find_method_direct(interp, _class, method_name);
+    }
 
     mc   = interp->caches;
     type = _class->vtable->base_type;
@@ -1051,6 +1154,280 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 }
 
 
+/*
+
+=item C<PMC * Parrot_find_method_with_inline_cache(PARROT_INTERP, const opcode_t
+*site, PMC *object, STRING *method_name)>
+
+Find the method named C<method_name> of the invocant C<object> for the call
+site at C<site>, like C<VTABLE_find_method> does.
+
+Each call site remembers the last few methods it found, keyed on the vtable,
+the class (for objects) and the method name, so monomorphic and slightly
+polymorphic sites skip the lookup.  Method names don't have to be constant.
+Only invocants whose C<find_method> is the default or Object one are cached,
+as other lookups may depend on more than the invocant's type.  The caches are
+invalidated by C<Parrot_invalidate_method_cache>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_find_method_with_inline_cache(PARROT_INTERP, ARGIN(const opcode_t *site),
+        ARGIN(PMC *object), ARGIN(STRING *method_name))
+{
+    ASSERT_ARGS(Parrot_find_method_with_inline_cache)
+
+#if DISABLE_METH_CACHE
+    UNUSED(site);
+    return VTABLE_find_method(interp, object, method_name);
+#else
+
+    Caches * const   mc     = interp->caches;
+    VTABLE * const   vtable = object->vtable;
+    PMC             *_class = NULL;
+    PMC             *method;
+    Method_ic       *ic;
+    Method_ic_entry *e;
+    UINTVAL          i;
+
+    if (vtable->find_method == interp->vtables[enum_class_Object]->find_method)
+        _class = PARROT_OBJECT(object)->_class;
+    else if (vtable->find_method != interp->vtables[enum_class_default]->find_method)
+        return VTABLE_find_method(interp, object, method_name);
+
+    if (!mc->ics)
+        mc->ics = mem_gc_allocate_n_zeroed_typed(interp, METHOD_IC_SIZE, Method_ic);
+
+    ic = &mc->ics[(PTR2UINTVAL(site) >> 3) & METHOD_IC_SIZE_MASK];
+
+    if (ic->site != site || ic->version != mc->ic_version) {
+        ic->site      = site;
+        ic->version   = mc->ic_version;
+        ic->n_entries = 0;
+        ic->next      = 0;
+    }
+
+    for (i = 0; i < ic->n_entries; ++i) {
+        e = &ic->entries[i];
+
+        if (e->vtable == vtable && e->_class == _class
+        && (e->name == method_name || STRING_equal(interp, e->name, method_name)))
+            return e->method;
+    }
+
+    method = VTABLE_find_method(interp, object, method_name);
+
+    /* only cache hits; misses throw anyway.  The lookup may have run code
+     * which invalidated the caches or reused the slot */
+    if (PMC_IS_NULL(method) || ic->site != site || ic->version != mc->ic_version)
+        return method;
+
+    if (ic->n_entries < METHOD_IC_ENTRIES)
+        e = &ic->entries[ic->n_entries++];
+    else {
+        e        = &ic->entries[ic->next];
+        ic->next = (ic->next + 1) % METHOD_IC_ENTRIES;
+    }
+
+    e->vtable = vtable;
+    e->_class = _class;
+    e->name   = method_name;
+    e->method = method;
+
+    return method;
+
+#endif
+}
+
+
+/*
+
+=item C<static Attrib_ic * find_attrib_ic(PARROT_INTERP, const opcode_t *site,
+PMC *object, STRING *name)>
+
+Returns the inline cache slot of the attribute access at C<site> if it holds
+the position of the attribute C<name> in C<object>, or NULL otherwise.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Attrib_ic *
+find_attrib_ic(PARROT_INTERP, ARGIN(const opcode_t *site), ARGIN(PMC *object),
+        ARGIN(STRING *name))
+{
+    ASSERT_ARGS(find_attrib_ic)
+    Caches * const mc = interp->caches;
+    Attrib_ic     *ic;
+    PMC           *_class;
+
+    if (!mc->attrib_ics || object->vtable != interp->vtables[enum_class_Object])
+        return NULL;
+
+    ic     = &mc->attrib_ics[(PTR2UINTVAL(site) >> 3) & ATTRIB_IC_SIZE_MASK];
+    _class = PARROT_OBJECT(object)->_class;
+
+    if (ic->site == site && ic->version == mc->ic_version
+    &&  ic->_class == _class
+    &&  ic->attrib_index == PARROT_CLASS(_class)->attrib_index
+    && (ic->name == name || STRING_equal(interp, ic->name, name)))
+        return ic;
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static void fill_attrib_ic(PARROT_INTERP, const opcode_t *site, PMC
+*object, STRING *name, STRING *override)>
+
+Remembers the position of the attribute C<name> of C<object> in the inline
+cache slot of the attribute access at C<site>, after a lookup through the
+vtable found it.  Nothing is cached if the class of C<object> overrides the
+vtable function C<override>, as the access has to run the override.
+
+=cut
+
+*/
+
+static void
+fill_attrib_ic(PARROT_INTERP, ARGIN(const opcode_t *site), ARGIN(PMC *object),
+        ARGIN(STRING *name), ARGIN(STRING *override))
+{
+    ASSERT_ARGS(fill_attrib_ic)
+    Caches * const mc = interp->caches;
+    PMC           *_class;
+    PMC           *attrib_cache;
+    Attrib_ic     *ic;
+    INTVAL         index;
+
+    if (object->vtable != interp->vtables[enum_class_Object])
+        return;
+
+    _class = PARROT_OBJECT(object)->_class;
+
+    if (!PMC_IS_NULL(Parrot_oo_find_vtable_override(interp, _class, override)))
+        return;
+
+    /* the lookup left the position in the cache of the class */
+    attrib_cache = PARROT_CLASS(_class)->attrib_cache;
+    if (PMC_IS_NULL(attrib_cache)
+    || !VTABLE_exists_keyed_str(interp, attrib_cache, name))
+        return;
+
+    index = VTABLE_get_integer_keyed_str(interp, attrib_cache, name);
+
+    if (!mc->attrib_ics)
+        mc->attrib_ics = mem_gc_allocate_n_zeroed_typed(interp, ATTRIB_IC_SIZE,
+                            Attrib_ic);
+
+    ic               = &mc->attrib_ics[(PTR2UINTVAL(site) >> 3) & ATTRIB_IC_SIZE_MASK];
+    ic->site         = site;
+    ic->version      = mc->ic_version;
+    ic->_class       = _class;
+    ic->attrib_index = PARROT_CLASS(_class)->attrib_index;
+    ic->name         = name;
+    ic->index        = index;
+}
+
+
+/*
+
+=item C<PMC * Parrot_get_attr_with_inline_cache(PARROT_INTERP, const opcode_t
+*site, PMC *object, STRING *name)>
+
+Gets the attribute C<name> of C<object> for the attribute access at C<site>,
+like C<VTABLE_get_attr_str> does.
+
+Each access remembers where the attribute is stored in the objects of the
+last class it saw, so accessing an attribute of an object of that class is an
+index into its attribute store.  Only objects without a C<get_attr_str>
+override are cached.  The caches are invalidated by
+C<Parrot_invalidate_method_cache>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_get_attr_with_inline_cache(PARROT_INTERP, ARGIN(const opcode_t *site),
+        ARGIN(PMC *object), ARGIN(STRING *name))
+{
+    ASSERT_ARGS(Parrot_get_attr_with_inline_cache)
+
+#if DISABLE_METH_CACHE
+    UNUSED(site);
+    return VTABLE_get_attr_str(interp, object, name);
+#else
+
+    const Attrib_ic * const ic = find_attrib_ic(interp, site, object, name);
+    PMC *value;
+
+    if (ic)
+        return VTABLE_get_pmc_keyed_int(interp,
+                    PARROT_OBJECT(object)->attrib_store, ic->index);
+
+    value = VTABLE_get_attr_str(interp, object, name);
+    fill_attrib_ic(interp, site, object, name, CONST_STRING(interp, "get_attr_str"));
+
+    return value;
+
+#endif
+}
+
+
+/*
+
+=item C<void Parrot_set_attr_with_inline_cache(PARROT_INTERP, const opcode_t
+*site, PMC *object, STRING *name, PMC *value)>
+
+Sets the attribute C<name> of C<object> to C<value> for the attribute access
+at C<site>, like C<VTABLE_set_attr_str> does.  The cache works like the one of
+C<Parrot_get_attr_with_inline_cache>, for objects without a C<set_attr_str>
+override.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_set_attr_with_inline_cache(PARROT_INTERP, ARGIN(const opcode_t *site),
+        ARGIN(PMC *object), ARGIN(STRING *name), ARGIN(PMC *value))
+{
+    ASSERT_ARGS(Parrot_set_attr_with_inline_cache)
+
+#if DISABLE_METH_CACHE
+    UNUSED(site);
+    VTABLE_set_attr_str(interp, object, name, value);
+#else
+
+    const Attrib_ic * const ic = find_attrib_ic(interp, site, object, name);
+
+    if (ic) {
+        VTABLE_set_pmc_keyed_int(interp,
+            PARROT_OBJECT(object)->attrib_store, ic->index, value);
+        return;
+    }
+
+    VTABLE_set_attr_str(interp, object, name, value);
+    fill_attrib_ic(interp, site, object, name, CONST_STRING(interp, "set_attr_str"));
+
+#endif
+}
+
+
 /*
 
 =item C<static PMC* C3_merge(PARROT_INTERP, PMC *merge_list)>
@@ -72,19 +72,18 @@ extern op_lib_t core_op_lib;
 
 
 
-/* Chandon TODO: Should not have private header here */
 #include "parrot/scheduler_private.h"
 #include "pmc/pmc_task.h"
 
 
 
-INTVAL core_numops = 1103;
+INTVAL core_numops = 1108;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1103] = {
+static op_func_t core_op_func_table[1108] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -1187,6 +1186,11 @@ static op_func_t core_op_func_table[1103] = {
   Parrot_wait_p,                                     /*   1099 */
   Parrot_wait_pc,                                    /*   1100 */
   Parrot_pass,                                       /*   1101 */
+  Parrot_mod_i_i_i__unless_i_ic,                     /*   1102 */
+  Parrot_dec_i__branch_ic,                           /*   1103 */
+  Parrot_add_p_p__add_p_p,                           /*   1104 */
+  Parrot_add_p_p__add_p_p__add_p_p,                  /*   1105 */
+  Parrot_dec_p__lt_p_ic_ic,                          /*   1106 */
 
   NULL /* NULL function pointer */
 };
@@ -1197,7 +1201,7 @@ static op_func_t core_op_func_table[1103] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1103] = {
+static op_info_t core_op_info_table[1108] = {
   { /* 0 */
     "end",
     "end",
@@ -13320,6 +13324,61 @@ static op_info_t core_op_info_table[1103] = {
     { 0 },
     &core_op_lib
   },
+  { /* 1102 */
+    "mod_i_i_i__unless_i_ic",
+    "mod_i_i_i__unless_i_ic",
+    "Parrot_mod_i_i_i__unless_i_ic",
+    PARROT_JUMP_RELATIVE,
+    6,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1103 */
+    "dec_i__branch_ic",
+    "dec_i__branch_ic",
+    "Parrot_dec_i__branch_ic",
+    PARROT_JUMP_RELATIVE,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_INOUT, PARROT_ARGDIR_IN },
+    { 0, 1 },
+    &core_op_lib
+  },
+  { /* 1104 */
+    "add_p_p__add_p_p",
+    "add_p_p__add_p_p",
+    "Parrot_add_p_p__add_p_p",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1105 */
+    "add_p_p__add_p_p__add_p_p",
+    "add_p_p__add_p_p__add_p_p",
+    "Parrot_add_p_p__add_p_p__add_p_p",
+    0,
+    7,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1106 */
+    "dec_p__lt_p_ic_ic",
+    "dec_p__lt_p_ic_ic",
+    "Parrot_dec_p__lt_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 1 },
+    &core_op_lib
+  },
 
 };
 
@@ -18006,7 +18065,7 @@ Parrot_callmethodcc_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
     opcode_t  * const  next =  cur_opcode + 3;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
     opcode_t  * dest = NULL;
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18040,7 +18099,7 @@ Parrot_callmethodcc_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
     opcode_t  * const  next =  cur_opcode + 3;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
     opcode_t  * dest = NULL;
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18090,7 +18149,7 @@ Parrot_callmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
     opcode_t  * const  next =  cur_opcode + 4;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18115,7 +18174,7 @@ Parrot_callmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
     opcode_t  * const  next =  cur_opcode + 4;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18158,7 +18217,7 @@ Parrot_tailcallmethod_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  next =  cur_opcode + 3;
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18183,7 +18242,7 @@ Parrot_tailcallmethod_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  next =  cur_opcode + 3;
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18826,14 +18885,14 @@ Parrot_removeattribute_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_getattribute_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SREG(3));
+    PREG(1) = Parrot_get_attr_with_inline_cache(interp, CUR_OPCODE, PREG(2), SREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return (opcode_t *)cur_opcode + 4;
 }
 
 opcode_t *
 Parrot_getattribute_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SCONST(3));
+    PREG(1) = Parrot_get_attr_with_inline_cache(interp, CUR_OPCODE, PREG(2), SCONST(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return (opcode_t *)cur_opcode + 4;
 }
@@ -18868,13 +18927,13 @@ Parrot_getattribute_p_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_setattribute_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_attr_str(interp, PREG(1), SREG(2), PREG(3));
+    Parrot_set_attr_with_inline_cache(interp, CUR_OPCODE, PREG(1), SREG(2), PREG(3));
     return (opcode_t *)cur_opcode + 4;
 }
 
 opcode_t *
 Parrot_setattribute_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_attr_str(interp, PREG(1), SCONST(2), PREG(3));
+    Parrot_set_attr_with_inline_cache(interp, CUR_OPCODE, PREG(1), SCONST(2), PREG(3));
     return (opcode_t *)cur_opcode + 4;
 }
 
@@ -21889,15 +21948,25 @@ opcode_t *
 Parrot_store_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_PMC(interp, lex_ctx, reg) = PREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     }
 
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -21905,15 +21974,25 @@ opcode_t *
 Parrot_store_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_PMC(interp, lex_ctx, reg) = PREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     }
 
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -21921,15 +22000,25 @@ opcode_t *
 Parrot_store_lex_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -21937,15 +22026,25 @@ opcode_t *
 Parrot_store_lex_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -21953,15 +22052,25 @@ opcode_t *
 Parrot_store_lex_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -21969,15 +22078,25 @@ opcode_t *
 Parrot_store_lex_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -21985,15 +22104,24 @@ opcode_t *
 Parrot_store_lex_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = IREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22001,15 +22129,24 @@ opcode_t *
 Parrot_store_lex_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = IREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22017,15 +22154,24 @@ opcode_t *
 Parrot_store_lex_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = ICONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22033,15 +22179,24 @@ opcode_t *
 Parrot_store_lex_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = ICONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22049,15 +22204,24 @@ opcode_t *
 Parrot_store_lex_s_n(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
     }
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22065,15 +22229,24 @@ opcode_t *
 Parrot_store_lex_sc_n(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
     }
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22081,15 +22254,24 @@ opcode_t *
 Parrot_store_lex_s_nc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NCONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
     }
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22097,15 +22279,24 @@ opcode_t *
 Parrot_store_lex_sc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NCONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-        return (opcode_t *)handler;
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
     }
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22145,10 +22336,18 @@ opcode_t *
 Parrot_find_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        PREG(1) = CTX_REG_PMC(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return (opcode_t *)cur_opcode + 3;
 }
@@ -22157,10 +22356,18 @@ opcode_t *
 Parrot_find_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        PREG(1) = CTX_REG_PMC(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return (opcode_t *)cur_opcode + 3;
 }
@@ -22169,10 +22376,18 @@ opcode_t *
 Parrot_find_lex_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        SREG(1) = CTX_REG_STR(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    SREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return (opcode_t *)cur_opcode + 3;
 }
@@ -22181,10 +22396,18 @@ opcode_t *
 Parrot_find_lex_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        SREG(1) = CTX_REG_STR(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    SREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return (opcode_t *)cur_opcode + 3;
 }
@@ -22193,10 +22416,18 @@ opcode_t *
 Parrot_find_lex_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        IREG(1) = CTX_REG_INT(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    IREG(1) = result;
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22204,10 +22435,18 @@ opcode_t *
 Parrot_find_lex_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        IREG(1) = CTX_REG_INT(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    IREG(1) = result;
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22215,10 +22454,18 @@ opcode_t *
 Parrot_find_lex_n_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        NREG(1) = CTX_REG_NUM(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    NREG(1) = result;
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -22226,10 +22473,18 @@ opcode_t *
 Parrot_find_lex_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC      * const  ctx = CURRENT_CONTEXT(interp);
     STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        NREG(1) = CTX_REG_NUM(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    }
 
-    NREG(1) = result;
     return (opcode_t *)cur_opcode + 3;
 }
 
@@ -24048,6 +24303,94 @@ Parrot_pass(opcode_t *cur_opcode, PARROT_INTERP) {
     return (opcode_t *)cur_opcode + 1;
 }
 
+opcode_t *
+Parrot_mod_i_i_i__unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+/* mod_i_i_i */
+{
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
+}
+/* unless_i_ic */
+{
+    if ((IREG(4) == 0)) {
+        return (opcode_t *)cur_opcode + ICONST(5);
+    }
+
+    return (opcode_t *)cur_opcode + 6;
+}
+}
+
+
+opcode_t *
+Parrot_dec_i__branch_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+/* dec_i */
+{
+    (IREG(1)--);
+}
+/* branch_ic */
+{
+    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2))) == 0)) {
+        return (opcode_t *)0;
+    }
+
+    return (opcode_t *)cur_opcode + ICONST(2);
+}
+}
+
+
+opcode_t *
+Parrot_add_p_p__add_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+}
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(3), PREG(4));
+    return (opcode_t *)cur_opcode + 5;
+}
+}
+
+
+opcode_t *
+Parrot_add_p_p__add_p_p__add_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+}
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(3), PREG(4));
+}
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(5), PREG(6));
+    return (opcode_t *)cur_opcode + 7;
+}
+}
+
+
+opcode_t *
+Parrot_dec_p__lt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+/* dec_p */
+{
+    VTABLE_decrement(interp, PREG(1));
+}
+/* lt_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(3));
+    if ((VTABLE_cmp(interp, PREG(2), temp) < 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        return (opcode_t *)cur_opcode + ICONST(4);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    return (opcode_t *)cur_opcode + 5;
+}
+}
+
+
 
 /*
 ** op lib descriptor:
@@ -24062,7 +24405,7 @@ op_lib_t core_op_lib = {
   3,    /* major_version */
   10,    /* minor_version */
   0,    /* patch_version */
-  1102,             /* op_count */
+  1107,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
@@ -0,0 +1,13175 @@
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/ops/core.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+
+#include "parrot/oplib/core_ops_cg.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+
+
+/* defines - Ops::Trans::CGoto */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) REG_INT(interp, cur_opcode[i])
+#define NREG(i) REG_NUM(interp, cur_opcode[i])
+#define PREG(i) REG_PMC(interp, cur_opcode[i])
+#define SREG(i) REG_STR(interp, cur_opcode[i])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+
+/* jump to the op at cur_opcode through the current segment's thread */
+#define DISPATCH_OP() goto *cg_thread[cur_opcode - cg_code_start]
+
+
+
+#include "parrot/dynext.h"
+#include "parrot/runcore_api.h"
+#include "parrot/events.h"
+#include "pmc/pmc_exception.h"
+#include "pmc/pmc_exceptionhandler.h"
+#include "pmc/pmc_continuation.h"
+#include "pmc/pmc_fixedintegerarray.h"
+#include "pmc/pmc_parrotlibrary.h"
+
+
+
+ /* Signed shift operator that is compatible with PMC shifts.  This is
+  * guaranteed to produce the same result as bitwise_left_shift_internal modulo
+  * word size, ignoring the fact that Parrot integers are always signed.  This
+  * usually gives the same answer regardless whether you shift PMC operands and
+  * then assign to an I-reg, or move the operands to I-regs and do the shift
+  * there -- except when the true result is between 2^{w-1} and 2^w (where w is
+  * the word size), in which case the high order bit is taken as the sign,
+  * giving a truncated result that is 2^w lower.
+  */
+#define bit_shift_left(number, bits) \
+    ((bits) >= 8*INTVAL_SIZE     ? 0                    \
+     : (bits) >= 0               ? (number) << (bits)   \
+     : (bits) > -8*INTVAL_SIZE   ? (number) >> -(bits)   \
+     : 0)
+
+
+#include "../io/io_private.h"
+
+
+#if PARROT_HAS_ICU
+#  include <unicode/uchar.h>
+#endif
+
+
+
+#include "parrot/scheduler_private.h"
+#include "pmc/pmc_task.h"
+
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+/*
+** Op Dispatch Function:
+*/
+
+opcode_t *
+Parrot_runops_core_ops_cg(PARROT_INTERP, ARGIN(opcode_t *cur_opcode))
+{
+    static void * const cg_op_labels[1108] = {
+        &&cg_end,                                          /*      0 */
+        &&cg_noop,                                         /*      1 */
+        &&cg_check_events,                                 /*      2 */
+        &&cg_check_events__,                               /*      3 */
+        &&cg_load_bytecode_s,                              /*      4 */
+        &&cg_load_bytecode_sc,                             /*      5 */
+        &&cg_load_bytecode_p_s,                            /*      6 */
+        &&cg_load_bytecode_p_sc,                           /*      7 */
+        &&cg_load_language_s,                              /*      8 */
+        &&cg_load_language_sc,                             /*      9 */
+        &&cg_branch_i,                                     /*     10 */
+        &&cg_branch_ic,                                    /*     11 */
+        &&cg_local_branch_p_i,                             /*     12 */
+        &&cg_local_branch_p_ic,                            /*     13 */
+        &&cg_local_return_p,                               /*     14 */
+        &&cg_jump_i,                                       /*     15 */
+        &&cg_jump_ic,                                      /*     16 */
+        &&cg_if_i_ic,                                      /*     17 */
+        &&cg_if_n_ic,                                      /*     18 */
+        &&cg_if_s_ic,                                      /*     19 */
+        &&cg_if_p_ic,                                      /*     20 */
+        &&cg_unless_i_ic,                                  /*     21 */
+        &&cg_unless_n_ic,                                  /*     22 */
+        &&cg_unless_s_ic,                                  /*     23 */
+        &&cg_unless_p_ic,                                  /*     24 */
+        &&cg_invokecc_p,                                   /*     25 */
+        &&cg_invoke_p_p,                                   /*     26 */
+        &&cg_yield,                                        /*     27 */
+        &&cg_tailcall_p,                                   /*     28 */
+        &&cg_returncc,                                     /*     29 */
+        &&cg_capture_lex_p,                                /*     30 */
+        &&cg_newclosure_p_p,                               /*     31 */
+        &&cg_set_args_pc,                                  /*     32 */
+        &&cg_get_params_pc,                                /*     33 */
+        &&cg_set_returns_pc,                               /*     34 */
+        &&cg_get_results_pc,                               /*     35 */
+        &&cg_set_result_info_p,                            /*     36 */
+        &&cg_set_result_info_pc,                           /*     37 */
+        &&cg_result_info_p,                                /*     38 */
+        &&cg_set_addr_i_ic,                                /*     39 */
+        &&cg_set_addr_p_ic,                                /*     40 */
+        &&cg_set_addr_p_i,                                 /*     41 */
+        &&cg_get_addr_i_p,                                 /*     42 */
+        &&cg_schedule_p,                                   /*     43 */
+        &&cg_addhandler_p,                                 /*     44 */
+        &&cg_push_eh_ic,                                   /*     45 */
+        &&cg_push_eh_p,                                    /*     46 */
+        &&cg_pop_eh,                                       /*     47 */
+        &&cg_throw_p,                                      /*     48 */
+        &&cg_throw_p_p,                                    /*     49 */
+        &&cg_rethrow_p,                                    /*     50 */
+        &&cg_count_eh_i,                                   /*     51 */
+        &&cg_die_s,                                        /*     52 */
+        &&cg_die_sc,                                       /*     53 */
+        &&cg_die_p,                                        /*     54 */
+        &&cg_die_pc,                                       /*     55 */
+        &&cg_die_i_i,                                      /*     56 */
+        &&cg_die_ic_i,                                     /*     57 */
+        &&cg_die_i_ic,                                     /*     58 */
+        &&cg_die_ic_ic,                                    /*     59 */
+        &&cg_exit_i,                                       /*     60 */
+        &&cg_exit_ic,                                      /*     61 */
+        &&cg_finalize_p,                                   /*     62 */
+        &&cg_finalize_pc,                                  /*     63 */
+        &&cg_pop_upto_eh_p,                                /*     64 */
+        &&cg_pop_upto_eh_pc,                               /*     65 */
+        &&cg_peek_exception_p,                             /*     66 */
+        &&cg_debug_i,                                      /*     67 */
+        &&cg_debug_ic,                                     /*     68 */
+        &&cg_bounds_i,                                     /*     69 */
+        &&cg_bounds_ic,                                    /*     70 */
+        &&cg_profile_i,                                    /*     71 */
+        &&cg_profile_ic,                                   /*     72 */
+        &&cg_trace_i,                                      /*     73 */
+        &&cg_trace_ic,                                     /*     74 */
+        &&cg_gc_debug_i,                                   /*     75 */
+        &&cg_gc_debug_ic,                                  /*     76 */
+        &&cg_interpinfo_i_i,                               /*     77 */
+        &&cg_interpinfo_i_ic,                              /*     78 */
+        &&cg_interpinfo_p_i,                               /*     79 */
+        &&cg_interpinfo_p_ic,                              /*     80 */
+        &&cg_interpinfo_s_i,                               /*     81 */
+        &&cg_interpinfo_s_ic,                              /*     82 */
+        &&cg_warningson_i,                                 /*     83 */
+        &&cg_warningson_ic,                                /*     84 */
+        &&cg_warningsoff_i,                                /*     85 */
+        &&cg_warningsoff_ic,                               /*     86 */
+        &&cg_errorson_i,                                   /*     87 */
+        &&cg_errorson_ic,                                  /*     88 */
+        &&cg_errorsoff_i,                                  /*     89 */
+        &&cg_errorsoff_ic,                                 /*     90 */
+        &&cg_set_runcore_s,                                /*     91 */
+        &&cg_set_runcore_sc,                               /*     92 */
+        &&cg_runinterp_p_i,                                /*     93 */
+        &&cg_runinterp_p_ic,                               /*     94 */
+        &&cg_getinterp_p,                                  /*     95 */
+        &&cg_sweep_ic,                                     /*     96 */
+        &&cg_collect,                                      /*     97 */
+        &&cg_sweepoff,                                     /*     98 */
+        &&cg_sweepon,                                      /*     99 */
+        &&cg_collectoff,                                   /*    100 */
+        &&cg_collecton,                                    /*    101 */
+        &&cg_needs_destroy_p,                              /*    102 */
+        &&cg_loadlib_p_s,                                  /*    103 */
+        &&cg_loadlib_p_sc,                                 /*    104 */
+        &&cg_loadlib_p_s_p,                                /*    105 */
+        &&cg_loadlib_p_sc_p,                               /*    106 */
+        &&cg_loadlib_p_s_pc,                               /*    107 */
+        &&cg_loadlib_p_sc_pc,                              /*    108 */
+        &&cg_dlfunc_p_p_s_s,                               /*    109 */
+        &&cg_dlfunc_p_p_sc_s,                              /*    110 */
+        &&cg_dlfunc_p_p_s_sc,                              /*    111 */
+        &&cg_dlfunc_p_p_sc_sc,                             /*    112 */
+        &&cg_dlfunc_p_p_s_p,                               /*    113 */
+        &&cg_dlfunc_p_p_sc_p,                              /*    114 */
+        &&cg_dlvar_p_p_s,                                  /*    115 */
+        &&cg_dlvar_p_p_sc,                                 /*    116 */
+        &&cg_compreg_s_p,                                  /*    117 */
+        &&cg_compreg_sc_p,                                 /*    118 */
+        &&cg_compreg_p_s,                                  /*    119 */
+        &&cg_compreg_p_sc,                                 /*    120 */
+        &&cg_new_callback_p_p_p_s,                         /*    121 */
+        &&cg_new_callback_p_p_p_sc,                        /*    122 */
+        &&cg_annotations_p,                                /*    123 */
+        &&cg_annotations_p_s,                              /*    124 */
+        &&cg_annotations_p_sc,                             /*    125 */
+        &&cg_band_i_i,                                     /*    126 */
+        &&cg_band_i_ic,                                    /*    127 */
+        &&cg_band_i_i_i,                                   /*    128 */
+        &&cg_band_i_ic_i,                                  /*    129 */
+        &&cg_band_i_i_ic,                                  /*    130 */
+        &&cg_bor_i_i,                                      /*    131 */
+        &&cg_bor_i_ic,                                     /*    132 */
+        &&cg_bor_i_i_i,                                    /*    133 */
+        &&cg_bor_i_ic_i,                                   /*    134 */
+        &&cg_bor_i_i_ic,                                   /*    135 */
+        &&cg_shl_i_i,                                      /*    136 */
+        &&cg_shl_i_ic,                                     /*    137 */
+        &&cg_shl_i_i_i,                                    /*    138 */
+        &&cg_shl_i_ic_i,                                   /*    139 */
+        &&cg_shl_i_i_ic,                                   /*    140 */
+        &&cg_shr_i_i,                                      /*    141 */
+        &&cg_shr_i_ic,                                     /*    142 */
+        &&cg_shr_i_i_i,                                    /*    143 */
+        &&cg_shr_i_ic_i,                                   /*    144 */
+        &&cg_shr_i_i_ic,                                   /*    145 */
+        &&cg_lsr_i_i,                                      /*    146 */
+        &&cg_lsr_i_ic,                                     /*    147 */
+        &&cg_lsr_i_i_i,                                    /*    148 */
+        &&cg_lsr_i_ic_i,                                   /*    149 */
+        &&cg_lsr_i_i_ic,                                   /*    150 */
+        &&cg_bxor_i_i,                                     /*    151 */
+        &&cg_bxor_i_ic,                                    /*    152 */
+        &&cg_bxor_i_i_i,                                   /*    153 */
+        &&cg_bxor_i_ic_i,                                  /*    154 */
+        &&cg_bxor_i_i_ic,                                  /*    155 */
+        &&cg_eq_i_i_ic,                                    /*    156 */
+        &&cg_eq_ic_i_ic,                                   /*    157 */
+        &&cg_eq_i_ic_ic,                                   /*    158 */
+        &&cg_eq_n_n_ic,                                    /*    159 */
+        &&cg_eq_nc_n_ic,                                   /*    160 */
+        &&cg_eq_n_nc_ic,                                   /*    161 */
+        &&cg_eq_s_s_ic,                                    /*    162 */
+        &&cg_eq_sc_s_ic,                                   /*    163 */
+        &&cg_eq_s_sc_ic,                                   /*    164 */
+        &&cg_eq_p_p_ic,                                    /*    165 */
+        &&cg_eq_p_i_ic,                                    /*    166 */
+        &&cg_eq_p_ic_ic,                                   /*    167 */
+        &&cg_eq_p_n_ic,                                    /*    168 */
+        &&cg_eq_p_nc_ic,                                   /*    169 */
+        &&cg_eq_p_s_ic,                                    /*    170 */
+        &&cg_eq_p_sc_ic,                                   /*    171 */
+        &&cg_eq_str_p_p_ic,                                /*    172 */
+        &&cg_eq_num_p_p_ic,                                /*    173 */
+        &&cg_eq_addr_s_s_ic,                               /*    174 */
+        &&cg_eq_addr_sc_s_ic,                              /*    175 */
+        &&cg_eq_addr_s_sc_ic,                              /*    176 */
+        &&cg_eq_addr_sc_sc_ic,                             /*    177 */
+        &&cg_eq_addr_p_p_ic,                               /*    178 */
+        &&cg_ne_i_i_ic,                                    /*    179 */
+        &&cg_ne_ic_i_ic,                                   /*    180 */
+        &&cg_ne_i_ic_ic,                                   /*    181 */
+        &&cg_ne_n_n_ic,                                    /*    182 */
+        &&cg_ne_nc_n_ic,                                   /*    183 */
+        &&cg_ne_n_nc_ic,                                   /*    184 */
+        &&cg_ne_s_s_ic,                                    /*    185 */
+        &&cg_ne_sc_s_ic,                                   /*    186 */
+        &&cg_ne_s_sc_ic,                                   /*    187 */
+        &&cg_ne_p_p_ic,                                    /*    188 */
+        &&cg_ne_p_i_ic,                                    /*    189 */
+        &&cg_ne_p_ic_ic,                                   /*    190 */
+        &&cg_ne_p_n_ic,                                    /*    191 */
+        &&cg_ne_p_nc_ic,                                   /*    192 */
+        &&cg_ne_p_s_ic,                                    /*    193 */
+        &&cg_ne_p_sc_ic,                                   /*    194 */
+        &&cg_ne_str_p_p_ic,                                /*    195 */
+        &&cg_ne_num_p_p_ic,                                /*    196 */
+        &&cg_ne_addr_s_s_ic,                               /*    197 */
+        &&cg_ne_addr_sc_s_ic,                              /*    198 */
+        &&cg_ne_addr_s_sc_ic,                              /*    199 */
+        &&cg_ne_addr_sc_sc_ic,                             /*    200 */
+        &&cg_ne_addr_p_p_ic,                               /*    201 */
+        &&cg_lt_i_i_ic,                                    /*    202 */
+        &&cg_lt_ic_i_ic,                                   /*    203 */
+        &&cg_lt_i_ic_ic,                                   /*    204 */
+        &&cg_lt_n_n_ic,                                    /*    205 */
+        &&cg_lt_nc_n_ic,                                   /*    206 */
+        &&cg_lt_n_nc_ic,                                   /*    207 */
+        &&cg_lt_s_s_ic,                                    /*    208 */
+        &&cg_lt_sc_s_ic,                                   /*    209 */
+        &&cg_lt_s_sc_ic,                                   /*    210 */
+        &&cg_lt_p_p_ic,                                    /*    211 */
+        &&cg_lt_p_i_ic,                                    /*    212 */
+        &&cg_lt_p_ic_ic,                                   /*    213 */
+        &&cg_lt_p_n_ic,                                    /*    214 */
+        &&cg_lt_p_nc_ic,                                   /*    215 */
+        &&cg_lt_p_s_ic,                                    /*    216 */
+        &&cg_lt_p_sc_ic,                                   /*    217 */
+        &&cg_lt_str_p_p_ic,                                /*    218 */
+        &&cg_lt_num_p_p_ic,                                /*    219 */
+        &&cg_le_i_i_ic,                                    /*    220 */
+        &&cg_le_ic_i_ic,                                   /*    221 */
+        &&cg_le_i_ic_ic,                                   /*    222 */
+        &&cg_le_n_n_ic,                                    /*    223 */
+        &&cg_le_nc_n_ic,                                   /*    224 */
+        &&cg_le_n_nc_ic,                                   /*    225 */
+        &&cg_le_s_s_ic,                                    /*    226 */
+        &&cg_le_sc_s_ic,                                   /*    227 */
+        &&cg_le_s_sc_ic,                                   /*    228 */
+        &&cg_le_p_p_ic,                                    /*    229 */
+        &&cg_le_p_i_ic,                                    /*    230 */
+        &&cg_le_p_ic_ic,                                   /*    231 */
+        &&cg_le_p_n_ic,                                    /*    232 */
+        &&cg_le_p_nc_ic,                                   /*    233 */
+        &&cg_le_p_s_ic,                                    /*    234 */
+        &&cg_le_p_sc_ic,                                   /*    235 */
+        &&cg_le_str_p_p_ic,                                /*    236 */
+        &&cg_le_num_p_p_ic,                                /*    237 */
+        &&cg_gt_p_p_ic,                                    /*    238 */
+        &&cg_gt_p_i_ic,                                    /*    239 */
+        &&cg_gt_p_ic_ic,                                   /*    240 */
+        &&cg_gt_p_n_ic,                                    /*    241 */
+        &&cg_gt_p_nc_ic,                                   /*    242 */
+        &&cg_gt_p_s_ic,                                    /*    243 */
+        &&cg_gt_p_sc_ic,                                   /*    244 */
+        &&cg_gt_str_p_p_ic,                                /*    245 */
+        &&cg_gt_num_p_p_ic,                                /*    246 */
+        &&cg_ge_p_p_ic,                                    /*    247 */
+        &&cg_ge_p_i_ic,                                    /*    248 */
+        &&cg_ge_p_ic_ic,                                   /*    249 */
+        &&cg_ge_p_n_ic,                                    /*    250 */
+        &&cg_ge_p_nc_ic,                                   /*    251 */
+        &&cg_ge_p_s_ic,                                    /*    252 */
+        &&cg_ge_p_sc_ic,                                   /*    253 */
+        &&cg_ge_str_p_p_ic,                                /*    254 */
+        &&cg_ge_num_p_p_ic,                                /*    255 */
+        &&cg_if_null_p_ic,                                 /*    256 */
+        &&cg_if_null_s_ic,                                 /*    257 */
+        &&cg_unless_null_p_ic,                             /*    258 */
+        &&cg_unless_null_s_ic,                             /*    259 */
+        &&cg_cmp_i_i_i,                                    /*    260 */
+        &&cg_cmp_i_ic_i,                                   /*    261 */
+        &&cg_cmp_i_i_ic,                                   /*    262 */
+        &&cg_cmp_i_n_n,                                    /*    263 */
+        &&cg_cmp_i_nc_n,                                   /*    264 */
+        &&cg_cmp_i_n_nc,                                   /*    265 */
+        &&cg_cmp_i_s_s,                                    /*    266 */
+        &&cg_cmp_i_sc_s,                                   /*    267 */
+        &&cg_cmp_i_s_sc,                                   /*    268 */
+        &&cg_cmp_i_p_p,                                    /*    269 */
+        &&cg_cmp_i_p_i,                                    /*    270 */
+        &&cg_cmp_i_p_ic,                                   /*    271 */
+        &&cg_cmp_i_p_n,                                    /*    272 */
+        &&cg_cmp_i_p_nc,                                   /*    273 */
+        &&cg_cmp_i_p_s,                                    /*    274 */
+        &&cg_cmp_i_p_sc,                                   /*    275 */
+        &&cg_cmp_str_i_p_p,                                /*    276 */
+        &&cg_cmp_num_i_p_p,                                /*    277 */
+        &&cg_cmp_pmc_p_p_p,                                /*    278 */
+        &&cg_issame_i_p_p,                                 /*    279 */
+        &&cg_issame_i_s_s,                                 /*    280 */
+        &&cg_issame_i_sc_s,                                /*    281 */
+        &&cg_issame_i_s_sc,                                /*    282 */
+        &&cg_issame_i_sc_sc,                               /*    283 */
+        &&cg_isntsame_i_p_p,                               /*    284 */
+        &&cg_isntsame_i_s_s,                               /*    285 */
+        &&cg_isntsame_i_sc_s,                              /*    286 */
+        &&cg_isntsame_i_s_sc,                              /*    287 */
+        &&cg_isntsame_i_sc_sc,                             /*    288 */
+        &&cg_istrue_i_p,                                   /*    289 */
+        &&cg_isfalse_i_p,                                  /*    290 */
+        &&cg_isnull_i_p,                                   /*    291 */
+        &&cg_isnull_i_pc,                                  /*    292 */
+        &&cg_isnull_i_s,                                   /*    293 */
+        &&cg_isnull_i_sc,                                  /*    294 */
+        &&cg_isgt_i_p_p,                                   /*    295 */
+        &&cg_isge_i_p_p,                                   /*    296 */
+        &&cg_isle_i_i_i,                                   /*    297 */
+        &&cg_isle_i_ic_i,                                  /*    298 */
+        &&cg_isle_i_i_ic,                                  /*    299 */
+        &&cg_isle_i_n_n,                                   /*    300 */
+        &&cg_isle_i_nc_n,                                  /*    301 */
+        &&cg_isle_i_n_nc,                                  /*    302 */
+        &&cg_isle_i_s_s,                                   /*    303 */
+        &&cg_isle_i_sc_s,                                  /*    304 */
+        &&cg_isle_i_s_sc,                                  /*    305 */
+        &&cg_isle_i_p_p,                                   /*    306 */
+        &&cg_islt_i_i_i,                                   /*    307 */
+        &&cg_islt_i_ic_i,                                  /*    308 */
+        &&cg_islt_i_i_ic,                                  /*    309 */
+        &&cg_islt_i_n_n,                                   /*    310 */
+        &&cg_islt_i_nc_n,                                  /*    311 */
+        &&cg_islt_i_n_nc,                                  /*    312 */
+        &&cg_islt_i_s_s,                                   /*    313 */
+        &&cg_islt_i_sc_s,                                  /*    314 */
+        &&cg_islt_i_s_sc,                                  /*    315 */
+        &&cg_islt_i_p_p,                                   /*    316 */
+        &&cg_iseq_i_i_i,                                   /*    317 */
+        &&cg_iseq_i_ic_i,                                  /*    318 */
+        &&cg_iseq_i_i_ic,                                  /*    319 */
+        &&cg_iseq_i_n_n,                                   /*    320 */
+        &&cg_iseq_i_nc_n,                                  /*    321 */
+        &&cg_iseq_i_n_nc,                                  /*    322 */
+        &&cg_iseq_i_s_s,                                   /*    323 */
+        &&cg_iseq_i_sc_s,                                  /*    324 */
+        &&cg_iseq_i_s_sc,                                  /*    325 */
+        &&cg_iseq_i_p_p,                                   /*    326 */
+        &&cg_isne_i_i_i,                                   /*    327 */
+        &&cg_isne_i_ic_i,                                  /*    328 */
+        &&cg_isne_i_i_ic,                                  /*    329 */
+        &&cg_isne_i_n_n,                                   /*    330 */
+        &&cg_isne_i_nc_n,                                  /*    331 */
+        &&cg_isne_i_n_nc,                                  /*    332 */
+        &&cg_isne_i_s_s,                                   /*    333 */
+        &&cg_isne_i_sc_s,                                  /*    334 */
+        &&cg_isne_i_s_sc,                                  /*    335 */
+        &&cg_isne_i_p_p,                                   /*    336 */
+        &&cg_and_i_i_i,                                    /*    337 */
+        &&cg_and_i_ic_i,                                   /*    338 */
+        &&cg_and_i_i_ic,                                   /*    339 */
+        &&cg_and_p_p_p,                                    /*    340 */
+        &&cg_not_i,                                        /*    341 */
+        &&cg_not_i_i,                                      /*    342 */
+        &&cg_not_p,                                        /*    343 */
+        &&cg_not_p_p,                                      /*    344 */
+        &&cg_or_i_i_i,                                     /*    345 */
+        &&cg_or_i_ic_i,                                    /*    346 */
+        &&cg_or_i_i_ic,                                    /*    347 */
+        &&cg_or_p_p_p,                                     /*    348 */
+        &&cg_xor_i_i_i,                                    /*    349 */
+        &&cg_xor_i_ic_i,                                   /*    350 */
+        &&cg_xor_i_i_ic,                                   /*    351 */
+        &&cg_xor_p_p_p,                                    /*    352 */
+        &&cg_print_i,                                      /*    353 */
+        &&cg_print_ic,                                     /*    354 */
+        &&cg_print_n,                                      /*    355 */
+        &&cg_print_nc,                                     /*    356 */
+        &&cg_print_s,                                      /*    357 */
+        &&cg_print_sc,                                     /*    358 */
+        &&cg_print_p,                                      /*    359 */
+        &&cg_say_i,                                        /*    360 */
+        &&cg_say_ic,                                       /*    361 */
+        &&cg_say_n,                                        /*    362 */
+        &&cg_say_nc,                                       /*    363 */
+        &&cg_say_s,                                        /*    364 */
+        &&cg_say_sc,                                       /*    365 */
+        &&cg_say_p,                                        /*    366 */
+        &&cg_print_p_i,                                    /*    367 */
+        &&cg_print_p_ic,                                   /*    368 */
+        &&cg_print_p_n,                                    /*    369 */
+        &&cg_print_p_nc,                                   /*    370 */
+        &&cg_print_p_s,                                    /*    371 */
+        &&cg_print_p_sc,                                   /*    372 */
+        &&cg_print_p_p,                                    /*    373 */
+        &&cg_getstdin_p,                                   /*    374 */
+        &&cg_getstdout_p,                                  /*    375 */
+        &&cg_getstderr_p,                                  /*    376 */
+        &&cg_abs_i,                                        /*    377 */
+        &&cg_abs_n,                                        /*    378 */
+        &&cg_abs_i_i,                                      /*    379 */
+        &&cg_abs_n_n,                                      /*    380 */
+        &&cg_abs_p,                                        /*    381 */
+        &&cg_abs_p_p,                                      /*    382 */
+        &&cg_add_i_i,                                      /*    383 */
+        &&cg_add_i_ic,                                     /*    384 */
+        &&cg_add_n_n,                                      /*    385 */
+        &&cg_add_n_nc,                                     /*    386 */
+        &&cg_add_p_p,                                      /*    387 */
+        &&cg_add_p_i,                                      /*    388 */
+        &&cg_add_p_ic,                                     /*    389 */
+        &&cg_add_p_n,                                      /*    390 */
+        &&cg_add_p_nc,                                     /*    391 */
+        &&cg_add_i_i_i,                                    /*    392 */
+        &&cg_add_i_ic_i,                                   /*    393 */
+        &&cg_add_i_i_ic,                                   /*    394 */
+        &&cg_add_n_n_n,                                    /*    395 */
+        &&cg_add_n_nc_n,                                   /*    396 */
+        &&cg_add_n_n_nc,                                   /*    397 */
+        &&cg_add_p_p_p,                                    /*    398 */
+        &&cg_add_p_p_i,                                    /*    399 */
+        &&cg_add_p_p_ic,                                   /*    400 */
+        &&cg_add_p_p_n,                                    /*    401 */
+        &&cg_add_p_p_nc,                                   /*    402 */
+        &&cg_dec_i,                                        /*    403 */
+        &&cg_dec_n,                                        /*    404 */
+        &&cg_dec_p,                                        /*    405 */
+        &&cg_div_i_i,                                      /*    406 */
+        &&cg_div_i_ic,                                     /*    407 */
+        &&cg_div_n_n,                                      /*    408 */
+        &&cg_div_n_nc,                                     /*    409 */
+        &&cg_div_p_p,                                      /*    410 */
+        &&cg_div_p_i,                                      /*    411 */
+        &&cg_div_p_ic,                                     /*    412 */
+        &&cg_div_p_n,                                      /*    413 */
+        &&cg_div_p_nc,                                     /*    414 */
+        &&cg_div_i_i_i,                                    /*    415 */
+        &&cg_div_i_ic_i,                                   /*    416 */
+        &&cg_div_i_i_ic,                                   /*    417 */
+        &&cg_div_i_ic_ic,                                  /*    418 */
+        &&cg_div_n_n_n,                                    /*    419 */
+        &&cg_div_n_nc_n,                                   /*    420 */
+        &&cg_div_n_n_nc,                                   /*    421 */
+        &&cg_div_n_nc_nc,                                  /*    422 */
+        &&cg_div_p_p_p,                                    /*    423 */
+        &&cg_div_p_p_i,                                    /*    424 */
+        &&cg_div_p_p_ic,                                   /*    425 */
+        &&cg_div_p_p_n,                                    /*    426 */
+        &&cg_div_p_p_nc,                                   /*    427 */
+        &&cg_fdiv_i_i,                                     /*    428 */
+        &&cg_fdiv_i_ic,                                    /*    429 */
+        &&cg_fdiv_n_n,                                     /*    430 */
+        &&cg_fdiv_n_nc,                                    /*    431 */
+        &&cg_fdiv_p_p,                                     /*    432 */
+        &&cg_fdiv_p_i,                                     /*    433 */
+        &&cg_fdiv_p_ic,                                    /*    434 */
+        &&cg_fdiv_p_n,                                     /*    435 */
+        &&cg_fdiv_p_nc,                                    /*    436 */
+        &&cg_fdiv_i_i_i,                                   /*    437 */
+        &&cg_fdiv_i_ic_i,                                  /*    438 */
+        &&cg_fdiv_i_i_ic,                                  /*    439 */
+        &&cg_fdiv_n_n_n,                                   /*    440 */
+        &&cg_fdiv_n_nc_n,                                  /*    441 */
+        &&cg_fdiv_n_n_nc,                                  /*    442 */
+        &&cg_fdiv_p_p_p,                                   /*    443 */
+        &&cg_fdiv_p_p_i,                                   /*    444 */
+        &&cg_fdiv_p_p_ic,                                  /*    445 */
+        &&cg_fdiv_p_p_n,                                   /*    446 */
+        &&cg_fdiv_p_p_nc,                                  /*    447 */
+        &&cg_ceil_n,                                       /*    448 */
+        &&cg_ceil_i_n,                                     /*    449 */
+        &&cg_ceil_n_n,                                     /*    450 */
+        &&cg_floor_n,                                      /*    451 */
+        &&cg_floor_i_n,                                    /*    452 */
+        &&cg_floor_n_n,                                    /*    453 */
+        &&cg_inc_i,                                        /*    454 */
+        &&cg_inc_n,                                        /*    455 */
+        &&cg_inc_p,                                        /*    456 */
+        &&cg_mod_i_i,                                      /*    457 */
+        &&cg_mod_i_ic,                                     /*    458 */
+        &&cg_mod_n_n,                                      /*    459 */
+        &&cg_mod_n_nc,                                     /*    460 */
+        &&cg_mod_p_p,                                      /*    461 */
+        &&cg_mod_p_i,                                      /*    462 */
+        &&cg_mod_p_ic,                                     /*    463 */
+        &&cg_mod_p_n,                                      /*    464 */
+        &&cg_mod_p_nc,                                     /*    465 */
+        &&cg_mod_i_i_i,                                    /*    466 */
+        &&cg_mod_i_ic_i,                                   /*    467 */
+        &&cg_mod_i_i_ic,                                   /*    468 */
+        &&cg_mod_n_n_n,                                    /*    469 */
+        &&cg_mod_n_nc_n,                                   /*    470 */
+        &&cg_mod_n_n_nc,                                   /*    471 */
+        &&cg_mod_p_p_p,                                    /*    472 */
+        &&cg_mod_p_p_i,                                    /*    473 */
+        &&cg_mod_p_p_ic,                                   /*    474 */
+        &&cg_mod_p_p_n,                                    /*    475 */
+        &&cg_mod_p_p_nc,                                   /*    476 */
+        &&cg_mul_i_i,                                      /*    477 */
+        &&cg_mul_i_ic,                                     /*    478 */
+        &&cg_mul_n_n,                                      /*    479 */
+        &&cg_mul_n_nc,                                     /*    480 */
+        &&cg_mul_p_p,                                      /*    481 */
+        &&cg_mul_p_i,                                      /*    482 */
+        &&cg_mul_p_ic,                                     /*    483 */
+        &&cg_mul_p_n,                                      /*    484 */
+        &&cg_mul_p_nc,                                     /*    485 */
+        &&cg_mul_i_i_i,                                    /*    486 */
+        &&cg_mul_i_ic_i,                                   /*    487 */
+        &&cg_mul_i_i_ic,                                   /*    488 */
+        &&cg_mul_n_n_n,                                    /*    489 */
+        &&cg_mul_n_nc_n,                                   /*    490 */
+        &&cg_mul_n_n_nc,                                   /*    491 */
+        &&cg_mul_p_p_p,                                    /*    492 */
+        &&cg_mul_p_p_i,                                    /*    493 */
+        &&cg_mul_p_p_ic,                                   /*    494 */
+        &&cg_mul_p_p_n,                                    /*    495 */
+        &&cg_mul_p_p_nc,                                   /*    496 */
+        &&cg_neg_i,                                        /*    497 */
+        &&cg_neg_n,                                        /*    498 */
+        &&cg_neg_p,                                        /*    499 */
+        &&cg_neg_i_i,                                      /*    500 */
+        &&cg_neg_n_n,                                      /*    501 */
+        &&cg_neg_p_p,                                      /*    502 */
+        &&cg_sub_i_i,                                      /*    503 */
+        &&cg_sub_i_ic,                                     /*    504 */
+        &&cg_sub_n_n,                                      /*    505 */
+        &&cg_sub_n_nc,                                     /*    506 */
+        &&cg_sub_p_p,                                      /*    507 */
+        &&cg_sub_p_i,                                      /*    508 */
+        &&cg_sub_p_ic,                                     /*    509 */
+        &&cg_sub_p_n,                                      /*    510 */
+        &&cg_sub_p_nc,                                     /*    511 */
+        &&cg_sub_i_i_i,                                    /*    512 */
+        &&cg_sub_i_ic_i,                                   /*    513 */
+        &&cg_sub_i_i_ic,                                   /*    514 */
+        &&cg_sub_n_n_n,                                    /*    515 */
+        &&cg_sub_n_nc_n,                                   /*    516 */
+        &&cg_sub_n_n_nc,                                   /*    517 */
+        &&cg_sub_p_p_p,                                    /*    518 */
+        &&cg_sub_p_p_i,                                    /*    519 */
+        &&cg_sub_p_p_ic,                                   /*    520 */
+        &&cg_sub_p_p_n,                                    /*    521 */
+        &&cg_sub_p_p_nc,                                   /*    522 */
+        &&cg_sqrt_n_n,                                     /*    523 */
+        &&cg_callmethodcc_p_s,                             /*    524 */
+        &&cg_callmethodcc_p_sc,                            /*    525 */
+        &&cg_callmethodcc_p_p,                             /*    526 */
+        &&cg_callmethod_p_s_p,                             /*    527 */
+        &&cg_callmethod_p_sc_p,                            /*    528 */
+        &&cg_callmethod_p_p_p,                             /*    529 */
+        &&cg_tailcallmethod_p_s,                           /*    530 */
+        &&cg_tailcallmethod_p_sc,                          /*    531 */
+        &&cg_tailcallmethod_p_p,                           /*    532 */
+        &&cg_addmethod_p_s_p,                              /*    533 */
+        &&cg_addmethod_p_sc_p,                             /*    534 */
+        &&cg_can_i_p_s,                                    /*    535 */
+        &&cg_can_i_p_sc,                                   /*    536 */
+        &&cg_does_i_p_s,                                   /*    537 */
+        &&cg_does_i_p_sc,                                  /*    538 */
+        &&cg_does_i_p_p,                                   /*    539 */
+        &&cg_does_i_p_pc,                                  /*    540 */
+        &&cg_isa_i_p_s,                                    /*    541 */
+        &&cg_isa_i_p_sc,                                   /*    542 */
+        &&cg_isa_i_p_p,                                    /*    543 */
+        &&cg_isa_i_p_pc,                                   /*    544 */
+        &&cg_newclass_p_s,                                 /*    545 */
+        &&cg_newclass_p_sc,                                /*    546 */
+        &&cg_newclass_p_p,                                 /*    547 */
+        &&cg_newclass_p_pc,                                /*    548 */
+        &&cg_subclass_p_p,                                 /*    549 */
+        &&cg_subclass_p_pc,                                /*    550 */
+        &&cg_subclass_p_p_s,                               /*    551 */
+        &&cg_subclass_p_pc_s,                              /*    552 */
+        &&cg_subclass_p_p_sc,                              /*    553 */
+        &&cg_subclass_p_pc_sc,                             /*    554 */
+        &&cg_subclass_p_p_p,                               /*    555 */
+        &&cg_subclass_p_pc_p,                              /*    556 */
+        &&cg_subclass_p_p_pc,                              /*    557 */
+        &&cg_subclass_p_pc_pc,                             /*    558 */
+        &&cg_subclass_p_s,                                 /*    559 */
+        &&cg_subclass_p_sc,                                /*    560 */
+        &&cg_subclass_p_s_s,                               /*    561 */
+        &&cg_subclass_p_sc_s,                              /*    562 */
+        &&cg_subclass_p_s_sc,                              /*    563 */
+        &&cg_subclass_p_sc_sc,                             /*    564 */
+        &&cg_subclass_p_s_p,                               /*    565 */
+        &&cg_subclass_p_sc_p,                              /*    566 */
+        &&cg_subclass_p_s_pc,                              /*    567 */
+        &&cg_subclass_p_sc_pc,                             /*    568 */
+        &&cg_get_class_p_s,                                /*    569 */
+        &&cg_get_class_p_sc,                               /*    570 */
+        &&cg_get_class_p_p,                                /*    571 */
+        &&cg_get_class_p_pc,                               /*    572 */
+        &&cg_class_p_p,                                    /*    573 */
+        &&cg_addparent_p_p,                                /*    574 */
+        &&cg_removeparent_p_p,                             /*    575 */
+        &&cg_addrole_p_p,                                  /*    576 */
+        &&cg_addattribute_p_s,                             /*    577 */
+        &&cg_addattribute_p_sc,                            /*    578 */
+        &&cg_removeattribute_p_s,                          /*    579 */
+        &&cg_removeattribute_p_sc,                         /*    580 */
+        &&cg_getattribute_p_p_s,                           /*    581 */
+        &&cg_getattribute_p_p_sc,                          /*    582 */
+        &&cg_getattribute_p_p_p_s,                         /*    583 */
+        &&cg_getattribute_p_p_pc_s,                        /*    584 */
+        &&cg_getattribute_p_p_p_sc,                        /*    585 */
+        &&cg_getattribute_p_p_pc_sc,                       /*    586 */
+        &&cg_setattribute_p_s_p,                           /*    587 */
+        &&cg_setattribute_p_sc_p,                          /*    588 */
+        &&cg_setattribute_p_p_s_p,                         /*    589 */
+        &&cg_setattribute_p_pc_s_p,                        /*    590 */
+        &&cg_setattribute_p_p_sc_p,                        /*    591 */
+        &&cg_setattribute_p_pc_sc_p,                       /*    592 */
+        &&cg_inspect_p_p,                                  /*    593 */
+        &&cg_inspect_p_pc,                                 /*    594 */
+        &&cg_inspect_p_p_s,                                /*    595 */
+        &&cg_inspect_p_pc_s,                               /*    596 */
+        &&cg_inspect_p_p_sc,                               /*    597 */
+        &&cg_inspect_p_pc_sc,                              /*    598 */
+        &&cg_new_p_s,                                      /*    599 */
+        &&cg_new_p_sc,                                     /*    600 */
+        &&cg_new_p_s_p,                                    /*    601 */
+        &&cg_new_p_sc_p,                                   /*    602 */
+        &&cg_new_p_s_pc,                                   /*    603 */
+        &&cg_new_p_sc_pc,                                  /*    604 */
+        &&cg_new_p_p,                                      /*    605 */
+        &&cg_new_p_pc,                                     /*    606 */
+        &&cg_new_p_p_p,                                    /*    607 */
+        &&cg_new_p_pc_p,                                   /*    608 */
+        &&cg_new_p_p_pc,                                   /*    609 */
+        &&cg_new_p_pc_pc,                                  /*    610 */
+        &&cg_root_new_p_p,                                 /*    611 */
+        &&cg_root_new_p_pc,                                /*    612 */
+        &&cg_root_new_p_p_p,                               /*    613 */
+        &&cg_root_new_p_pc_p,                              /*    614 */
+        &&cg_root_new_p_p_pc,                              /*    615 */
+        &&cg_root_new_p_pc_pc,                             /*    616 */
+        &&cg_typeof_s_p,                                   /*    617 */
+        &&cg_typeof_p_p,                                   /*    618 */
+        &&cg_get_repr_s_p,                                 /*    619 */
+        &&cg_find_method_p_p_s,                            /*    620 */
+        &&cg_find_method_p_p_sc,                           /*    621 */
+        &&cg_defined_i_p,                                  /*    622 */
+        &&cg_defined_i_p_ki,                               /*    623 */
+        &&cg_defined_i_p_kic,                              /*    624 */
+        &&cg_defined_i_p_k,                                /*    625 */
+        &&cg_defined_i_p_kc,                               /*    626 */
+        &&cg_exists_i_p_ki,                                /*    627 */
+        &&cg_exists_i_p_kic,                               /*    628 */
+        &&cg_exists_i_p_k,                                 /*    629 */
+        &&cg_exists_i_p_kc,                                /*    630 */
+        &&cg_delete_p_k,                                   /*    631 */
+        &&cg_delete_p_kc,                                  /*    632 */
+        &&cg_delete_p_ki,                                  /*    633 */
+        &&cg_delete_p_kic,                                 /*    634 */
+        &&cg_elements_i_p,                                 /*    635 */
+        &&cg_push_p_i,                                     /*    636 */
+        &&cg_push_p_ic,                                    /*    637 */
+        &&cg_push_p_n,                                     /*    638 */
+        &&cg_push_p_nc,                                    /*    639 */
+        &&cg_push_p_s,                                     /*    640 */
+        &&cg_push_p_sc,                                    /*    641 */
+        &&cg_push_p_p,                                     /*    642 */
+        &&cg_pop_i_p,                                      /*    643 */
+        &&cg_pop_n_p,                                      /*    644 */
+        &&cg_pop_s_p,                                      /*    645 */
+        &&cg_pop_p_p,                                      /*    646 */
+        &&cg_unshift_p_i,                                  /*    647 */
+        &&cg_unshift_p_ic,                                 /*    648 */
+        &&cg_unshift_p_n,                                  /*    649 */
+        &&cg_unshift_p_nc,                                 /*    650 */
+        &&cg_unshift_p_s,                                  /*    651 */
+        &&cg_unshift_p_sc,                                 /*    652 */
+        &&cg_unshift_p_p,                                  /*    653 */
+        &&cg_shift_i_p,                                    /*    654 */
+        &&cg_shift_n_p,                                    /*    655 */
+        &&cg_shift_s_p,                                    /*    656 */
+        &&cg_shift_p_p,                                    /*    657 */
+        &&cg_splice_p_p_i_i,                               /*    658 */
+        &&cg_splice_p_p_ic_i,                              /*    659 */
+        &&cg_splice_p_p_i_ic,                              /*    660 */
+        &&cg_splice_p_p_ic_ic,                             /*    661 */
+        &&cg_setprop_p_s_p,                                /*    662 */
+        &&cg_setprop_p_sc_p,                               /*    663 */
+        &&cg_getprop_p_s_p,                                /*    664 */
+        &&cg_getprop_p_sc_p,                               /*    665 */
+        &&cg_delprop_p_s,                                  /*    666 */
+        &&cg_delprop_p_sc,                                 /*    667 */
+        &&cg_prophash_p_p,                                 /*    668 */
+        &&cg_freeze_s_p,                                   /*    669 */
+        &&cg_thaw_p_s,                                     /*    670 */
+        &&cg_thaw_p_sc,                                    /*    671 */
+        &&cg_add_multi_s_s_p,                              /*    672 */
+        &&cg_add_multi_sc_s_p,                             /*    673 */
+        &&cg_add_multi_s_sc_p,                             /*    674 */
+        &&cg_add_multi_sc_sc_p,                            /*    675 */
+        &&cg_find_multi_p_s_s,                             /*    676 */
+        &&cg_find_multi_p_sc_s,                            /*    677 */
+        &&cg_find_multi_p_s_sc,                            /*    678 */
+        &&cg_find_multi_p_sc_sc,                           /*    679 */
+        &&cg_register_p,                                   /*    680 */
+        &&cg_unregister_p,                                 /*    681 */
+        &&cg_box_p_i,                                      /*    682 */
+        &&cg_box_p_ic,                                     /*    683 */
+        &&cg_box_p_n,                                      /*    684 */
+        &&cg_box_p_nc,                                     /*    685 */
+        &&cg_box_p_s,                                      /*    686 */
+        &&cg_box_p_sc,                                     /*    687 */
+        &&cg_iter_p_p,                                     /*    688 */
+        &&cg_morph_p_p,                                    /*    689 */
+        &&cg_morph_p_pc,                                   /*    690 */
+        &&cg_clone_s_s,                                    /*    691 */
+        &&cg_clone_s_sc,                                   /*    692 */
+        &&cg_set_i_i,                                      /*    693 */
+        &&cg_set_i_ic,                                     /*    694 */
+        &&cg_set_i_n,                                      /*    695 */
+        &&cg_set_i_nc,                                     /*    696 */
+        &&cg_set_i_s,                                      /*    697 */
+        &&cg_set_i_sc,                                     /*    698 */
+        &&cg_set_n_n,                                      /*    699 */
+        &&cg_set_n_nc,                                     /*    700 */
+        &&cg_set_n_i,                                      /*    701 */
+        &&cg_set_n_ic,                                     /*    702 */
+        &&cg_set_n_s,                                      /*    703 */
+        &&cg_set_n_sc,                                     /*    704 */
+        &&cg_set_n_p,                                      /*    705 */
+        &&cg_set_s_p,                                      /*    706 */
+        &&cg_set_s_s,                                      /*    707 */
+        &&cg_set_s_sc,                                     /*    708 */
+        &&cg_set_s_i,                                      /*    709 */
+        &&cg_set_s_ic,                                     /*    710 */
+        &&cg_set_s_n,                                      /*    711 */
+        &&cg_set_s_nc,                                     /*    712 */
+        &&cg_set_p_pc,                                     /*    713 */
+        &&cg_set_p_p,                                      /*    714 */
+        &&cg_set_p_i,                                      /*    715 */
+        &&cg_set_p_ic,                                     /*    716 */
+        &&cg_set_p_n,                                      /*    717 */
+        &&cg_set_p_nc,                                     /*    718 */
+        &&cg_set_p_s,                                      /*    719 */
+        &&cg_set_p_sc,                                     /*    720 */
+        &&cg_set_i_p,                                      /*    721 */
+        &&cg_assign_p_p,                                   /*    722 */
+        &&cg_assign_p_i,                                   /*    723 */
+        &&cg_assign_p_ic,                                  /*    724 */
+        &&cg_assign_p_n,                                   /*    725 */
+        &&cg_assign_p_nc,                                  /*    726 */
+        &&cg_assign_p_s,                                   /*    727 */
+        &&cg_assign_p_sc,                                  /*    728 */
+        &&cg_assign_s_s,                                   /*    729 */
+        &&cg_assign_s_sc,                                  /*    730 */
+        &&cg_setref_p_p,                                   /*    731 */
+        &&cg_deref_p_p,                                    /*    732 */
+        &&cg_set_p_ki_i,                                   /*    733 */
+        &&cg_set_p_kic_i,                                  /*    734 */
+        &&cg_set_p_ki_ic,                                  /*    735 */
+        &&cg_set_p_kic_ic,                                 /*    736 */
+        &&cg_set_p_ki_n,                                   /*    737 */
+        &&cg_set_p_kic_n,                                  /*    738 */
+        &&cg_set_p_ki_nc,                                  /*    739 */
+        &&cg_set_p_kic_nc,                                 /*    740 */
+        &&cg_set_p_ki_s,                                   /*    741 */
+        &&cg_set_p_kic_s,                                  /*    742 */
+        &&cg_set_p_ki_sc,                                  /*    743 */
+        &&cg_set_p_kic_sc,                                 /*    744 */
+        &&cg_set_p_ki_p,                                   /*    745 */
+        &&cg_set_p_kic_p,                                  /*    746 */
+        &&cg_set_i_p_ki,                                   /*    747 */
+        &&cg_set_i_p_kic,                                  /*    748 */
+        &&cg_set_n_p_ki,                                   /*    749 */
+        &&cg_set_n_p_kic,                                  /*    750 */
+        &&cg_set_s_p_ki,                                   /*    751 */
+        &&cg_set_s_p_kic,                                  /*    752 */
+        &&cg_set_p_p_ki,                                   /*    753 */
+        &&cg_set_p_p_kic,                                  /*    754 */
+        &&cg_set_p_k_i,                                    /*    755 */
+        &&cg_set_p_kc_i,                                   /*    756 */
+        &&cg_set_p_k_ic,                                   /*    757 */
+        &&cg_set_p_kc_ic,                                  /*    758 */
+        &&cg_set_p_k_n,                                    /*    759 */
+        &&cg_set_p_kc_n,                                   /*    760 */
+        &&cg_set_p_k_nc,                                   /*    761 */
+        &&cg_set_p_kc_nc,                                  /*    762 */
+        &&cg_set_p_k_s,                                    /*    763 */
+        &&cg_set_p_kc_s,                                   /*    764 */
+        &&cg_set_p_k_sc,                                   /*    765 */
+        &&cg_set_p_kc_sc,                                  /*    766 */
+        &&cg_set_p_k_p,                                    /*    767 */
+        &&cg_set_p_kc_p,                                   /*    768 */
+        &&cg_set_i_p_k,                                    /*    769 */
+        &&cg_set_i_p_kc,                                   /*    770 */
+        &&cg_set_n_p_k,                                    /*    771 */
+        &&cg_set_n_p_kc,                                   /*    772 */
+        &&cg_set_s_p_k,                                    /*    773 */
+        &&cg_set_s_p_kc,                                   /*    774 */
+        &&cg_set_p_p_k,                                    /*    775 */
+        &&cg_set_p_p_kc,                                   /*    776 */
+        &&cg_clone_p_p,                                    /*    777 */
+        &&cg_clone_p_p_p,                                  /*    778 */
+        &&cg_clone_p_p_pc,                                 /*    779 */
+        &&cg_copy_p_p,                                     /*    780 */
+        &&cg_null_s,                                       /*    781 */
+        &&cg_null_i,                                       /*    782 */
+        &&cg_null_p,                                       /*    783 */
+        &&cg_null_n,                                       /*    784 */
+        &&cg_ord_i_s,                                      /*    785 */
+        &&cg_ord_i_sc,                                     /*    786 */
+        &&cg_ord_i_s_i,                                    /*    787 */
+        &&cg_ord_i_sc_i,                                   /*    788 */
+        &&cg_ord_i_s_ic,                                   /*    789 */
+        &&cg_ord_i_sc_ic,                                  /*    790 */
+        &&cg_chr_s_i,                                      /*    791 */
+        &&cg_chr_s_ic,                                     /*    792 */
+        &&cg_chopn_s_s_i,                                  /*    793 */
+        &&cg_chopn_s_sc_i,                                 /*    794 */
+        &&cg_chopn_s_s_ic,                                 /*    795 */
+        &&cg_chopn_s_sc_ic,                                /*    796 */
+        &&cg_concat_p_p,                                   /*    797 */
+        &&cg_concat_p_s,                                   /*    798 */
+        &&cg_concat_p_sc,                                  /*    799 */
+        &&cg_concat_s_s_s,                                 /*    800 */
+        &&cg_concat_s_sc_s,                                /*    801 */
+        &&cg_concat_s_s_sc,                                /*    802 */
+        &&cg_concat_p_p_s,                                 /*    803 */
+        &&cg_concat_p_p_sc,                                /*    804 */
+        &&cg_concat_p_p_p,                                 /*    805 */
+        &&cg_repeat_s_s_i,                                 /*    806 */
+        &&cg_repeat_s_sc_i,                                /*    807 */
+        &&cg_repeat_s_s_ic,                                /*    808 */
+        &&cg_repeat_s_sc_ic,                               /*    809 */
+        &&cg_repeat_p_p_i,                                 /*    810 */
+        &&cg_repeat_p_p_ic,                                /*    811 */
+        &&cg_repeat_p_p_p,                                 /*    812 */
+        &&cg_repeat_p_i,                                   /*    813 */
+        &&cg_repeat_p_ic,                                  /*    814 */
+        &&cg_repeat_p_p,                                   /*    815 */
+        &&cg_length_i_s,                                   /*    816 */
+        &&cg_length_i_sc,                                  /*    817 */
+        &&cg_bytelength_i_s,                               /*    818 */
+        &&cg_bytelength_i_sc,                              /*    819 */
+        &&cg_pin_s,                                        /*    820 */
+        &&cg_unpin_s,                                      /*    821 */
+        &&cg_substr_s_s_i,                                 /*    822 */
+        &&cg_substr_s_sc_i,                                /*    823 */
+        &&cg_substr_s_s_ic,                                /*    824 */
+        &&cg_substr_s_sc_ic,                               /*    825 */
+        &&cg_substr_s_s_i_i,                               /*    826 */
+        &&cg_substr_s_sc_i_i,                              /*    827 */
+        &&cg_substr_s_s_ic_i,                              /*    828 */
+        &&cg_substr_s_sc_ic_i,                             /*    829 */
+        &&cg_substr_s_s_i_ic,                              /*    830 */
+        &&cg_substr_s_sc_i_ic,                             /*    831 */
+        &&cg_substr_s_s_ic_ic,                             /*    832 */
+        &&cg_substr_s_sc_ic_ic,                            /*    833 */
+        &&cg_substr_s_p_i_i,                               /*    834 */
+        &&cg_substr_s_p_ic_i,                              /*    835 */
+        &&cg_substr_s_p_i_ic,                              /*    836 */
+        &&cg_substr_s_p_ic_ic,                             /*    837 */
+        &&cg_replace_s_s_i_i_s,                            /*    838 */
+        &&cg_replace_s_sc_i_i_s,                           /*    839 */
+        &&cg_replace_s_s_ic_i_s,                           /*    840 */
+        &&cg_replace_s_sc_ic_i_s,                          /*    841 */
+        &&cg_replace_s_s_i_ic_s,                           /*    842 */
+        &&cg_replace_s_sc_i_ic_s,                          /*    843 */
+        &&cg_replace_s_s_ic_ic_s,                          /*    844 */
+        &&cg_replace_s_sc_ic_ic_s,                         /*    845 */
+        &&cg_replace_s_s_i_i_sc,                           /*    846 */
+        &&cg_replace_s_sc_i_i_sc,                          /*    847 */
+        &&cg_replace_s_s_ic_i_sc,                          /*    848 */
+        &&cg_replace_s_sc_ic_i_sc,                         /*    849 */
+        &&cg_replace_s_s_i_ic_sc,                          /*    850 */
+        &&cg_replace_s_sc_i_ic_sc,                         /*    851 */
+        &&cg_replace_s_s_ic_ic_sc,                         /*    852 */
+        &&cg_replace_s_sc_ic_ic_sc,                        /*    853 */
+        &&cg_index_i_s_s,                                  /*    854 */
+        &&cg_index_i_sc_s,                                 /*    855 */
+        &&cg_index_i_s_sc,                                 /*    856 */
+        &&cg_index_i_sc_sc,                                /*    857 */
+        &&cg_index_i_s_s_i,                                /*    858 */
+        &&cg_index_i_sc_s_i,                               /*    859 */
+        &&cg_index_i_s_sc_i,                               /*    860 */
+        &&cg_index_i_sc_sc_i,                              /*    861 */
+        &&cg_index_i_s_s_ic,                               /*    862 */
+        &&cg_index_i_sc_s_ic,                              /*    863 */
+        &&cg_index_i_s_sc_ic,                              /*    864 */
+        &&cg_index_i_sc_sc_ic,                             /*    865 */
+        &&cg_sprintf_s_s_p,                                /*    866 */
+        &&cg_sprintf_s_sc_p,                               /*    867 */
+        &&cg_sprintf_p_p_p,                                /*    868 */
+        &&cg_new_s,                                        /*    869 */
+        &&cg_new_s_i,                                      /*    870 */
+        &&cg_new_s_ic,                                     /*    871 */
+        &&cg_stringinfo_i_s_i,                             /*    872 */
+        &&cg_stringinfo_i_sc_i,                            /*    873 */
+        &&cg_stringinfo_i_s_ic,                            /*    874 */
+        &&cg_stringinfo_i_sc_ic,                           /*    875 */
+        &&cg_upcase_s_s,                                   /*    876 */
+        &&cg_upcase_s_sc,                                  /*    877 */
+        &&cg_downcase_s_s,                                 /*    878 */
+        &&cg_downcase_s_sc,                                /*    879 */
+        &&cg_titlecase_s_s,                                /*    880 */
+        &&cg_titlecase_s_sc,                               /*    881 */
+        &&cg_join_s_s_p,                                   /*    882 */
+        &&cg_join_s_sc_p,                                  /*    883 */
+        &&cg_split_p_s_s,                                  /*    884 */
+        &&cg_split_p_sc_s,                                 /*    885 */
+        &&cg_split_p_s_sc,                                 /*    886 */
+        &&cg_split_p_sc_sc,                                /*    887 */
+        &&cg_encoding_i_s,                                 /*    888 */
+        &&cg_encoding_i_sc,                                /*    889 */
+        &&cg_encodingname_s_i,                             /*    890 */
+        &&cg_encodingname_s_ic,                            /*    891 */
+        &&cg_find_encoding_i_s,                            /*    892 */
+        &&cg_find_encoding_i_sc,                           /*    893 */
+        &&cg_trans_encoding_s_s_i,                         /*    894 */
+        &&cg_trans_encoding_s_sc_i,                        /*    895 */
+        &&cg_trans_encoding_s_s_ic,                        /*    896 */
+        &&cg_trans_encoding_s_sc_ic,                       /*    897 */
+        &&cg_is_cclass_i_i_s_i,                            /*    898 */
+        &&cg_is_cclass_i_ic_s_i,                           /*    899 */
+        &&cg_is_cclass_i_i_sc_i,                           /*    900 */
+        &&cg_is_cclass_i_ic_sc_i,                          /*    901 */
+        &&cg_is_cclass_i_i_s_ic,                           /*    902 */
+        &&cg_is_cclass_i_ic_s_ic,                          /*    903 */
+        &&cg_is_cclass_i_i_sc_ic,                          /*    904 */
+        &&cg_is_cclass_i_ic_sc_ic,                         /*    905 */
+        &&cg_find_cclass_i_i_s_i_i,                        /*    906 */
+        &&cg_find_cclass_i_ic_s_i_i,                       /*    907 */
+        &&cg_find_cclass_i_i_sc_i_i,                       /*    908 */
+        &&cg_find_cclass_i_ic_sc_i_i,                      /*    909 */
+        &&cg_find_cclass_i_i_s_ic_i,                       /*    910 */
+        &&cg_find_cclass_i_ic_s_ic_i,                      /*    911 */
+        &&cg_find_cclass_i_i_sc_ic_i,                      /*    912 */
+        &&cg_find_cclass_i_ic_sc_ic_i,                     /*    913 */
+        &&cg_find_cclass_i_i_s_i_ic,                       /*    914 */
+        &&cg_find_cclass_i_ic_s_i_ic,                      /*    915 */
+        &&cg_find_cclass_i_i_sc_i_ic,                      /*    916 */
+        &&cg_find_cclass_i_ic_sc_i_ic,                     /*    917 */
+        &&cg_find_cclass_i_i_s_ic_ic,                      /*    918 */
+        &&cg_find_cclass_i_ic_s_ic_ic,                     /*    919 */
+        &&cg_find_cclass_i_i_sc_ic_ic,                     /*    920 */
+        &&cg_find_cclass_i_ic_sc_ic_ic,                    /*    921 */
+        &&cg_find_not_cclass_i_i_s_i_i,                    /*    922 */
+        &&cg_find_not_cclass_i_ic_s_i_i,                   /*    923 */
+        &&cg_find_not_cclass_i_i_sc_i_i,                   /*    924 */
+        &&cg_find_not_cclass_i_ic_sc_i_i,                  /*    925 */
+        &&cg_find_not_cclass_i_i_s_ic_i,                   /*    926 */
+        &&cg_find_not_cclass_i_ic_s_ic_i,                  /*    927 */
+        &&cg_find_not_cclass_i_i_sc_ic_i,                  /*    928 */
+        &&cg_find_not_cclass_i_ic_sc_ic_i,                 /*    929 */
+        &&cg_find_not_cclass_i_i_s_i_ic,                   /*    930 */
+        &&cg_find_not_cclass_i_ic_s_i_ic,                  /*    931 */
+        &&cg_find_not_cclass_i_i_sc_i_ic,                  /*    932 */
+        &&cg_find_not_cclass_i_ic_sc_i_ic,                 /*    933 */
+        &&cg_find_not_cclass_i_i_s_ic_ic,                  /*    934 */
+        &&cg_find_not_cclass_i_ic_s_ic_ic,                 /*    935 */
+        &&cg_find_not_cclass_i_i_sc_ic_ic,                 /*    936 */
+        &&cg_find_not_cclass_i_ic_sc_ic_ic,                /*    937 */
+        &&cg_escape_s_s,                                   /*    938 */
+        &&cg_compose_s_s,                                  /*    939 */
+        &&cg_compose_s_sc,                                 /*    940 */
+        &&cg_find_codepoint_i_s,                           /*    941 */
+        &&cg_find_codepoint_i_sc,                          /*    942 */
+        &&cg_spawnw_i_s,                                   /*    943 */
+        &&cg_spawnw_i_sc,                                  /*    944 */
+        &&cg_spawnw_i_p,                                   /*    945 */
+        &&cg_err_i,                                        /*    946 */
+        &&cg_err_s,                                        /*    947 */
+        &&cg_err_s_i,                                      /*    948 */
+        &&cg_err_s_ic,                                     /*    949 */
+        &&cg_time_i,                                       /*    950 */
+        &&cg_time_n,                                       /*    951 */
+        &&cg_sleep_i,                                      /*    952 */
+        &&cg_sleep_ic,                                     /*    953 */
+        &&cg_sleep_n,                                      /*    954 */
+        &&cg_sleep_nc,                                     /*    955 */
+        &&cg_store_lex_s_p,                                /*    956 */
+        &&cg_store_lex_sc_p,                               /*    957 */
+        &&cg_store_lex_s_s,                                /*    958 */
+        &&cg_store_lex_sc_s,                               /*    959 */
+        &&cg_store_lex_s_sc,                               /*    960 */
+        &&cg_store_lex_sc_sc,                              /*    961 */
+        &&cg_store_lex_s_i,                                /*    962 */
+        &&cg_store_lex_sc_i,                               /*    963 */
+        &&cg_store_lex_s_ic,                               /*    964 */
+        &&cg_store_lex_sc_ic,                              /*    965 */
+        &&cg_store_lex_s_n,                                /*    966 */
+        &&cg_store_lex_sc_n,                               /*    967 */
+        &&cg_store_lex_s_nc,                               /*    968 */
+        &&cg_store_lex_sc_nc,                              /*    969 */
+        &&cg_store_dynamic_lex_s_p,                        /*    970 */
+        &&cg_store_dynamic_lex_sc_p,                       /*    971 */
+        &&cg_find_lex_p_s,                                 /*    972 */
+        &&cg_find_lex_p_sc,                                /*    973 */
+        &&cg_find_lex_s_s,                                 /*    974 */
+        &&cg_find_lex_s_sc,                                /*    975 */
+        &&cg_find_lex_i_s,                                 /*    976 */
+        &&cg_find_lex_i_sc,                                /*    977 */
+        &&cg_find_lex_n_s,                                 /*    978 */
+        &&cg_find_lex_n_sc,                                /*    979 */
+        &&cg_find_dynamic_lex_p_s,                         /*    980 */
+        &&cg_find_dynamic_lex_p_sc,                        /*    981 */
+        &&cg_find_caller_lex_p_s,                          /*    982 */
+        &&cg_find_caller_lex_p_sc,                         /*    983 */
+        &&cg_get_namespace_p,                              /*    984 */
+        &&cg_get_namespace_p_p,                            /*    985 */
+        &&cg_get_namespace_p_pc,                           /*    986 */
+        &&cg_get_hll_namespace_p,                          /*    987 */
+        &&cg_get_hll_namespace_p_p,                        /*    988 */
+        &&cg_get_hll_namespace_p_pc,                       /*    989 */
+        &&cg_get_root_namespace_p,                         /*    990 */
+        &&cg_get_root_namespace_p_p,                       /*    991 */
+        &&cg_get_root_namespace_p_pc,                      /*    992 */
+        &&cg_get_global_p_s,                               /*    993 */
+        &&cg_get_global_p_sc,                              /*    994 */
+        &&cg_get_global_p_p_s,                             /*    995 */
+        &&cg_get_global_p_pc_s,                            /*    996 */
+        &&cg_get_global_p_p_sc,                            /*    997 */
+        &&cg_get_global_p_pc_sc,                           /*    998 */
+        &&cg_get_hll_global_p_s,                           /*    999 */
+        &&cg_get_hll_global_p_sc,                          /*   1000 */
+        &&cg_get_hll_global_p_p_s,                         /*   1001 */
+        &&cg_get_hll_global_p_pc_s,                        /*   1002 */
+        &&cg_get_hll_global_p_p_sc,                        /*   1003 */
+        &&cg_get_hll_global_p_pc_sc,                       /*   1004 */
+        &&cg_get_root_global_p_s,                          /*   1005 */
+        &&cg_get_root_global_p_sc,                         /*   1006 */
+        &&cg_get_root_global_p_p_s,                        /*   1007 */
+        &&cg_get_root_global_p_pc_s,                       /*   1008 */
+        &&cg_get_root_global_p_p_sc,                       /*   1009 */
+        &&cg_get_root_global_p_pc_sc,                      /*   1010 */
+        &&cg_set_global_s_p,                               /*   1011 */
+        &&cg_set_global_sc_p,                              /*   1012 */
+        &&cg_set_global_p_s_p,                             /*   1013 */
+        &&cg_set_global_pc_s_p,                            /*   1014 */
+        &&cg_set_global_p_sc_p,                            /*   1015 */
+        &&cg_set_global_pc_sc_p,                           /*   1016 */
+        &&cg_set_hll_global_s_p,                           /*   1017 */
+        &&cg_set_hll_global_sc_p,                          /*   1018 */
+        &&cg_set_hll_global_p_s_p,                         /*   1019 */
+        &&cg_set_hll_global_pc_s_p,                        /*   1020 */
+        &&cg_set_hll_global_p_sc_p,                        /*   1021 */
+        &&cg_set_hll_global_pc_sc_p,                       /*   1022 */
+        &&cg_set_root_global_s_p,                          /*   1023 */
+        &&cg_set_root_global_sc_p,                         /*   1024 */
+        &&cg_set_root_global_p_s_p,                        /*   1025 */
+        &&cg_set_root_global_pc_s_p,                       /*   1026 */
+        &&cg_set_root_global_p_sc_p,                       /*   1027 */
+        &&cg_set_root_global_pc_sc_p,                      /*   1028 */
+        &&cg_find_name_p_s,                                /*   1029 */
+        &&cg_find_name_p_sc,                               /*   1030 */
+        &&cg_find_sub_not_null_p_s,                        /*   1031 */
+        &&cg_find_sub_not_null_p_sc,                       /*   1032 */
+        &&cg_trap,                                         /*   1033 */
+        &&cg_set_label_p_ic,                               /*   1034 */
+        &&cg_get_label_i_p,                                /*   1035 */
+        &&cg_get_id_i_p,                                   /*   1036 */
+        &&cg_get_id_i_pc,                                  /*   1037 */
+        &&cg_fetch_p_p_p_p,                                /*   1038 */
+        &&cg_fetch_p_pc_p_p,                               /*   1039 */
+        &&cg_fetch_p_p_pc_p,                               /*   1040 */
+        &&cg_fetch_p_pc_pc_p,                              /*   1041 */
+        &&cg_fetch_p_p_p_pc,                               /*   1042 */
+        &&cg_fetch_p_pc_p_pc,                              /*   1043 */
+        &&cg_fetch_p_p_pc_pc,                              /*   1044 */
+        &&cg_fetch_p_pc_pc_pc,                             /*   1045 */
+        &&cg_fetch_p_p_i_p,                                /*   1046 */
+        &&cg_fetch_p_pc_i_p,                               /*   1047 */
+        &&cg_fetch_p_p_ic_p,                               /*   1048 */
+        &&cg_fetch_p_pc_ic_p,                              /*   1049 */
+        &&cg_fetch_p_p_i_pc,                               /*   1050 */
+        &&cg_fetch_p_pc_i_pc,                              /*   1051 */
+        &&cg_fetch_p_p_ic_pc,                              /*   1052 */
+        &&cg_fetch_p_pc_ic_pc,                             /*   1053 */
+        &&cg_fetch_p_p_s_p,                                /*   1054 */
+        &&cg_fetch_p_pc_s_p,                               /*   1055 */
+        &&cg_fetch_p_p_sc_p,                               /*   1056 */
+        &&cg_fetch_p_pc_sc_p,                              /*   1057 */
+        &&cg_fetch_p_p_s_pc,                               /*   1058 */
+        &&cg_fetch_p_pc_s_pc,                              /*   1059 */
+        &&cg_fetch_p_p_sc_pc,                              /*   1060 */
+        &&cg_fetch_p_pc_sc_pc,                             /*   1061 */
+        &&cg_vivify_p_p_p_p,                               /*   1062 */
+        &&cg_vivify_p_pc_p_p,                              /*   1063 */
+        &&cg_vivify_p_p_pc_p,                              /*   1064 */
+        &&cg_vivify_p_pc_pc_p,                             /*   1065 */
+        &&cg_vivify_p_p_p_pc,                              /*   1066 */
+        &&cg_vivify_p_pc_p_pc,                             /*   1067 */
+        &&cg_vivify_p_p_pc_pc,                             /*   1068 */
+        &&cg_vivify_p_pc_pc_pc,                            /*   1069 */
+        &&cg_vivify_p_p_i_p,                               /*   1070 */
+        &&cg_vivify_p_pc_i_p,                              /*   1071 */
+        &&cg_vivify_p_p_ic_p,                              /*   1072 */
+        &&cg_vivify_p_pc_ic_p,                             /*   1073 */
+        &&cg_vivify_p_p_i_pc,                              /*   1074 */
+        &&cg_vivify_p_pc_i_pc,                             /*   1075 */
+        &&cg_vivify_p_p_ic_pc,                             /*   1076 */
+        &&cg_vivify_p_pc_ic_pc,                            /*   1077 */
+        &&cg_vivify_p_p_s_p,                               /*   1078 */
+        &&cg_vivify_p_pc_s_p,                              /*   1079 */
+        &&cg_vivify_p_p_sc_p,                              /*   1080 */
+        &&cg_vivify_p_pc_sc_p,                             /*   1081 */
+        &&cg_vivify_p_p_s_pc,                              /*   1082 */
+        &&cg_vivify_p_pc_s_pc,                             /*   1083 */
+        &&cg_vivify_p_p_sc_pc,                             /*   1084 */
+        &&cg_vivify_p_pc_sc_pc,                            /*   1085 */
+        &&cg_new_p_s_i,                                    /*   1086 */
+        &&cg_new_p_sc_i,                                   /*   1087 */
+        &&cg_new_p_s_ic,                                   /*   1088 */
+        &&cg_new_p_sc_ic,                                  /*   1089 */
+        &&cg_new_p_p_i,                                    /*   1090 */
+        &&cg_new_p_pc_i,                                   /*   1091 */
+        &&cg_new_p_p_ic,                                   /*   1092 */
+        &&cg_new_p_pc_ic,                                  /*   1093 */
+        &&cg_root_new_p_p_i,                               /*   1094 */
+        &&cg_root_new_p_pc_i,                              /*   1095 */
+        &&cg_root_new_p_p_ic,                              /*   1096 */
+        &&cg_root_new_p_pc_ic,                             /*   1097 */
+        &&cg_receive_p,                                    /*   1098 */
+        &&cg_wait_p,                                       /*   1099 */
+        &&cg_wait_pc,                                      /*   1100 */
+        &&cg_pass,                                         /*   1101 */
+        &&cg_mod_i_i_i__unless_i_ic,                       /*   1102 */
+        &&cg_dec_i__branch_ic,                             /*   1103 */
+        &&cg_add_p_p__add_p_p,                             /*   1104 */
+        &&cg_add_p_p__add_p_p__add_p_p,                    /*   1105 */
+        &&cg_dec_p__lt_p_ic_ic,                            /*   1106 */
+        NULL
+    };
+
+    PackFile_ByteCode *cg_code       = interp->code;
+    opcode_t          *cg_code_start = cg_code->base.data;
+    void             **cg_thread     = Parrot_runcore_cgoto_thread(interp, cg_code,
+                                            &&cg_translate);
+
+    DISPATCH_OP();
+
+    /* An absolute jump, possibly into another code segment or out of the
+     * runloop altogether. */
+  cg_dispatch_address:
+    if (!cur_opcode)
+        return cur_opcode;
+
+    if (interp->code != cg_code) {
+        cg_code       = interp->code;
+        cg_code_start = cg_code->base.data;
+        cg_thread     = Parrot_runcore_cgoto_thread(interp, cg_code, &&cg_translate);
+    }
+
+    DISPATCH_OP();
+
+    /* First execution of this op: patch its label into the thread. */
+  cg_translate:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    cg_thread[cur_opcode - cg_code_start] = Parrot_runcore_cgoto_translate(interp,
+            cg_code, cur_opcode, cg_op_labels, &&cg_dynop);
+    DISPATCH_OP();
+
+    /* Ops from dynamic op libraries are called through the function table. */
+  cg_dynop:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    cur_opcode = (cg_code->op_func_table[*cur_opcode])(cur_opcode, interp);
+    goto cg_dispatch_address;
+
+  cg_end:
+    {
+    do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+}
+
+  cg_noop:
+    {
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_check_events:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * next =  cur_opcode + 1;
+
+    next = Parrot_cx_check_scheduler(interp, next);
+    do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+}
+
+  cg_check_events__:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  _this = CUR_OPCODE;
+    opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, _this, EXCEPTION_INVALID_OPERATION, "check_events__ opcode doesn't do anything useful.");
+
+    do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    Parrot_runcore_disable_event_checking(interp);
+    do { cur_opcode = (opcode_t *)(_this); goto cg_dispatch_address; } while (0);
+}
+
+  cg_load_bytecode_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_load_bytecode(interp, SREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_load_bytecode_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_load_bytecode(interp, SCONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_load_bytecode_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pf_load_bytecode_search(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_load_bytecode_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pf_load_bytecode_search(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_load_language_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_load_language(interp, SREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_load_language_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_load_language(interp, SCONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_branch_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + IREG(1))) == 0)) {
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+    }
+
+    do { cur_opcode += IREG(1); DISPATCH_OP(); } while (0);
+}
+
+  cg_branch_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(1))) == 0)) {
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+    }
+
+    do { cur_opcode += ICONST(1); DISPATCH_OP(); } while (0);
+}
+
+  cg_local_branch_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    INTVAL   return_addr;
+    opcode_t  * const  dest =  cur_opcode + 3;
+
+    if ((PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (return_addr) = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), (return_addr));
+    do { cur_opcode += IREG(2); DISPATCH_OP(); } while (0);
+}
+
+  cg_local_branch_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    INTVAL   return_addr;
+    opcode_t  * const  dest =  cur_opcode + 3;
+
+    if ((PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (return_addr) = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), (return_addr));
+    do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+}
+
+  cg_local_return_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    INTVAL   return_addr;
+    opcode_t  * next;
+    opcode_t  * const  dest =  cur_opcode + 2;
+
+    if ((PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_return'");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (return_addr) = VTABLE_pop_integer(interp, PREG(1));
+    next = INTVAL2PTR(opcode_t *, (return_addr));
+    if ((!(((next >= interp->code->base.data) && (next < ((interp->code->base.data + interp->code->base.size))))))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Address for 'local_return' must be within the current code segment");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+}
+
+  cg_jump_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, IREG(1));
+
+    do { cur_opcode = (opcode_t *)(loc); goto cg_dispatch_address; } while (0);
+}
+
+  cg_jump_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, ICONST(1));
+
+    do { cur_opcode = (opcode_t *)(loc); goto cg_dispatch_address; } while (0);
+}
+
+  cg_if_i_ic:
+    {
+    if ((IREG(1) != 0)) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_if_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!FLOAT_IS_ZERO(NREG(1)))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_if_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (Parrot_str_boolean(interp, SREG(1))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_if_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (VTABLE_get_bool(interp, PREG(1))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unless_i_ic:
+    {
+    if ((IREG(1) == 0)) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unless_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (FLOAT_IS_ZERO(NREG(1))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unless_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!Parrot_str_boolean(interp, SREG(1)))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unless_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!VTABLE_get_bool(interp, PREG(1)))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_invokecc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  p = PREG(1);
+    opcode_t  * dest =  cur_opcode + 2;
+    PMC       * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+    if ((!PMC_IS_NULL(signature))) {
+        Parrot_pcc_set_object(interp, signature, NULL);
+    }
+
+    interp->current_cont = NEED_CONTINUATION;
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_invoke_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t    * dest =  cur_opcode + 3;
+    PMC  * const  p = PREG(1);
+    PMC  * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+    if ((!PMC_IS_NULL(signature))) {
+        Parrot_pcc_set_object(interp, signature, NULL);
+    }
+
+    interp->current_cont = PREG(2);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_yield:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t    * dest =  cur_opcode + 1;
+    PMC  * const  p = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
+
+    VTABLE_increment(interp, p);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_tailcall_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  p = PREG(1);
+    opcode_t    * dest =  cur_opcode + 2;
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  parent_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC  * const  this_call_sig = Parrot_pcc_get_signature(interp, ctx);
+    PMC  * const  parent_call_sig = Parrot_pcc_get_signature(interp, parent_ctx);
+
+    interp->current_cont = Parrot_pcc_get_continuation(interp, ctx);
+    Parrot_pcc_merge_signature_for_tailcall(interp, parent_call_sig, this_call_sig);
+    SUB_FLAG_TAILCALL_SET(interp->current_cont);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_returncc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  p = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    opcode_t  * const  dest = VTABLE_invoke(interp, p,  cur_opcode + 1);
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_capture_lex_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_sub_capture_lex(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_newclosure_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_sub_new_closure(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_args_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  raw_args = CUR_OPCODE;
+    PMC  * const  signature = PCONST(1);
+    PMC  * const  call_sig = Parrot_pcc_build_sig_object_from_op(interp, PMCNULL, signature, raw_args);
+    INTVAL   argc;
+
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+    do { cur_opcode += (argc + 2); DISPATCH_OP(); } while (0);
+}
+
+  cg_get_params_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  raw_params = CUR_OPCODE;
+    PMC       * const  signature = PCONST(1);
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+    PMC       * const  ccont = Parrot_pcc_get_continuation(interp, ctx);
+    PMC       * const  caller_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC       * const  call_object = Parrot_pcc_get_signature(interp, caller_ctx);
+    INTVAL   argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_PARAM_COUNT_FLAG);
+    if ((PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL)) {
+        (PObj_get_FLAGS(ccont) &= (~SUB_FLAG_TAILCALL));
+        Parrot_pcc_dec_recursion_depth(interp, ctx);
+        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+    }
+
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    do { cur_opcode += (argc + 2); DISPATCH_OP(); } while (0);
+}
+
+  cg_set_returns_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  raw_args = CUR_OPCODE;
+    PMC       * const  signature = PCONST(1);
+    PMC       * const  call_sig = Parrot_pcc_build_sig_object_from_op(interp, Parrot_pcc_get_signature(interp, Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp))), signature, raw_args);
+    INTVAL   argc;
+
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    do { cur_opcode += (argc + 2); DISPATCH_OP(); } while (0);
+}
+
+  cg_get_results_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  raw_params = CUR_OPCODE;
+    PMC       * const  signature = PCONST(1);
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+    PMC       * const  call_object = Parrot_pcc_get_signature(interp, ctx);
+    INTVAL   argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_RESULT_COUNT_FLAG);
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), PMCNULL);
+    do { cur_opcode += (argc + 2); DISPATCH_OP(); } while (0);
+}
+
+  cg_set_result_info_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx, Parrot_str_new_constant(interp, "return_flags"), PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_result_info_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx, Parrot_str_new_constant(interp, "return_flags"), PCONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_result_info_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  caller_ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  sig = VTABLE_get_attr_str(interp, caller_ctx, Parrot_str_new_constant(interp, "return_flags"));
+
+    if ((!sig)) {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
+    }
+    else {
+        PREG(1) = sig;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_addr_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PTR2INTVAL((CUR_OPCODE + ICONST(2)));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_addr_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pointer(interp, PREG(1), ((CUR_OPCODE + ICONST(2))));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_addr_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pointer(interp, PREG(1), (void*)IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_addr_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void  * const  ptr = VTABLE_get_pointer(interp, PREG(2));
+
+    IREG(1) = (INTVAL)ptr;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_schedule_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_cx_schedule_task(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_addhandler_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_cx_add_handler(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_eh_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
+
+    VTABLE_set_pointer(interp, eh, (CUR_OPCODE + ICONST(1)));
+    Parrot_cx_add_handler_local(interp, eh);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_eh_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_cx_add_handler_local(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_eh:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_cx_delete_handler_local(interp);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_throw_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  *  except = PREG(1);
+    opcode_t  * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    STRING  * const  exception_str = Parrot_str_new_constant(interp, "Exception");
+
+    VTABLE_set_pointer(interp, resume, ret);
+    if ((PMC_IS_NULL(except) || (!VTABLE_does(interp, except, exception_str)))) {
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal, EXCEPTION_UNIMPLEMENTED, Parrot_str_new_constant(interp, "Not a throwable object"));
+    }
+
+    VTABLE_set_attr_str(interp, except, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, except, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_throw_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  *  dest;
+    PMC  *  except = PREG(1);
+    STRING  * const  exception_str = Parrot_str_new_constant(interp, "Exception");
+
+    if ((PMC_IS_NULL(except) || (!VTABLE_does(interp, except, exception_str)))) {
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal, EXCEPTION_UNIMPLEMENTED, Parrot_str_new_constant(interp, "Not a throwable object"));
+    }
+
+    dest = Parrot_ex_throw_from_op(interp, PREG(1), VTABLE_get_pointer(interp, PREG(2)));
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_rethrow_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  *  dest;
+    PMC  *  except = PREG(1);
+    STRING  * const  exception_str = Parrot_str_new_constant(interp, "Exception");
+
+    if ((PMC_IS_NULL(except) || (!VTABLE_does(interp, except, exception_str)))) {
+        opcode_t  * const  ret =  cur_opcode + 2;
+
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal, EXCEPTION_UNIMPLEMENTED, Parrot_str_new_constant(interp, "Not a throwable object"));
+        dest = Parrot_ex_throw_from_op(interp, except, ret);
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    dest = Parrot_ex_rethrow_from_op(interp, except);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_count_eh_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_cx_count_handlers_local(interp);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_die_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, SREG(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_die_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, SCONST(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_die_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    STRING    * const  msg = PMC_IS_NULL(PREG(1)) ? NULL : VTABLE_get_string(interp, PREG(1));
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_die_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    STRING    * const  msg = PMC_IS_NULL(PCONST(1)) ? NULL : VTABLE_get_string(interp, PCONST(1));
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_die_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) == EXCEPT_doomed)) {
+        _exit(IREG(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, IREG(1), IREG(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_die_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) == EXCEPT_doomed)) {
+        _exit(IREG(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, ICONST(1), IREG(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_die_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) == EXCEPT_doomed)) {
+        _exit(ICONST(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, IREG(1), ICONST(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_die_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) == EXCEPT_doomed)) {
+        _exit(ICONST(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, ICONST(1), ICONST(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_exit_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_exit, CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception, Parrot_str_new_constant(interp, "exit_code"), IREG(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_exit_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_exit, CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception, Parrot_str_new_constant(interp, "exit_code"), ICONST(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_finalize_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  dest =  cur_opcode + 2;
+    PMC  * eh = PMCNULL;
+
+    if ((!PMC_IS_NULL(PREG(1)))) {
+        if ((PREG(1)->vtable->base_type == enum_class_Exception)) {
+            GETATTR_Exception_handler(interp, PREG(1), eh);
+        }
+        else {
+            if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "ExceptionHandler"))) {
+                eh = PREG(1);
+            }
+            else {
+                if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "Exception"))) {
+                    eh = VTABLE_get_attr_str(interp, PREG(1), Parrot_str_new_constant(interp, "handler"));
+                }
+
+            }
+
+        }
+
+    }
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_runloop  * rl = interp->current_runloop;
+        INTVAL   rid;
+
+        if ((eh->vtable->base_type == enum_class_ExceptionHandler)) {
+            GETATTR_ExceptionHandler_runloop_id(interp, eh, rid);
+        }
+        else {
+            Parrot_pcc_invoke_method_from_c_args(interp, eh, Parrot_str_new_constant(interp, "rid"), "->I", (&rid));
+        }
+
+        while ((rl && (rl->id != rid))) {
+            rl = rl->prev;
+        }
+
+        if (rl) {
+            if ((rl != interp->current_runloop)) {
+                rl->handler_start = dest;
+                longjmp(rl->resume, 3);
+            }
+
+        }
+        else {
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "missing runloop");
+        }
+
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_finalize_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  dest =  cur_opcode + 2;
+    PMC  * eh = PMCNULL;
+
+    if ((!PMC_IS_NULL(PCONST(1)))) {
+        if ((PCONST(1)->vtable->base_type == enum_class_Exception)) {
+            GETATTR_Exception_handler(interp, PCONST(1), eh);
+        }
+        else {
+            if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "ExceptionHandler"))) {
+                eh = PCONST(1);
+            }
+            else {
+                if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "Exception"))) {
+                    eh = VTABLE_get_attr_str(interp, PCONST(1), Parrot_str_new_constant(interp, "handler"));
+                }
+
+            }
+
+        }
+
+    }
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_runloop  * rl = interp->current_runloop;
+        INTVAL   rid;
+
+        if ((eh->vtable->base_type == enum_class_ExceptionHandler)) {
+            GETATTR_ExceptionHandler_runloop_id(interp, eh, rid);
+        }
+        else {
+            Parrot_pcc_invoke_method_from_c_args(interp, eh, Parrot_str_new_constant(interp, "rid"), "->I", (&rid));
+        }
+
+        while ((rl && (rl->id != rid))) {
+            rl = rl->prev;
+        }
+
+        if (rl) {
+            if ((rl != interp->current_runloop)) {
+                rl->handler_start = dest;
+                longjmp(rl->resume, 3);
+            }
+
+        }
+        else {
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "missing runloop");
+        }
+
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_upto_eh_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * eh = PMCNULL;
+
+    if ((!PMC_IS_NULL(PREG(1)))) {
+        if ((PREG(1)->vtable->base_type == enum_class_Exception)) {
+            GETATTR_Exception_handler(interp, PREG(1), eh);
+        }
+        else {
+            if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "ExceptionHandler"))) {
+                eh = PREG(1);
+            }
+            else {
+                if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "Exception"))) {
+                    eh = VTABLE_get_attr_str(interp, PREG(1), Parrot_str_new_constant(interp, "handler"));
+                }
+
+            }
+
+        }
+
+    }
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_cx_delete_upto_handler_local(interp, eh);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_upto_eh_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * eh = PMCNULL;
+
+    if ((!PMC_IS_NULL(PCONST(1)))) {
+        if ((PCONST(1)->vtable->base_type == enum_class_Exception)) {
+            GETATTR_Exception_handler(interp, PCONST(1), eh);
+        }
+        else {
+            if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "ExceptionHandler"))) {
+                eh = PCONST(1);
+            }
+            else {
+                if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "Exception"))) {
+                    eh = VTABLE_get_attr_str(interp, PCONST(1), Parrot_str_new_constant(interp, "handler"));
+                }
+
+            }
+
+        }
+
+    }
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_cx_delete_upto_handler_local(interp, eh);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_peek_exception_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+    PMC       * const  call_object = Parrot_pcc_get_signature(interp, ctx);
+
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, call_object, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_debug_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) != 0)) {
+        Interp_debug_SET(interp, IREG(1));
+    }
+    else {
+        Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_debug_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) != 0)) {
+        Interp_debug_SET(interp, ICONST(1));
+    }
+    else {
+        Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_bounds_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_BOUNDS_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_bounds_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_BOUNDS_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_profile_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_PROFILE_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_profile_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_PROFILE_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_trace_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) != 0)) {
+        Parrot_interp_set_trace(interp, IREG(1));
+    }
+    else {
+        Parrot_interp_clear_trace(interp, PARROT_ALL_TRACE_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_trace_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) != 0)) {
+        Parrot_interp_set_trace(interp, ICONST(1));
+    }
+    else {
+        Parrot_interp_clear_trace(interp, PARROT_ALL_TRACE_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+}
+
+  cg_gc_debug_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(1) != 0)) {
+        Interp_flags_SET(interp, PARROT_GC_DEBUG_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_gc_debug_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(1) != 0)) {
+        Interp_flags_SET(interp, PARROT_GC_DEBUG_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_interpinfo_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_interp_info(interp, IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_interpinfo_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_interp_info(interp, ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_interpinfo_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_interp_info_p(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_interpinfo_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_interp_info_p(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_interpinfo_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = Parrot_interp_info_s(interp, IREG(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_interpinfo_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = Parrot_interp_info_s(interp, ICONST(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_warningson_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_WARNINGS_on(interp, IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_warningson_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_WARNINGS_on(interp, ICONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_warningsoff_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_WARNINGS_off(interp, IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_warningsoff_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_WARNINGS_off(interp, ICONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_errorson_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_ERRORS_on(interp, IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_errorson_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_ERRORS_on(interp, ICONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_errorsoff_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_ERRORS_off(interp, IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_errorsoff_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PARROT_ERRORS_off(interp, ICONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_runcore_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_runcore_switch(interp, SREG(1));
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_runcore_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_runcore_switch(interp, SCONST(1));
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_runinterp_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Interp  * const  new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, (REL_PC + IREG(2)));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_runinterp_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Interp  * const  new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, (REL_PC + ICONST(2)));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_getinterp_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_INTERPRETER);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_sweep_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (ICONST(1)) {
+        Parrot_gc_mark_and_sweep(interp, GC_trace_normal_FLAG);
+    }
+    else {
+        if (Parrot_gc_impatient_pmcs(interp)) {
+            Parrot_gc_mark_and_sweep(interp, GC_lazy_FLAG);
+        }
+
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_collect:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_gc_compact_memory_pool(interp);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_sweepoff:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_block_GC_mark(interp);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_sweepon:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_unblock_GC_mark(interp);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_collectoff:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_block_GC_sweep(interp);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_collecton:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_unblock_GC_sweep(interp);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_needs_destroy_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_gc_pmc_needs_early_collection(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_loadlib_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), NULL);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_loadlib_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), NULL);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_loadlib_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_loadlib_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_loadlib_p_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_loadlib_p_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlfunc_p_p_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlfunc_p_p_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlfunc_p_p_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlfunc_p_p_sc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlfunc_p_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed(interp, PREG(1), PREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlfunc_p_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed(interp, PREG(1), PREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlvar_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void  *         dl_handle = NULL;
+    void  *         p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    if ((p == NULL)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_dlvar_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void  *         dl_handle = NULL;
+    void  *         p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    if ((p == NULL)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_compreg_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  compreg_hash = VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_COMPREG_HASH);
+
+    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_compreg_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  compreg_hash = VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_COMPREG_HASH);
+
+    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SCONST(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_compreg_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  compreg_hash = VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_COMPREG_HASH);
+
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_compreg_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  compreg_hash = VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_COMPREG_HASH);
+
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_callback_p_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_callback_p_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SCONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_annotations_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (interp->code->annotations) {
+        const opcode_t   cur_pos = (( cur_opcode + 2) - interp->code->base.data);
+
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations, cur_pos, NULL);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Hash);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_annotations_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (interp->code->annotations) {
+        const opcode_t   cur_pos = (( cur_opcode + 3) - interp->code->base.data);
+
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations, cur_pos, SREG(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_annotations_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (interp->code->annotations) {
+        const opcode_t   cur_pos = (( cur_opcode + 3) - interp->code->base.data);
+
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations, cur_pos, SCONST(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_band_i_i:
+    {
+    (IREG(1) &= IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_band_i_ic:
+    {
+    (IREG(1) &= ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_band_i_i_i:
+    {
+    IREG(1) = (IREG(2) & IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_band_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) & IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_band_i_i_ic:
+    {
+    IREG(1) = (IREG(2) & ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_bor_i_i:
+    {
+    (IREG(1) |= IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_bor_i_ic:
+    {
+    (IREG(1) |= ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_bor_i_i_i:
+    {
+    IREG(1) = (IREG(2) | IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_bor_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) | IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_bor_i_i_ic:
+    {
+    IREG(1) = (IREG(2) | ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_shl_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = bit_shift_left(IREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shl_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = bit_shift_left(IREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shl_i_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = bit_shift_left(IREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_shl_i_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = bit_shift_left(ICONST(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_shl_i_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = bit_shift_left(IREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_shr_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   signed_shift = (-IREG(2));
+
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shr_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   signed_shift = (-ICONST(2));
+
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shr_i_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   signed_shift = (-IREG(3));
+
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_shr_i_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   signed_shift = (-IREG(3));
+
+    IREG(1) = bit_shift_left(ICONST(2), signed_shift);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_shr_i_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   signed_shift = (-ICONST(3));
+
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lsr_i_i:
+    {
+    const UINTVAL   a = (UINTVAL)IREG(1);
+    const UINTVAL   b = (a >> IREG(2));
+
+    IREG(1) = (INTVAL)b;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_lsr_i_ic:
+    {
+    const UINTVAL   a = (UINTVAL)IREG(1);
+    const UINTVAL   b = (a >> ICONST(2));
+
+    IREG(1) = (INTVAL)b;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_lsr_i_i_i:
+    {
+    IREG(1) = (INTVAL)(((UINTVAL)IREG(2) >> IREG(3)));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lsr_i_ic_i:
+    {
+    IREG(1) = (INTVAL)(((UINTVAL)ICONST(2) >> IREG(3)));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lsr_i_i_ic:
+    {
+    IREG(1) = (INTVAL)(((UINTVAL)IREG(2) >> ICONST(3)));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_bxor_i_i:
+    {
+    (IREG(1) ^= IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_bxor_i_ic:
+    {
+    (IREG(1) ^= ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_bxor_i_i_i:
+    {
+    IREG(1) = (IREG(2) ^ IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_bxor_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) ^ IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_bxor_i_i_ic:
+    {
+    IREG(1) = (IREG(2) ^ ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_i_i_ic:
+    {
+    if ((IREG(1) == IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_ic_i_ic:
+    {
+    if ((ICONST(1) == IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_i_ic_ic:
+    {
+    if ((IREG(1) == ICONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_n_n_ic:
+    {
+    if ((NREG(1) == NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_nc_n_ic:
+    {
+    if ((NCONST(1) == NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_n_nc_ic:
+    {
+    if ((NREG(1) == NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (STRING_equal(interp, SREG(1), SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_sc_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (STRING_equal(interp, SCONST(1), SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (STRING_equal(interp, SREG(1), SCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) == NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_nc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) == NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_str_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (VTABLE_is_equal_string(interp, PREG(1), PREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_num_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (VTABLE_is_equal_num(interp, PREG(1), PREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_addr_s_s_ic:
+    {
+    if ((SREG(1) == SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_addr_sc_s_ic:
+    {
+    if ((SCONST(1) == SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_addr_s_sc_ic:
+    {
+    if ((SREG(1) == SCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_addr_sc_sc_ic:
+    {
+    if ((SCONST(1) == SCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_eq_addr_p_p_ic:
+    {
+    if ((PREG(1) == PREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_i_i_ic:
+    {
+    if ((IREG(1) != IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_ic_i_ic:
+    {
+    if ((ICONST(1) != IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_i_ic_ic:
+    {
+    if ((IREG(1) != ICONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_n_n_ic:
+    {
+    if ((NREG(1) != NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_nc_n_ic:
+    {
+    if ((NCONST(1) != NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_n_nc_ic:
+    {
+    if ((NREG(1) != NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!STRING_equal(interp, SREG(1), SREG(2)))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_sc_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!STRING_equal(interp, SCONST(1), SREG(2)))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!STRING_equal(interp, SREG(1), SCONST(2)))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!VTABLE_is_equal(interp, PREG(1), PREG(2)))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((!VTABLE_is_equal(interp, PREG(1), temp))) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((!VTABLE_is_equal(interp, PREG(1), temp))) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) != NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_nc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) != NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_str_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) != 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_num_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) != 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_addr_s_s_ic:
+    {
+    if ((SREG(1) != SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_addr_sc_s_ic:
+    {
+    if ((SCONST(1) != SREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_addr_s_sc_ic:
+    {
+    if ((SREG(1) != SCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_addr_sc_sc_ic:
+    {
+    if ((SCONST(1) != SCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ne_addr_p_p_ic:
+    {
+    if ((PREG(1) != PREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_i_i_ic:
+    {
+    if ((IREG(1) < IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_ic_i_ic:
+    {
+    if ((ICONST(1) < IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_i_ic_ic:
+    {
+    if ((IREG(1) < ICONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_n_n_ic:
+    {
+    if ((NREG(1) < NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_nc_n_ic:
+    {
+    if ((NCONST(1) < NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_n_nc_ic:
+    {
+    if ((NREG(1) < NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, SREG(1), SREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_sc_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, SCONST(1), SREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, SREG(1), SCONST(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) < 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) < 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) < NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_nc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) < NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_str_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_lt_num_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_i_i_ic:
+    {
+    if ((IREG(1) <= IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_ic_i_ic:
+    {
+    if ((ICONST(1) <= IREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_i_ic_ic:
+    {
+    if ((IREG(1) <= ICONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_n_n_ic:
+    {
+    if ((NREG(1) <= NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_nc_n_ic:
+    {
+    if ((NCONST(1) <= NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_n_nc_ic:
+    {
+    if ((NREG(1) <= NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, SREG(1), SREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_sc_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, SCONST(1), SREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, SREG(1), SCONST(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) <= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) <= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) <= NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_nc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) <= NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_str_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_le_num_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) > 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) > 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) > NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_nc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) > NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) > 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_str_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_gt_num_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) >= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) >= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_n_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) >= NREG(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_nc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_number(interp, PREG(1)) >= NCONST(2))) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_str_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ge_num_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_if_null_p_ic:
+    {
+    if (PMC_IS_NULL(PREG(1))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_if_null_s_ic:
+    {
+    if (STRING_IS_NULL(SREG(1))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unless_null_p_ic:
+    {
+    if ((!PMC_IS_NULL(PREG(1)))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unless_null_s_ic:
+    {
+    if ((!STRING_IS_NULL(SREG(1)))) {
+        do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_i_i:
+    {
+    IREG(1) = (IREG(2) < IREG(3)) ? (-1) : (IREG(2) > IREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) < IREG(3)) ? (-1) : (ICONST(2) > IREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_i_ic:
+    {
+    IREG(1) = (IREG(2) < ICONST(3)) ? (-1) : (IREG(2) > ICONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_n_n:
+    {
+    IREG(1) = (NREG(2) < NREG(3)) ? (-1) : (NREG(2) > NREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_nc_n:
+    {
+    IREG(1) = (NCONST(2) < NREG(3)) ? (-1) : (NCONST(2) > NREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_n_nc:
+    {
+    IREG(1) = (NREG(2) < NCONST(3)) ? (-1) : (NREG(2) > NCONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_cmp(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   l = VTABLE_get_integer(interp, PREG(2));
+
+    IREG(1) = (l < IREG(3)) ? (-1) : (l > IREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   l = VTABLE_get_integer(interp, PREG(2));
+
+    IREG(1) = (l < ICONST(3)) ? (-1) : (l > ICONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   l = VTABLE_get_number(interp, PREG(2));
+
+    IREG(1) = (l < NREG(3)) ? (-1) : (l > NREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   l = VTABLE_get_number(interp, PREG(2));
+
+    IREG(1) = (l < NCONST(3)) ? (-1) : (l > NCONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING * const  l = VTABLE_get_string(interp, PREG(2));
+
+    IREG(1) = STRING_compare(interp, l, SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_i_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING * const  l = VTABLE_get_string(interp, PREG(2));
+
+    IREG(1) = STRING_compare(interp, l, SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_str_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_cmp_string(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_num_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_cmp_num(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_cmp_pmc_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_cmp_pmc(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_issame_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((PREG(2) == PREG(3))) {
+        IREG(1) = 1;
+    }
+    else {
+        IREG(1) = VTABLE_is_same(interp, PREG(2), PREG(3));
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_issame_i_s_s:
+    {
+    IREG(1) = (SREG(2) == SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_issame_i_sc_s:
+    {
+    IREG(1) = (SCONST(2) == SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_issame_i_s_sc:
+    {
+    IREG(1) = (SREG(2) == SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_issame_i_sc_sc:
+    {
+    IREG(1) = (SCONST(2) == SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isntsame_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((PREG(2) == PREG(3))) {
+        IREG(1) = 0;
+    }
+    else {
+        IREG(1) = (!VTABLE_is_same(interp, PREG(2), PREG(3)));
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isntsame_i_s_s:
+    {
+    IREG(1) = (SREG(2) != SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isntsame_i_sc_s:
+    {
+    IREG(1) = (SCONST(2) != SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isntsame_i_s_sc:
+    {
+    IREG(1) = (SREG(2) != SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isntsame_i_sc_sc:
+    {
+    IREG(1) = (SCONST(2) != SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_istrue_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_get_bool(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_isfalse_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (!VTABLE_get_bool(interp, PREG(2)));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_isnull_i_p:
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_isnull_i_pc:
+    {
+    IREG(1) = PMC_IS_NULL(PCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_isnull_i_s:
+    {
+    IREG(1) = STRING_IS_NULL(SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_isnull_i_sc:
+    {
+    IREG(1) = STRING_IS_NULL(SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_isgt_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) > 0));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isge_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) >= 0));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_i_i:
+    {
+    IREG(1) = (IREG(2) <= IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) <= IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_i_ic:
+    {
+    IREG(1) = (IREG(2) <= ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_n_n:
+    {
+    IREG(1) = (NREG(2) <= NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_nc_n:
+    {
+    IREG(1) = (NCONST(2) <= NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_n_nc:
+    {
+    IREG(1) = (NREG(2) <= NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (STRING_compare(interp, SREG(2), SREG(3)) <= 0);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (STRING_compare(interp, SCONST(2), SREG(3)) <= 0);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (STRING_compare(interp, SREG(2), SCONST(3)) <= 0);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isle_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) <= 0));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_i_i:
+    {
+    IREG(1) = ((IREG(2) < IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_ic_i:
+    {
+    IREG(1) = ((ICONST(2) < IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_i_ic:
+    {
+    IREG(1) = ((IREG(2) < ICONST(3))) ? 1 : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_n_n:
+    {
+    IREG(1) = (NREG(2) < NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_nc_n:
+    {
+    IREG(1) = (NCONST(2) < NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_n_nc:
+    {
+    IREG(1) = (NREG(2) < NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (STRING_compare(interp, SREG(2), SREG(3)) < 0);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (STRING_compare(interp, SCONST(2), SREG(3)) < 0);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (STRING_compare(interp, SREG(2), SCONST(3)) < 0);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_islt_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) < 0));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_i_i:
+    {
+    IREG(1) = ((IREG(2) == IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_ic_i:
+    {
+    IREG(1) = ((ICONST(2) == IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_i_ic:
+    {
+    IREG(1) = ((IREG(2) == ICONST(3))) ? 1 : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_n_n:
+    {
+    IREG(1) = (NREG(2) == NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_nc_n:
+    {
+    IREG(1) = (NCONST(2) == NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_n_nc:
+    {
+    IREG(1) = (NREG(2) == NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_equal(interp, SREG(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_equal(interp, SCONST(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_equal(interp, SREG(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_iseq_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (((&PREG(2)) == (&PREG(3)))) {
+        IREG(1) = 1;
+    }
+    else {
+        IREG(1) = VTABLE_is_equal(interp, PREG(2), PREG(3));
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_i_i:
+    {
+    IREG(1) = ((IREG(2) == IREG(3))) ? 0 : 1;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_ic_i:
+    {
+    IREG(1) = ((ICONST(2) == IREG(3))) ? 0 : 1;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_i_ic:
+    {
+    IREG(1) = ((IREG(2) == ICONST(3))) ? 0 : 1;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_n_n:
+    {
+    IREG(1) = (NREG(2) != NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_nc_n:
+    {
+    IREG(1) = (NCONST(2) != NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_n_nc:
+    {
+    IREG(1) = (NREG(2) != NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (!STRING_equal(interp, SREG(2), SREG(3)));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (!STRING_equal(interp, SCONST(2), SREG(3)));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = (!STRING_equal(interp, SREG(2), SCONST(3)));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isne_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (((&PREG(2)) == (&PREG(3)))) {
+        IREG(1) = 0;
+    }
+    else {
+        IREG(1) = (!VTABLE_is_equal(interp, PREG(2), PREG(3)));
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_and_i_i_i:
+    {
+    IREG(1) = IREG(2) ? IREG(3) : IREG(2);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_and_i_ic_i:
+    {
+    IREG(1) = ICONST(2) ? IREG(3) : ICONST(2);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_and_i_i_ic:
+    {
+    IREG(1) = IREG(2) ? ICONST(3) : IREG(2);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_and_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(3) : PREG(2);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_not_i:
+    {
+    IREG(1) = (!IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_not_i_i:
+    {
+    IREG(1) = (!IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_not_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_bool(interp, PREG(1), (!VTABLE_get_bool(interp, PREG(1))));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_not_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   a = (!VTABLE_get_bool(interp, PREG(2)));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Boolean));
+    }
+
+    VTABLE_set_bool(interp, PREG(1), a);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_or_i_i_i:
+    {
+    IREG(1) = IREG(2) ? IREG(2) : IREG(3);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_or_i_ic_i:
+    {
+    IREG(1) = ICONST(2) ? ICONST(2) : IREG(3);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_or_i_i_ic:
+    {
+    IREG(1) = IREG(2) ? IREG(2) : ICONST(3);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_or_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(2) : PREG(3);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_xor_i_i_i:
+    {
+    IREG(1) = ((IREG(2) && (!IREG(3)))) ? IREG(2) : ((IREG(3) && (!IREG(2)))) ? IREG(3) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_xor_i_ic_i:
+    {
+    IREG(1) = ((ICONST(2) && (!IREG(3)))) ? ICONST(2) : ((IREG(3) && (!ICONST(2)))) ? IREG(3) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_xor_i_i_ic:
+    {
+    IREG(1) = ((IREG(2) && (!ICONST(3)))) ? IREG(2) : ((ICONST(3) && (!IREG(2)))) ? ICONST(3) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_xor_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   a = VTABLE_get_bool(interp, PREG(2));
+    const INTVAL   b = VTABLE_get_bool(interp, PREG(3));
+
+    if ((a && (!b))) {
+        PREG(1) = PREG(2);
+    }
+    else {
+        if ((b && (!a))) {
+            PREG(1) = PREG(3);
+        }
+        else {
+            PREG(1) = Parrot_pmc_new(interp, VTABLE_type(interp, PREG(2)));
+            VTABLE_set_bool(interp, PREG(1), 0);
+        }
+
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)ICONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+
+#else
+        if (Parrot_is_nzero(NREG(1))) {
+            Parrot_io_printf(interp, "-0");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+
+#else
+        if (Parrot_is_nzero(NCONST(1))) {
+            Parrot_io_printf(interp, "-0");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = SREG(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = SCONST(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  p = PREG(1);
+    STRING  * const  s = (VTABLE_get_string(interp, p));
+
+    if (s) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)ICONST(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+
+#else
+        if (Parrot_is_nzero(NREG(1))) {
+            Parrot_io_printf(interp, "-0\n");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+
+#else
+        if (Parrot_is_nzero(NCONST(1))) {
+            Parrot_io_printf(interp, "-0\n");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = SREG(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = SCONST(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_say_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  p = PREG(1);
+
+    if (PMC_IS_NULL(p)) {
+        opcode_t  * handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 2, EXCEPTION_UNEXPECTED_NULL, "Null PMC in say");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+    else {
+        STRING  * const  s = VTABLE_get_string(interp, p);
+
+        if (s) {
+            Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+        }
+
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    }
+
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_str_from_int(interp, IREG(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_str_from_int(interp, ICONST(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NREG(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NCONST(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((SREG(2) && PREG(1))) {
+        Parrot_io_putps(interp, PREG(1), SREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((SCONST(2) && PREG(1))) {
+        Parrot_io_putps(interp, PREG(1), SCONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_print_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((PREG(2) && PREG(1))) {
+        STRING  * const  s = VTABLE_get_string(interp, PREG(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_getstdin_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = _PIO_STDIN(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_getstdout_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = _PIO_STDOUT(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_getstderr_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = _PIO_STDERR(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_abs_i:
+    {
+    IREG(1) = abs(IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_abs_n:
+    {
+    NREG(1) = fabs(NREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_abs_i_i:
+    {
+    IREG(1) = abs(IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_abs_n_n:
+    {
+    NREG(1) = fabs(NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_abs_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_absolute(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_abs_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_absolute(interp, PREG(2), PREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_i_i:
+    {
+    (IREG(1) += IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_i_ic:
+    {
+    (IREG(1) += ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_n_n:
+    {
+    (NREG(1) += NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_n_nc:
+    {
+    (NREG(1) += NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_add_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_add_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_add_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_add_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_i_i_i:
+    {
+    IREG(1) = (IREG(2) + IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) + IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_i_i_ic:
+    {
+    IREG(1) = (IREG(2) + ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_n_n_n:
+    {
+    NREG(1) = (NREG(2) + NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_n_nc_n:
+    {
+    NREG(1) = (NCONST(2) + NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_n_n_nc:
+    {
+    NREG(1) = (NREG(2) + NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_add_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_add_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_p_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_dec_i:
+    {
+    (IREG(1)--);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_dec_n:
+    {
+    (NREG(1)--);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_dec_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_decrement(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = IREG(2);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (IREG(1) /= den);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = ICONST(2);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (IREG(1) /= den);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NREG(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (NREG(1) /= den);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_n_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NCONST(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    (NREG(1) /= den);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_divide(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_divide_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_divide_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_divide_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_divide_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_i_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = IREG(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    IREG(1) = (IREG(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_i_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = IREG(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    IREG(1) = (ICONST(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_i_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = ICONST(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    IREG(1) = (IREG(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_i_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = ICONST(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    IREG(1) = (ICONST(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_n_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = (NREG(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_n_nc_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = (NCONST(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_n_n_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = (NREG(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_n_nc_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = (NCONST(2) / den);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_divide(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_div_p_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = IREG(2);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    f = floor((((FLOATVAL)IREG(1)) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = ICONST(2);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    f = floor((((FLOATVAL)IREG(1)) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NREG(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = floor((NREG(1) / den));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_n_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NCONST(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = floor((NREG(1) / den));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_floor_divide(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_floor_divide_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_floor_divide_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_floor_divide_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_floor_divide_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_i_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = IREG(3);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    f = floor(((FLOATVAL)IREG(2) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_i_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = IREG(3);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    f = floor(((FLOATVAL)ICONST(2) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_i_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   den = ICONST(3);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    f = floor(((FLOATVAL)IREG(2) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_n_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = floor((NREG(2) / den));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_n_nc_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = floor((NCONST(2) / den));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_n_n_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    NREG(1) = floor((NREG(2) / den));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_floor_divide(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_fdiv_p_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ceil_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = ceil(NREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_ceil_i_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   f = ceil(NREG(2));
+
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_ceil_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = ceil(NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_floor_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = floor(NREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_floor_i_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const FLOATVAL   f = floor(NREG(2));
+
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_floor_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = floor(NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_inc_i:
+    {
+    (IREG(1)++);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_inc_n:
+    {
+    (NREG(1)++);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_inc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_increment(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_util_intval_mod(IREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_util_intval_mod(IREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_n_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_modulus(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_modulus_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_modulus_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_modulus_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_modulus_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_i_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_i_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_util_intval_mod(ICONST(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_i_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_util_intval_mod(IREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_n_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_n_nc_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_util_floatval_mod(NCONST(2), NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_n_n_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_p_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_i_i:
+    {
+    (IREG(1) *= IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_i_ic:
+    {
+    (IREG(1) *= ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_n_n:
+    {
+    (NREG(1) *= NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_n_nc:
+    {
+    (NREG(1) *= NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_multiply(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_multiply_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_multiply_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_multiply_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_multiply_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_i_i_i:
+    {
+    IREG(1) = (IREG(2) * IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) * IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_i_i_ic:
+    {
+    IREG(1) = (IREG(2) * ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_n_n_n:
+    {
+    NREG(1) = (NREG(2) * NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_n_nc_n:
+    {
+    NREG(1) = (NCONST(2) * NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_n_n_nc:
+    {
+    NREG(1) = (NREG(2) * NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_mul_p_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_neg_i:
+    {
+    IREG(1) = (-IREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_neg_n:
+    {
+    NREG(1) = (-NREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_neg_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_neg(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_neg_i_i:
+    {
+    IREG(1) = (-IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_neg_n_n:
+    {
+    NREG(1) = (-NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_neg_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_neg(interp, PREG(2), PREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_i_i:
+    {
+    (IREG(1) -= IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_i_ic:
+    {
+    (IREG(1) -= ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_n_n:
+    {
+    (NREG(1) -= NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_n_nc:
+    {
+    (NREG(1) -= NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_subtract(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_subtract_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_subtract_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_subtract_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_subtract_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_i_i_i:
+    {
+    IREG(1) = (IREG(2) - IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_i_ic_i:
+    {
+    IREG(1) = (ICONST(2) - IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_i_i_ic:
+    {
+    IREG(1) = (IREG(2) - ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_n_n_n:
+    {
+    NREG(1) = (NREG(2) - NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_n_nc_n:
+    {
+    NREG(1) = (NCONST(2) - NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_n_n_nc:
+    {
+    NREG(1) = (NREG(2) - NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sub_p_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sqrt_n_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = sqrt((FLOATVAL)NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_callmethodcc_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SREG(2);
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
+    opcode_t  * dest = NULL;
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if ((!PMC_IS_NULL(method_pmc))) {
+        PMC  * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+        if ((!PMC_IS_NULL(signature))) {
+            Parrot_pcc_set_object(interp, signature, object);
+        }
+
+        interp->current_cont = NEED_CONTINUATION;
+        dest = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC  * const  _class = VTABLE_get_class(interp, object);
+
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, _class));
+        }
+
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_callmethodcc_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SCONST(2);
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
+    opcode_t  * dest = NULL;
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if ((!PMC_IS_NULL(method_pmc))) {
+        PMC  * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+        if ((!PMC_IS_NULL(signature))) {
+            Parrot_pcc_set_object(interp, signature, object);
+        }
+
+        interp->current_cont = NEED_CONTINUATION;
+        dest = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC  * const  _class = VTABLE_get_class(interp, object);
+
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, _class));
+        }
+
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_callmethodcc_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t         * dest;
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if ((!PMC_IS_NULL(signature))) {
+        Parrot_pcc_set_object(interp, signature, PREG(1));
+    }
+
+    interp->current_cont = NEED_CONTINUATION;
+    dest = VTABLE_invoke(interp, PREG(2), next);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_callmethod_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SREG(2);
+    opcode_t  * const  next =  cur_opcode + 4;
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        if ((!PMC_IS_NULL(signature))) {
+            Parrot_pcc_set_object(interp, signature, object);
+        }
+
+        interp->current_cont = PREG(3);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_callmethod_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SCONST(2);
+    opcode_t  * const  next =  cur_opcode + 4;
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        if ((!PMC_IS_NULL(signature))) {
+            Parrot_pcc_set_object(interp, signature, object);
+        }
+
+        interp->current_cont = PREG(3);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_callmethod_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  object = PREG(1);
+    PMC       * const  method_pmc = PREG(2);
+    opcode_t  * const  next =  cur_opcode + 4;
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if ((!PMC_IS_NULL(signature))) {
+        Parrot_pcc_set_object(interp, signature, object);
+    }
+
+    interp->current_cont = PREG(3);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_tailcallmethod_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SREG(2);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        (PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL);
+        if ((!PMC_IS_NULL(signature))) {
+            Parrot_pcc_set_object(interp, signature, object);
+        }
+
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_tailcallmethod_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SCONST(2);
+    PMC       * const  method_pmc = Parrot_find_method_with_inline_cache(interp, CUR_OPCODE, object, meth);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        (PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL);
+        if ((!PMC_IS_NULL(signature))) {
+            Parrot_pcc_set_object(interp, signature, object);
+        }
+
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_tailcallmethod_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  object = PREG(1);
+    PMC       * const  method_pmc = PREG(2);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    (PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL);
+    if ((!PMC_IS_NULL(signature))) {
+        Parrot_pcc_set_object(interp, signature, object);
+    }
+
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+}
+
+  cg_addmethod_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_add_method(interp, PREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_addmethod_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_add_method(interp, PREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_can_i_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_can(interp, PREG(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_can_i_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_can(interp, PREG(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_does_i_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = SREG(3) ? VTABLE_does(interp, PREG(2), SREG(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_does_i_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = SCONST(3) ? VTABLE_does(interp, PREG(2), SCONST(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_does_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PREG(3) ? VTABLE_does_pmc(interp, PREG(2), PREG(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_does_i_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PCONST(3) ? VTABLE_does_pmc(interp, PREG(2), PCONST(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isa_i_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = SREG(3) ? VTABLE_isa(interp, PREG(2), SREG(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isa_i_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = SCONST(3) ? VTABLE_isa(interp, PREG(2), SCONST(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isa_i_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PREG(3) ? VTABLE_isa_pmc(interp, PREG(2), PREG(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_isa_i_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PCONST(3) ? VTABLE_isa_pmc(interp, PREG(2), PCONST(3)) : 0;
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_newclass_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name = Parrot_pmc_new(interp, enum_class_String);
+
+    VTABLE_set_string_native(interp, name, SREG(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_newclass_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name = Parrot_pmc_new(interp, enum_class_String);
+
+    VTABLE_set_string_native(interp, name, SCONST(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_newclass_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_newclass_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_subclass_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_pc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_pc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_sc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_subclass_p_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_get_class_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_oo_get_class_str(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_class_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_oo_get_class_str(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_class_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_oo_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_class_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_oo_get_class(interp, PCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_class_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_addparent_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_add_parent(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_removeparent_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_remove_parent(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_addrole_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_add_role(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_addattribute_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_add_attribute(interp, PREG(1), SREG(2), PMCNULL);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_addattribute_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_add_attribute(interp, PREG(1), SCONST(2), PMCNULL);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_removeattribute_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_remove_attribute(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_removeattribute_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_remove_attribute(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_getattribute_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_get_attr_with_inline_cache(interp, CUR_OPCODE, PREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_getattribute_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_get_attr_with_inline_cache(interp, CUR_OPCODE, PREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_getattribute_p_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_getattribute_p_p_pc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_getattribute_p_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SCONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_getattribute_p_p_pc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SCONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_setattribute_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_set_attr_with_inline_cache(interp, CUR_OPCODE, PREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_setattribute_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_set_attr_with_inline_cache(interp, CUR_OPCODE, PREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_setattribute_p_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SREG(3), PREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_setattribute_p_pc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SREG(3), PREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_setattribute_p_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SCONST(3), PREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_setattribute_p_pc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SCONST(3), PREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_inspect_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_inspect(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_inspect_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_inspect(interp, PCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_inspect_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_inspect_p_pc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_inspect_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_inspect_p_pc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_typeof_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_name(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_typeof_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_repr_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_get_repr(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_method_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  resume =  cur_opcode + 4;
+
+    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
+    if ((PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1))))) {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SREG(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(resume); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_find_method_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  resume =  cur_opcode + 4;
+
+    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
+    if ((PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1))))) {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+    }
+
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(resume); goto cg_dispatch_address; } while (0);
+    }
+
+}
+
+  cg_defined_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_defined_i_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_defined_i_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_defined_i_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_defined_i_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_exists_i_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_exists_i_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_exists_i_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_exists_i_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_delete_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_delete_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_delete_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_delete_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_elements_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_elements(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_integer(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_integer(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_string(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_string(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_push_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_push_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_n_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_pop_float(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_pop_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_pop_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_string(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_unshift_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shift_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shift_n_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_shift_float(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shift_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_shift_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_shift_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_splice_p_p_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_splice_p_p_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_splice_p_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_splice_p_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_setprop_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_setprop(interp, PREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_setprop_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_setprop(interp, PREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_getprop_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_getprop(interp, PREG(3), SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_getprop_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_getprop(interp, PREG(3), SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_delprop_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_delprop(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_delprop_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_delprop(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_prophash_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_getprops(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_freeze_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_freeze(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_thaw_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_thaw(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_thaw_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_thaw(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_multi_s_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_multi_sc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_multi_s_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_add_multi_sc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_multi_p_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_multi_p_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_multi_p_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_multi_p_sc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_register_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_pmc_gc_register(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_unregister_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_pmc_gc_unregister(interp, PREG(1));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_box_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_box_integer(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_box_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_box_integer(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_box_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_box_number(interp, NREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_box_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_box_number(interp, NCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_box_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_box_string(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_box_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_pmc_box_string(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_iter_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_iter(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_morph_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_morph(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_morph_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_morph(interp, PREG(1), PCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_clone_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_IS_NULL(SREG(2)) ? Parrot_str_new(interp, NULL, 0) : SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_clone_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_IS_NULL(SCONST(2)) ? Parrot_str_new(interp, NULL, 0) : SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_i:
+    {
+    IREG(1) = IREG(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_ic:
+    {
+    IREG(1) = ICONST(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_n:
+    {
+    IREG(1) = (INTVAL)NREG(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_nc:
+    {
+    IREG(1) = (INTVAL)NCONST(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_to_int(interp, SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_n:
+    {
+    NREG(1) = NREG(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_nc:
+    {
+    NREG(1) = NCONST(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_i:
+    {
+    NREG(1) = (FLOATVAL)IREG(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_ic:
+    {
+    NREG(1) = (FLOATVAL)ICONST(2);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_str_to_num(interp, SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_get_number(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_get_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_s:
+    {
+    SREG(1) = SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_sc:
+    {
+    SREG(1) = SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_from_int(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_from_num(interp, NREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_pc:
+    {
+    PREG(1) = PCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_p:
+    {
+    PREG(1) = PREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_native(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_get_integer(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_s_s:
+    {
+    SREG(1) = SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_assign_s_sc:
+    {
+    SREG(1) = SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_setref_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_deref_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_ki_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kic_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_p_ki:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_p_kic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_k_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_kc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_i_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_n_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_s_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_p_k:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_p_p_kc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_clone_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_clone(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_clone_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_clone_p_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_copy_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if (PMC_IS_NULL(PREG(1))) {
+        opcode_t  * const  dest =  cur_opcode + 3;
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+    else {
+        PMC    * const  clone = VTABLE_clone(interp, PREG(2));
+        PMC    * const  meta = VTABLE_getprops(interp, PREG(1));
+        const Parrot_UInt   gc_flags = (PREG(1)->flags & PObj_GC_all_FLAGS);
+
+        Parrot_pmc_destroy(interp, PREG(1));
+        memmove(PREG(1), clone, sizeof(PMC));
+        (PREG(1)->flags |= gc_flags);
+        PARROT_GC_WRITE_BARRIER(interp, PREG(1));
+        PObj_custom_destroy_CLEAR(clone);
+        PMC_data(clone) = NULL;
+        PMC_metadata(clone) = NULL;
+        if ((!PMC_IS_NULL(meta))) {
+            PMC  * const  iter = VTABLE_get_iter(interp, meta);
+
+            while (VTABLE_get_bool(interp, iter)) {
+                STRING  * const  key = VTABLE_shift_string(interp, iter);
+                PMC  * const  value = VTABLE_get_pmc_keyed_str(interp, meta, key);
+
+                VTABLE_setprop(interp, PREG(1), key, value);
+            }
+
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_null_s:
+    {
+    SREG(1) = STRINGNULL;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_null_i:
+    {
+    IREG(1) = 0;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_null_p:
+    {
+    PREG(1) = PMCNULL;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_null_n:
+    {
+    NREG(1) = 0;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_ord_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_ord(interp, SREG(2), 0);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_ord_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_ord(interp, SCONST(2), 0);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_ord_i_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ord_i_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ord_i_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_ord_i_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_chr_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_chr_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_chopn_s_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_chopn_s_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_chopn_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_chopn_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_s_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_s_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_s_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_concat_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_s_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_s_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((IREG(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((ICONST(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((VTABLE_get_integer(interp, PREG(3)) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_repeat_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_i_repeat(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_length_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_length(interp, SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_length_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_length(interp, SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_bytelength_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_bytelength_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_pin_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_str_pin(interp, SREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_unpin_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_str_unpin(interp, SREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_s_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_sc_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_s_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_sc_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_s_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_sc_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_s_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_sc_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_p_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_p_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_p_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_substr_s_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_i_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_i_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_ic_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_ic_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_i_ic_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_i_ic_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_ic_ic_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_ic_ic_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_i_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_i_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_ic_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_ic_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_i_ic_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_i_ic_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_s_ic_ic_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_replace_s_sc_ic_ic_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), 0) : (-1);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), 0) : (-1);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), 0) : (-1);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_sc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : (-1);
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_s_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_sc_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_s_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_sc_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_sc_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_index_i_sc_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_sprintf_s_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_psprintf(interp, SREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sprintf_s_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_psprintf(interp, SCONST(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_sprintf_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_string_native(interp, PREG(1), Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_new_noinit(interp, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_warn_deprecated(interp, "new_s_i op is deprecated");
+    SREG(1) = Parrot_str_new_noinit(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    Parrot_warn_deprecated(interp, "new_s_i op is deprecated");
+    SREG(1) = Parrot_str_new_noinit(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_stringinfo_i_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((SREG(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
+
+                do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_stringinfo_i_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((SCONST(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
+
+                do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_stringinfo_i_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((SREG(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
+
+                do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_stringinfo_i_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((SCONST(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
+
+                do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_upcase_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_upcase(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_upcase_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_downcase_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_downcase(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_downcase_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_titlecase_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_titlecase_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_join_s_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_join_s_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_split_p_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_split_p_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_split_p_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_split_p_sc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_encoding_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_encoding_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_encodingname_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_encoding_name(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_encodingname_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_encoding_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   n = Parrot_encoding_number(interp, SREG(2));
+
+    if ((n < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SREG(2));
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    IREG(1) = n;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_encoding_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const INTVAL   n = Parrot_encoding_number(interp, SCONST(2));
+
+    if ((n < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SCONST(2));
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    IREG(1) = n;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_trans_encoding_s_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_trans_encoding_s_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_trans_encoding_s_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_trans_encoding_s_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_i_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_ic_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_i_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_ic_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_i_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_ic_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_i_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_is_cclass_i_ic_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_s_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_s_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_sc_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_sc_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_s_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_s_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_sc_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_sc_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_s_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_s_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_sc_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_sc_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_s_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_s_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_i_sc_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_cclass_i_ic_sc_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_s_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_s_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_sc_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_sc_i_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_s_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_s_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_sc_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_sc_ic_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_s_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_s_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_sc_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_sc_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_s_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_s_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_i_sc_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_not_cclass_i_ic_sc_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+
+  cg_escape_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_escape(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_compose_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_compose(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_compose_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    SREG(1) = Parrot_str_compose(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_codepoint_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if PARROT_HAS_ICU
+        UErrorCode     err = U_ZERO_ERROR;
+        char  * const  cstr = Parrot_str_to_cstring(interp, SREG(2));
+        UChar32        codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, (&err));
+        Parrot_str_free_cstring(cstr);
+        IREG(1) = U_SUCCESS(err) ? (INTVAL)codepoint : (-1);
+
+#else
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+
+#endif
+;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_codepoint_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if PARROT_HAS_ICU
+        UErrorCode     err = U_ZERO_ERROR;
+        char  * const  cstr = Parrot_str_to_cstring(interp, SCONST(2));
+        UChar32        codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, (&err));
+        Parrot_str_free_cstring(cstr);
+        IREG(1) = U_SUCCESS(err) ? (INTVAL)codepoint : (-1);
+
+#else
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");
+        do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+
+#endif
+;
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_spawnw_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_spawnw_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_spawnw_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_err_i:
+    {
+    IREG(1) = errno;
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_err_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const char  * const  tmp = strerror(errno);
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_err_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const char  * const  tmp = strerror(IREG(2));
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_err_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    const char  * const  tmp = strerror(ICONST(2));
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_time_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_intval_time();
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_time_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    NREG(1) = Parrot_floatval_time();
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_sleep_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((IREG(1) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)IREG(1), next);
+    do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+}
+
+  cg_sleep_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((ICONST(1) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)ICONST(1), next);
+    do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+}
+
+  cg_sleep_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((NREG(1) < 0.0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);
+    do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+}
+
+  cg_sleep_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((NCONST(1) < 0.0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);
+    do { cur_opcode = (opcode_t *)(next); goto cg_dispatch_address; } while (0);
+}
+
+  cg_store_lex_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_PMC(interp, lex_ctx, reg) = PREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_PMC(interp, lex_ctx, reg) = PREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_STR(interp, lex_ctx, reg) = SCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = IREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = IREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = ICONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_INT(interp, lex_ctx, reg) = ICONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_s_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_n:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NREG(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_s_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NCONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_lex_sc_nc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        CTX_REG_NUM(interp, lex_ctx, reg) = NCONST(2);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_dynamic_lex_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_store_dynamic_lex_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        PREG(1) = CTX_REG_PMC(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_PMC, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        PREG(1) = CTX_REG_PMC(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_s_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        SREG(1) = CTX_REG_STR(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_s_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_STR, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        SREG(1) = CTX_REG_STR(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_i_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        IREG(1) = CTX_REG_INT(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_i_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_INT, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        IREG(1) = CTX_REG_INT(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_n_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        NREG(1) = CTX_REG_NUM(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_lex_n_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    INTVAL            reg;
+    PMC      * const  lex_ctx = Parrot_sub_find_lex_register(interp, CUR_OPCODE, lex_name, ctx, REGNO_NUM, (&reg));
+    PMC             * lex_pad;
+
+    if ((!PMC_IS_NULL(lex_ctx))) {
+        NREG(1) = CTX_REG_NUM(interp, lex_ctx, reg);
+    }
+    else {
+        lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_dynamic_lex_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_dynamic_lex_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_caller_lex_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING   * const  lex_name = SREG(2);
+    PMC      *  ctx = CURRENT_CONTEXT(interp);
+    PMC      *  result = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if ((!PMC_IS_NULL(lex_pad))) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+
+        if ((!result)) {
+            result = PMCNULL;
+        }
+
+    }
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_caller_lex_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING   * const  lex_name = SCONST(2);
+    PMC      *  ctx = CURRENT_CONTEXT(interp);
+    PMC      *  result = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if ((!PMC_IS_NULL(lex_pad))) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+
+        if ((!result)) {
+            result = PMCNULL;
+        }
+
+    }
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_namespace_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = cur_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_namespace_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_namespace_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_namespace_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = hll_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_namespace_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_namespace_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_namespace_p:
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = root_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_namespace_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_namespace_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_global_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_global_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_global_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_global_p_pc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_global_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_global_p_pc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_global_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_global_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_global_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_global_p_pc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_global_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_hll_global_p_pc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_global_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_global_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_global_p_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_global_p_pc_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_global_p_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_root_global_p_pc_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_global_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_global_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_global_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_global_pc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_global_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_global_pc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_hll_global_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_hll_global_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_hll_global_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_hll_global_pc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_hll_global_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_hll_global_pc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_root_global_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_root_global_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_root_global_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_root_global_pc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_root_global_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_root_global_pc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_name_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!SREG(2))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_name_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    if ((!SCONST(2))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_sub_not_null_p_s:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  dest =  cur_opcode + 3;
+    PMC       * const  sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
+
+    if (PMC_IS_NULL(sub)) {
+        opcode_t  * handler;
+
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SREG(2));
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PREG(1) = sub;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_find_sub_not_null_p_sc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  * const  dest =  cur_opcode + 3;
+    PMC       * const  sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
+
+    if (PMC_IS_NULL(sub)) {
+        opcode_t  * handler;
+
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SCONST(2));
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(handler); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PREG(1) = sub;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_trap:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    #if defined(__GNUC__) && defined(i386)
+        __asm__("int3");
+
+#endif
+;
+    #if defined(__GNUC__) && defined(PPC)
+        __asm__("trap");
+
+#endif
+;
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_set_label_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    VTABLE_set_pointer(interp, PREG(1), ((CUR_OPCODE + ICONST(2))));
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_label_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    void  * const  ptr = VTABLE_get_pointer(interp, PREG(2));
+
+    IREG(1) = PTR2INTVAL(ptr);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_id_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_hash_pointer((void *)PREG(2), interp->hash_seed);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_get_id_i_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    IREG(1) = Parrot_hash_pointer((void *)PCONST(2), interp->hash_seed);
+    do { cur_opcode += 3; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_ic_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_ic_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_i_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_i_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_ic_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_ic_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_p_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_fetch_p_pc_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_pc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_p_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_pc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_i_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_ic_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_ic_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_i_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_i_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_ic_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_ic_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_s_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_sc_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_s_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_p_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_vivify_p_pc_sc_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_s_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_sc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_s_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_sc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_pc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_new_p_pc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_p_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_pc_i:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_p_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_root_new_p_pc_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; DISPATCH_OP(); } while (0);
+}
+
+  cg_receive_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  *const  dest =  cur_opcode + 2;
+    PMC  * cur_task = Parrot_cx_current_task(interp);
+    Parrot_Task_attributes  * tdata = PARROT_TASK(cur_task);
+    int   msg_count;
+
+    if (PMC_IS_NULL(tdata->mailbox)) {
+        tdata->mailbox = Parrot_pmc_new(interp, enum_class_PMCList);
+        PARROT_GC_WRITE_BARRIER(interp, cur_task);
+        msg_count = 0;
+    }
+    else {
+        msg_count = VTABLE_elements(interp, tdata->mailbox);
+    }
+
+    if ((msg_count > 0)) {
+        PREG(1) = VTABLE_shift_pmc(interp, tdata->mailbox);
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+    else {
+        TASK_recv_block_SET(cur_task);
+        (void)Parrot_cx_stop_task(interp, cur_opcode);
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_wait_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  *const  next =  cur_opcode + 2;
+    PMC  * task = PREG(1);
+    PMC  * cur_task;
+    Parrot_Task_attributes  * tdata;
+
+    if ((!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task")))) {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task.\n");
+    }
+
+    cur_task = Parrot_cx_stop_task(interp, next);
+    tdata = PARROT_TASK(task);
+    if (PMC_IS_NULL(tdata->waiters)) {
+        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        PARROT_GC_WRITE_BARRIER(interp, task);
+    }
+
+    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
+    do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_wait_pc:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  *const  next =  cur_opcode + 2;
+    PMC  * task = PCONST(1);
+    PMC  * cur_task;
+    Parrot_Task_attributes  * tdata;
+
+    if ((!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task")))) {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task.\n");
+    }
+
+    cur_task = Parrot_cx_stop_task(interp, next);
+    tdata = PARROT_TASK(task);
+    if (PMC_IS_NULL(tdata->waiters)) {
+        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        PARROT_GC_WRITE_BARRIER(interp, task);
+    }
+
+    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
+    do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+    do { cur_opcode += 2; DISPATCH_OP(); } while (0);
+}
+
+  cg_pass:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+    opcode_t  *const  next =  cur_opcode + 1;
+    opcode_t  *const  addr = Parrot_cx_preempt_task(interp, interp->scheduler, next);
+
+    do { cur_opcode = (opcode_t *)(addr); goto cg_dispatch_address; } while (0);
+    do { cur_opcode += 1; DISPATCH_OP(); } while (0);
+}
+
+  cg_mod_i_i_i__unless_i_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+/* mod_i_i_i */
+{
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
+}
+/* unless_i_ic */
+{
+    if ((IREG(4) == 0)) {
+        do { cur_opcode += ICONST(5); DISPATCH_OP(); } while (0);
+    }
+
+    do { cur_opcode += 6; DISPATCH_OP(); } while (0);
+}
+}
+
+
+  cg_dec_i__branch_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+/* dec_i */
+{
+    (IREG(1)--);
+}
+/* branch_ic */
+{
+    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(2))) == 0)) {
+        do { cur_opcode = (opcode_t *)(0); goto cg_dispatch_address; } while (0);
+    }
+
+    do { cur_opcode += ICONST(2); DISPATCH_OP(); } while (0);
+}
+}
+
+
+  cg_add_p_p__add_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+}
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(3), PREG(4));
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+}
+
+
+  cg_add_p_p__add_p_p__add_p_p:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+}
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(3), PREG(4));
+}
+/* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(5), PREG(6));
+    do { cur_opcode += 7; DISPATCH_OP(); } while (0);
+}
+}
+
+
+  cg_dec_p__lt_p_ic_ic:
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), cur_opcode);
+    {
+/* dec_p */
+{
+    VTABLE_decrement(interp, PREG(1));
+}
+/* lt_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(3));
+    if ((VTABLE_cmp(interp, PREG(2), temp) < 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(4); DISPATCH_OP(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 5; DISPATCH_OP(); } while (0);
+}
+}
+
+
+}
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -2531,7 +2531,7 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
              document it here.
     */
 
-#ifndef PARROT_HAS_HEADER_SYSMAN
+#ifndef PARROT_HAS_HEADER_SYSMMAN
 
     program_code = read_pbc_file_bytes_handle(interp, io, program_size);
 
@@ -2545,8 +2545,8 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
     */
     if (program_code == (void *)MAP_FAILED) {
         Parrot_warn(interp, PARROT_WARNINGS_IO_FLAG,
-                "Can't mmap file %s, code %i.\n", fullname, errno);
-        program_code = read_pbc_file_bytes_handle(interp, fullname, io, program_size);
+                "Can't mmap file %Ss, code %i.\n", fullname, errno);
+        program_code = read_pbc_file_bytes_handle(interp, io, program_size);
     }
     else
         is_mapped = 1;
@@ -59,6 +59,29 @@ Parrot_freeze(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=item C<void Parrot_freeze_to_handle(PARROT_INTERP, PMC *pmc, PMC *handle)>
+
+Freezes C<pmc> straight to C<handle> in a single pass, writing the image in
+chunks of C<IMAGE_STREAM_CHUNK> bytes as it is produced.  The image is never
+held in memory as a whole.  The handle should have no encoding or the
+C<binary> one.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_freeze_to_handle(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_freeze_to_handle)
+    PMC * const image = Parrot_pmc_new_init(interp, enum_class_ImageIOFreeze, handle);
+    VTABLE_set_pmc(interp, image, pmc);
+}
+
+
 /*
 
 =item C<opcode_t * Parrot_freeze_pbc(PARROT_INTERP, PMC *pmc, const
@@ -242,6 +265,42 @@ Parrot_thaw(PARROT_INTERP, ARGIN(STRING *image))
 }
 
 
+/*
+
+=item C<PMC * Parrot_thaw_from_handle(PARROT_INTERP, PMC *handle)>
+
+Thaws a PMC from an image written to C<handle> by C<Parrot_freeze_to_handle>
+(or by printing the string from C<Parrot_freeze>).  The image is read in
+pieces and is never held in memory as a whole.  The handle should have no
+encoding or the C<binary> one, and is left right after the end of the image.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_thaw_from_handle(PARROT_INTERP, ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_thaw_from_handle)
+    PMC * const info = Parrot_pmc_new_init(interp, enum_class_ImageIOThaw, handle);
+    PMC        *result;
+
+    /* see Parrot_thaw */
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    result = VTABLE_get_pmc(interp, info);
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+
+    return result;
+}
+
+
 /*
 
 =item C<PMC* Parrot_thaw_pbc(PARROT_INTERP, PackFile_ConstTable *ct, const
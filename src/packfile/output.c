@@ -216,6 +216,8 @@ PackFile_ConstTable_pack_size(PARROT_INTERP, ARGMOD(PackFile_Segment *seg))
     for (i = 0; i < self->str.const_count; i++)
         size += PF_size_string(self->str.constants[i]);
 
+    /* see PackFile_ConstTable_pack */
+    Parrot_block_GC_mark(interp);
     self->pmc_hash = Parrot_hash_create(interp, enum_type_PMC, Hash_key_type_PMC_ptr);
     for (i = 0; i < self->pmc.const_count; i++) {
         Hash *seen;
@@ -225,6 +227,7 @@ PackFile_ConstTable_pack_size(PARROT_INTERP, ARGMOD(PackFile_Segment *seg))
     }
     Parrot_hash_destroy(interp, self->pmc_hash);
     self->pmc_hash = NULL;
+    Parrot_unblock_GC_mark(interp);
     size += 1 + (self->ntags * 2);
 
     return size;
@@ -268,6 +271,9 @@ PackFile_ConstTable_pack(PARROT_INTERP,
     for (i = 0; i < self->str.const_count; i++)
         cursor = PF_store_string(cursor, self->str.constants[i]);
 
+    /* The backref records are only in pmc_hash, which a generational GC
+     * doesn't see being filled in; don't let it free them under us */
+    Parrot_block_GC_mark(interp);
     self->pmc_hash = Parrot_hash_create(interp, enum_type_PMC, Hash_key_type_PMC_ptr);
     for (i = 0; i < self->pmc.const_count; i++) {
         Hash *seen;
@@ -277,6 +283,7 @@ PackFile_ConstTable_pack(PARROT_INTERP,
     }
     Parrot_hash_destroy(interp, self->pmc_hash);
     self->pmc_hash = NULL;
+    Parrot_unblock_GC_mark(interp);
 
     *cursor++ = self->ntags;
     for (i = 0; i < self->ntags; i++) {
@@ -17,6 +17,8 @@ Functions in this file represent behaviors for different PackFile segments.
 
 #include "parrot/parrot.h"
 #include "pf_private.h"
+#include "parrot/runcore_api.h"
+#include "parrot/runcore_jit.h"
 #include "pmc/pmc_parrotlibrary.h"
 #include "segments.str"
 
@@ -152,10 +154,12 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC * PackFile_Constant_unpack_pmc(PARROT_INTERP,
     ARGIN(PackFile_ConstTable *constt),
+    ARGIN(PMC *info),
     ARGIN(const opcode_t **cursor))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
 
 static void pf_debug_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
         __attribute__nonnull__(1)
@@ -269,6 +273,7 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
 #define ASSERT_ARGS_PackFile_Constant_unpack_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(constt) \
+    , PARROT_ASSERT_ARG(info) \
     , PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_pf_debug_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -372,9 +377,8 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
         ARGIN(const opcode_t *cursor))
 {
     ASSERT_ARGS(PackFile_ConstTable_unpack)
-    STRING              * const sub_str = CONST_STRING(interp, "Sub");
-    PackFile_ConstTable * const self    = (PackFile_ConstTable *)seg;
-    PackFile            * const pf      = seg->pf;
+    PackFile_ConstTable * const self = (PackFile_ConstTable *)seg;
+    PackFile            * const pf   = seg->pf;
     opcode_t                    i;
 
     PackFile_ConstTable_clear(interp, self);
@@ -408,23 +412,27 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
         self->num.constants[i] = PF_fetch_number(pf, &cursor);
 
     for (i = 0; i < self->str.const_count; i++)
-        self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
+        self->str.constants[i] = Parrot_str_intern(interp,
+                                    PF_fetch_string(interp, pf, &cursor));
 
-    for (i = 0; i < self->pmc.const_count; i++)
-        self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
-
-    for (i = 0; i < self->pmc.const_count; i++) {
-        /* XXX unpack returned the lists of all objects in the object graph
-         * must dereference the first object into the constant slot */
-        PMC      * const pmc  = self->pmc.constants[i]
-                              = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
-
-        /* magically place subs into namespace stashes
-         * XXX make this explicit with :load subs in PBC */
-        if (VTABLE_isa(interp, pmc, sub_str))
-            Parrot_ns_store_sub(interp, pmc);
+    if (self->pmc.const_count) {
+        PMC * const info = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+        VTABLE_set_pointer(interp, info, self);
+
+        for (i = 0; i < self->pmc.const_count; i++)
+            self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, info, &cursor);
     }
 
+    /* XXX unpack returned the lists of all objects in the object graph
+     * must dereference the first object into the constant slot */
+    for (i = 0; i < self->pmc.const_count; i++)
+        self->pmc.constants[i] = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
+
+    /* magically place subs into namespace stashes
+     * XXX make this explicit with :load subs in PBC */
+    if (self->pmc.const_count)
+        Parrot_ns_store_subs(interp, self->pmc.constants, self->pmc.const_count);
+
     self->ntags = PF_fetch_opcode(pf, &cursor);
     self->tag_map = mem_gc_allocate_n_zeroed_typed(interp, self->ntags, PackFile_ConstTagPair);
     for (i = 0; i < self->ntags; i++) {
@@ -485,9 +493,10 @@ const_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
 /*
 
 =item C<static PMC * PackFile_Constant_unpack_pmc(PARROT_INTERP,
-PackFile_ConstTable *constt, const opcode_t **cursor)>
+PackFile_ConstTable *constt, PMC *info, const opcode_t **cursor)>
 
-Unpacks a constant PMC.
+Unpacks a constant PMC using C<info>, the ImageIOThaw visitor shared by all
+PMC constants of the table.  Returns the list of thawed objects.
 
 =cut
 
@@ -497,7 +506,7 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC *
 PackFile_Constant_unpack_pmc(PARROT_INTERP, ARGIN(PackFile_ConstTable *constt),
-        ARGIN(const opcode_t **cursor))
+        ARGIN(PMC *info), ARGIN(const opcode_t **cursor))
 {
     ASSERT_ARGS(PackFile_Constant_unpack_pmc)
     PackFile * const pf         = constt->base.pf;
@@ -505,7 +514,8 @@ PackFile_Constant_unpack_pmc(PARROT_INTERP, ARGIN(PackFile_ConstTable *constt),
     /* thawing the PMC needs the real packfile in place */
     PackFile_ByteCode * const cs_save = interp->code;
     interp->code                      = pf->cur_cs;
-    pmc                               = Parrot_thaw_pbc(interp, constt, cursor);
+    VTABLE_set_string_native(interp, info, PF_fetch_buf(interp, pf, cursor));
+    pmc                               = VTABLE_get_pmc(interp, info);
     /* restore code */
     interp->code = cs_save;
 
@@ -1696,6 +1706,10 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
         mem_gc_free(interp, byte_code->op_func_table);
     if (byte_code->op_info_table)
         mem_gc_free(interp, byte_code->op_info_table);
+    if (byte_code->cgoto_thread)
+        Parrot_runcore_cgoto_free(interp, byte_code);
+    if (byte_code->jit_code)
+        Parrot_runcore_jit_free(interp, byte_code);
     if (byte_code->op_mapping.libs) {
         const opcode_t n_libs = byte_code->op_mapping.n_libs;
         opcode_t i;
@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2011, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+src/platform/generic/reactor.c - I/O readiness polling
+
+=head1 DESCRIPTION
+
+The scheduler parks tasks whose I/O would block and asks the reactor which
+handles have become ready.  A handle is armed for one wait only: once it is
+reported ready it has to be added again.
+
+This version keeps the armed handles in an array and hands all of them to
+C<poll()> (or C<select()> where there is no C<poll()>) on every wait, so a
+wait costs time proportional to the number of parked tasks.  Platforms with a
+better interface provide their own file.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+
+#ifdef _WIN32
+#  include <winsock2.h>
+#elif defined(PARROT_HAS_HEADER_POLL)
+#  include <poll.h>
+#else
+#  include <sys/time.h>
+#  include <sys/types.h>
+#  include <unistd.h>
+#endif
+
+/* HEADERIZER HFILE: none */
+
+#if !defined(_WIN32) && defined(PARROT_HAS_HEADER_POLL)
+#  define PIO_REACTOR_POLL 1
+#endif
+
+typedef struct Parrot_io_reactor {
+    PIOHANDLE *handles;     /* Armed handles */
+    INTVAL    *which;       /* What each handle is waited for */
+    INTVAL     count;       /* Number of armed handles */
+    INTVAL     size;        /* Allocated size of the arrays */
+} Parrot_io_reactor;
+
+/*
+
+=item C<void * Parrot_io_reactor_new(PARROT_INTERP)>
+
+Creates a reactor with no armed handles.
+
+=cut
+
+*/
+
+void *
+Parrot_io_reactor_new(SHIM_INTERP)
+{
+    Parrot_io_reactor * const reactor = mem_internal_allocate_zeroed_typed(Parrot_io_reactor);
+
+    return reactor;
+}
+
+/*
+
+=item C<void Parrot_io_reactor_destroy(PARROT_INTERP, void *reactor)>
+
+Frees the reactor.  Armed handles are not touched.
+
+=cut
+
+*/
+
+void
+Parrot_io_reactor_destroy(SHIM_INTERP, ARGFREE(void *reactor))
+{
+    Parrot_io_reactor * const state = (Parrot_io_reactor *)reactor;
+
+    mem_internal_free(state->handles);
+    mem_internal_free(state->which);
+    mem_internal_free(state);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_ready(PARROT_INTERP, PIOHANDLE handle, INTVAL
+which)>
+
+Checks without waiting whether C<handle> is ready for any of the
+C<PIO_POLL_*> conditions in C<which>.  Also returns true if the handle
+cannot be checked, so that the caller goes ahead with the operation.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_ready(SHIM_INTERP, PIOHANDLE handle, INTVAL which)
+{
+#ifdef PIO_REACTOR_POLL
+    struct pollfd pfd;
+
+    pfd.fd      = handle;
+    pfd.events  = (which & PIO_POLL_READ  ? POLLIN  : 0)
+                | (which & PIO_POLL_WRITE ? POLLOUT : 0);
+    pfd.revents = 0;
+
+    return poll(&pfd, 1, 0) != 0;
+#else
+    fd_set r, w;
+    struct timeval t;
+#  ifdef _WIN32
+    const SOCKET sock = (SOCKET)handle;
+#  else
+    const int sock = handle;
+
+    if (sock >= FD_SETSIZE)
+        return 1;
+#  endif
+
+    t.tv_sec  = 0;
+    t.tv_usec = 0;
+    FD_ZERO(&r);
+    FD_ZERO(&w);
+    if (which & PIO_POLL_READ)
+        FD_SET(sock, &r);
+    if (which & PIO_POLL_WRITE)
+        FD_SET(sock, &w);
+
+    return select(sock + 1, &r, &w, NULL, &t) != 0;
+#endif
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_add(PARROT_INTERP, void *reactor, PIOHANDLE
+handle, INTVAL which)>
+
+Arms C<handle> for the C<PIO_POLL_*> conditions in C<which>.  Returns false
+if the handle cannot be waited on, in which case the caller has to block.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_add(SHIM_INTERP, ARGMOD(void *reactor), PIOHANDLE handle, INTVAL which)
+{
+    Parrot_io_reactor * const state = (Parrot_io_reactor *)reactor;
+
+#ifdef _WIN32
+    if (state->count >= FD_SETSIZE)
+        return 0;
+#elif !defined(PIO_REACTOR_POLL)
+    if (handle >= FD_SETSIZE)
+        return 0;
+#endif
+
+    if (state->count == state->size) {
+        const INTVAL size = state->size ? state->size * 2 : 16;
+
+        state->handles = (PIOHANDLE *)mem_internal_realloc(state->handles,
+                                size * sizeof (PIOHANDLE));
+        state->which   = (INTVAL *)mem_internal_realloc(state->which,
+                                size * sizeof (INTVAL));
+        state->size    = size;
+    }
+
+    state->handles[state->count] = handle;
+    state->which[state->count]   = which;
+    ++state->count;
+
+    return 1;
+}
+
+/*
+
+=item C<void Parrot_io_reactor_remove(PARROT_INTERP, void *reactor, PIOHANDLE
+handle)>
+
+Disarms C<handle>, if it is armed.  Call this before the handle is closed.
+
+=cut
+
+*/
+
+void
+Parrot_io_reactor_remove(SHIM_INTERP, ARGMOD(void *reactor), PIOHANDLE handle)
+{
+    Parrot_io_reactor * const state = (Parrot_io_reactor *)reactor;
+    INTVAL i;
+
+    for (i = 0; i < state->count; ++i) {
+        if (state->handles[i] == handle) {
+            --state->count;
+            state->handles[i] = state->handles[state->count];
+            state->which[i]   = state->which[state->count];
+            return;
+        }
+    }
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_wait(PARROT_INTERP, void *reactor, FLOATVAL
+timeout, PIOHANDLE *ready, INTVAL size)>
+
+Waits up to C<timeout> seconds, or without limit if C<timeout> is negative,
+for armed handles to become ready.  Stores at most C<size> of them in
+C<ready>, disarms them, and returns how many were stored.  Returns 0 on
+timeout or when interrupted by a signal.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_wait(PARROT_INTERP, ARGMOD(void *reactor), FLOATVAL timeout,
+        ARGOUT(PIOHANDLE *ready), INTVAL size)
+{
+    Parrot_io_reactor * const state = (Parrot_io_reactor *)reactor;
+    INTVAL i, n = 0, kept = 0;
+
+#ifdef PIO_REACTOR_POLL
+    struct pollfd * const pfds = mem_gc_allocate_n_typed(interp, state->count, struct pollfd);
+    const int ms = timeout < 0 ? -1 : (int)(timeout * 1000.0 + 0.999);
+
+    for (i = 0; i < state->count; ++i) {
+        pfds[i].fd      = state->handles[i];
+        pfds[i].events  = (state->which[i] & PIO_POLL_READ  ? POLLIN  : 0)
+                        | (state->which[i] & PIO_POLL_WRITE ? POLLOUT : 0);
+        pfds[i].revents = 0;
+    }
+
+    if (poll(pfds, state->count, ms) > 0) {
+        for (i = 0; i < state->count; ++i) {
+            if (pfds[i].revents && n < size)
+                ready[n++] = state->handles[i];
+            else {
+                state->handles[kept] = state->handles[i];
+                state->which[kept]   = state->which[i];
+                ++kept;
+            }
+        }
+        state->count = kept;
+    }
+
+    mem_gc_free(interp, pfds);
+#else
+    fd_set r, w;
+    struct timeval t;
+#  ifdef _WIN32
+    SOCKET max = 0;
+#  else
+    int max = 0;
+#  endif
+
+    FD_ZERO(&r);
+    FD_ZERO(&w);
+    for (i = 0; i < state->count; ++i) {
+#  ifdef _WIN32
+        const SOCKET sock = (SOCKET)state->handles[i];
+#  else
+        const int sock = state->handles[i];
+#  endif
+        if (state->which[i] & PIO_POLL_READ)
+            FD_SET(sock, &r);
+        if (state->which[i] & PIO_POLL_WRITE)
+            FD_SET(sock, &w);
+        if (sock > max)
+            max = sock;
+    }
+
+    t.tv_sec  = (long)timeout;
+    t.tv_usec = (long)((timeout - t.tv_sec) * 1000000.0);
+
+    if (select(max + 1, &r, &w, NULL, timeout < 0 ? NULL : &t) > 0) {
+        for (i = 0; i < state->count; ++i) {
+#  ifdef _WIN32
+            const SOCKET sock = (SOCKET)state->handles[i];
+#  else
+            const int sock = state->handles[i];
+#  endif
+            if ((FD_ISSET(sock, &r) || FD_ISSET(sock, &w)) && n < size)
+                ready[n++] = state->handles[i];
+            else {
+                state->handles[kept] = state->handles[i];
+                state->which[kept]   = state->which[i];
+                ++kept;
+            }
+        }
+        state->count = kept;
+    }
+#endif
+
+    return n;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/scheduler.c>, F<src/platform/linux/reactor.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
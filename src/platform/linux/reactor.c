@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2011, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+src/platform/linux/reactor.c - I/O readiness polling with epoll
+
+=head1 DESCRIPTION
+
+The Linux reactor is an epoll instance.  Handles are added with
+C<EPOLLONESHOT>, so the kernel disarms a handle when it reports it and a wait
+only costs time for the handles that are ready, however many tasks are
+parked.  A handle closed while armed drops out of the set by itself.
+
+See F<src/platform/generic/reactor.c> for the interface.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/* HEADERIZER HFILE: none */
+
+/* Most events fetched from the kernel per wait */
+#define PIO_REACTOR_EVENTS 16
+
+/*
+
+=item C<void * Parrot_io_reactor_new(PARROT_INTERP)>
+
+Creates an epoll instance.
+
+=cut
+
+*/
+
+void *
+Parrot_io_reactor_new(PARROT_INTERP)
+{
+    int * const epfd = mem_internal_allocate_typed(int);
+
+    *epfd = epoll_create(PIO_REACTOR_EVENTS);
+    if (*epfd < 0) {
+        mem_internal_free(epfd);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "epoll_create failed: %Ss", Parrot_platform_strerror(interp, errno));
+    }
+
+    return epfd;
+}
+
+/*
+
+=item C<void Parrot_io_reactor_destroy(PARROT_INTERP, void *reactor)>
+
+Closes the epoll instance.
+
+=cut
+
+*/
+
+void
+Parrot_io_reactor_destroy(SHIM_INTERP, ARGFREE(void *reactor))
+{
+    int * const epfd = (int *)reactor;
+
+    close(*epfd);
+    mem_internal_free(epfd);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_ready(PARROT_INTERP, PIOHANDLE handle, INTVAL
+which)>
+
+Checks without waiting whether C<handle> is ready for C<which>.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_ready(SHIM_INTERP, PIOHANDLE handle, INTVAL which)
+{
+    struct pollfd pfd;
+
+    pfd.fd      = handle;
+    pfd.events  = (which & PIO_POLL_READ  ? POLLIN  : 0)
+                | (which & PIO_POLL_WRITE ? POLLOUT : 0);
+    pfd.revents = 0;
+
+    return poll(&pfd, 1, 0) != 0;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_add(PARROT_INTERP, void *reactor, PIOHANDLE
+handle, INTVAL which)>
+
+Arms C<handle> for one wait.  A handle added before stays registered after
+it fired, so it is re-armed with C<EPOLL_CTL_MOD>.  Regular files can't be
+waited on and make this return false.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_add(SHIM_INTERP, ARGMOD(void *reactor), PIOHANDLE handle, INTVAL which)
+{
+    const int * const epfd = (int *)reactor;
+    struct epoll_event ev;
+
+    ev.events  = EPOLLONESHOT
+               | (which & PIO_POLL_READ  ? EPOLLIN  : 0)
+               | (which & PIO_POLL_WRITE ? EPOLLOUT : 0);
+    ev.data.fd = handle;
+
+    if (epoll_ctl(*epfd, EPOLL_CTL_MOD, handle, &ev) == 0)
+        return 1;
+    if (errno == ENOENT && epoll_ctl(*epfd, EPOLL_CTL_ADD, handle, &ev) == 0)
+        return 1;
+
+    return 0;
+}
+
+/*
+
+=item C<void Parrot_io_reactor_remove(PARROT_INTERP, void *reactor, PIOHANDLE
+handle)>
+
+Takes C<handle> out of the epoll set.
+
+=cut
+
+*/
+
+void
+Parrot_io_reactor_remove(SHIM_INTERP, ARGMOD(void *reactor), PIOHANDLE handle)
+{
+    const int * const epfd = (int *)reactor;
+    struct epoll_event ev;
+
+    /* kernels before 2.6.9 want an event even though it's ignored */
+    epoll_ctl(*epfd, EPOLL_CTL_DEL, handle, &ev);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_wait(PARROT_INTERP, void *reactor, FLOATVAL
+timeout, PIOHANDLE *ready, INTVAL size)>
+
+Waits for armed handles with C<epoll_wait()>.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_wait(SHIM_INTERP, ARGMOD(void *reactor), FLOATVAL timeout,
+        ARGOUT(PIOHANDLE *ready), INTVAL size)
+{
+    const int * const epfd = (int *)reactor;
+    struct epoll_event events[PIO_REACTOR_EVENTS];
+    const int ms = timeout < 0 ? -1 : (int)(timeout * 1000.0 + 0.999);
+    int i, n;
+
+    if (size > PIO_REACTOR_EVENTS)
+        size = PIO_REACTOR_EVENTS;
+
+    n = epoll_wait(*epfd, events, size, ms);
+
+    for (i = 0; i < n; ++i)
+        ready[i] = events[i].data.fd;
+
+    return n > 0 ? n : 0;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/platform/generic/reactor.c>, F<src/scheduler.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
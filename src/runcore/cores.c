@@ -188,6 +188,15 @@ The caveat of course is that the predereferenced computed goto core is only
 available with compilers that support computed goto, such as GCC. Parrot
 will not have access to this core if it is built with a different compiler.
 
+Parrot's C<cgoto> core (also selectable as C<threaded>) is a precomputed goto
+core. F<src/ops/core_ops_cg.c> is generated by opsc from the same F<.ops>
+files as the function core and contains every core op as a label in one
+function. Instead of rewriting the bytecode itself, each code segment gets a
+parallel I<thread> with one label address per C<opcode_t>, which is filled in
+the first time the op at that position runs. Ops from dynamic op libraries
+are still called through the segment's function table. On compilers without
+computed goto the C<cgoto> core behaves like the fast core.
+
 =head2 Tracing Core
 
 To come.
@@ -247,6 +256,7 @@ next opcode, or examine and manipulate data from the executing program.
 
 #include "parrot/oplib/ops.h"
 #include "parrot/oplib/core_ops.h"
+#include "parrot/oplib/core_ops_cg.h"
 #include "parrot/dynext.h"
 
 #include "pmc/pmc_sub.h"
@@ -261,6 +271,15 @@ next opcode, or examine and manipulate data from the executing program.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_cgoto_core(PARROT_INTERP,
+    ARGIN(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static opcode_t * runops_debugger_core(PARROT_INTERP,
@@ -308,6 +327,10 @@ static opcode_t * runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_runops_cgoto_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_runops_debugger_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
@@ -391,6 +414,34 @@ Parrot_runcore_fast_init(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<void Parrot_runcore_cgoto_init(PARROT_INTERP)>
+
+Registers the direct-threaded computed goto runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_cgoto_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "cgoto");
+    coredata->id               = PARROT_CGOTO_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_cgoto_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = NULL;
+    coredata->flags            = 0;
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
 /*
 
 =item C<void Parrot_runcore_exec_init(PARROT_INTERP)>
@@ -507,6 +558,143 @@ runops_fast_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t
 }
 
 
+/*
+
+=item C<static opcode_t * runops_cgoto_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, dispatching through the direct-threaded core ops in
+F<src/ops/core_ops_cg.c>.  Falls back to the fast core if the compiler lacks
+computed goto.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_cgoto_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_cgoto_core)
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+    UNUSED(runcore);
+    return Parrot_runops_core_ops_cg(interp, pc);
+#else
+    return runops_fast_core(interp, runcore, pc);
+#endif
+}
+
+
+/*
+
+=item C<void ** Parrot_runcore_cgoto_thread(PARROT_INTERP, PackFile_ByteCode
+*cs, void *translate)>
+
+Returns the label thread of the code segment C<cs> for the cgoto core,
+creating it if needed.  The thread has one entry per C<opcode_t> of the
+segment; every entry starts out as C<translate>, the label which looks up the
+real op label on first execution.  A segment that has grown since its thread
+was built (e.g. IMCC emitted more code into it) gets a fresh thread.  The old
+one is kept until the segment is destroyed, as a runloop further down the C
+stack may still be dispatching through it.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+void **
+Parrot_runcore_cgoto_thread(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs),
+        ARGIN(void *translate))
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_thread)
+    const size_t size = cs->base.size;
+    void       **block;
+    size_t       i;
+
+    if (cs->cgoto_thread && cs->cgoto_thread_size == size)
+        return cs->cgoto_thread;
+
+    /* the first slot links to the previous thread, and one extra slot at the
+     * end makes sure that an empty segment still gets a thread */
+    block    = mem_gc_allocate_n_typed(interp, size + 2, void *);
+    block[0] = cs->cgoto_thread ? (void *)(cs->cgoto_thread - 1) : NULL;
+
+    cs->cgoto_thread      = block + 1;
+    cs->cgoto_thread_size = size;
+
+    for (i = 0; i <= size; ++i)
+        cs->cgoto_thread[i] = translate;
+
+    return cs->cgoto_thread;
+}
+
+
+/*
+
+=item C<void Parrot_runcore_cgoto_free(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+Frees the cgoto core's label threads of the code segment C<cs>.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_cgoto_free(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_free)
+    void **block = cs->cgoto_thread ? cs->cgoto_thread - 1 : NULL;
+
+    while (block) {
+        void ** const prev = (void **)block[0];
+        mem_gc_free(interp, block);
+        block = prev;
+    }
+
+    cs->cgoto_thread      = NULL;
+    cs->cgoto_thread_size = 0;
+}
+
+
+/*
+
+=item C<void * Parrot_runcore_cgoto_translate(PARROT_INTERP, const
+PackFile_ByteCode *cs, const opcode_t *pc, void * const *labels, void *dynop)>
+
+Returns the address of the label for the op at C<pc>, which the runloop
+patches into the thread it is dispatching through.  C<labels> is indexed by
+core op number; ops from any other op library are dispatched through
+C<dynop>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+void *
+Parrot_runcore_cgoto_translate(PARROT_INTERP, ARGIN(const PackFile_ByteCode *cs),
+        ARGIN(const opcode_t *pc), ARGIN(void * const *labels), ARGIN(void *dynop))
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_translate)
+    const opcode_t     op      = *pc;
+    const op_lib_t    *core    = PARROT_GET_CORE_OPLIB(interp);
+    void              *label   = dynop;
+
+    if (op < 0 || (size_t)op >= cs->op_count)
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "attempt to execute invalid opcode %d", (int)op);
+
+    if (cs->op_info_table[op]->lib == core)
+        label = labels[OP_INFO_OPNUM(cs->op_info_table[op])];
+
+    return label;
+}
+
+
 #ifdef code_start
 #  undef code_start
 #endif
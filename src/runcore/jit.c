@@ -0,0 +1,1409 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/jit.c - Parrot's x86-64 baseline JIT runcore
+
+=head1 DESCRIPTION
+
+The JIT core translates a whole bytecode segment to x86-64 machine code the
+first time code in that segment is run, i.e. on the first invocation of one of
+its Subs.  Integer, float and branch ops from F<src/ops/math.ops>,
+F<src/ops/cmp.ops> and F<src/ops/set.ops> are stitched together from machine
+code templates which work directly on the registers of the current context.
+Every other op becomes a call to its op function, the same as C<DO_OP> in the
+fast core.
+
+There is no register allocation: each template loads its operands from the
+register frame and stores its result back.  The generated code keeps the
+interpreter in C<rbx> and the base of the INTVAL/FLOATVAL register frame in
+C<r13>, reloading the latter after every call out of the JIT code since the
+call may have switched contexts.
+
+Branches inside the segment with constant offsets jump straight to their
+target.  Any other change of control flow goes through a shared I<dispatch>
+sequence, which maps the new pc to its machine code if it is still in the same
+segment and otherwise returns it to C<runops_jit_core>, which carries on in the
+segment now current.  Positions without machine code (e.g. after an invalid
+op) are run one op at a time, as in the fast core.
+
+If the segment grows after it has been translated (IMCC emitting further Subs
+into it), it is translated again.  An old translation may still be on the C
+stack of an outer runloop, so it is freed once no runloop is running it any
+more; one left by an exception stays until the segment is destroyed.  All
+interpreters running a segment share its translations, so they are made and
+freed under a lock.  Templated ops
+have their operands compiled in; ops which are called instead read their
+opcode and arguments at run time, so ops patched in place are still honoured.
+
+On platforms without the JIT (see C<PARROT_HAS_JIT>) the C<jit> core runs like
+the fast core.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/runcore_api.h"
+#include "parrot/runcore_jit.h"
+#include "parrot/oplib/core_ops.h"
+#include "parrot/oplib/ops.h"
+#include "jit.str"
+
+#include "pmc/pmc_callcontext.h"
+
+#ifdef PARROT_HAS_JIT
+#  include <sys/mman.h>
+#endif
+
+#if defined(PARROT_HAS_JIT) && defined(PARROT_HAS_THREADS) \
+    && defined(PARROT_HAS_HEADER_PTHREAD)
+#  include <pthread.h>
+static pthread_mutex_t jit_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define JIT_LOCK()   pthread_mutex_lock(&jit_lock)
+#  define JIT_UNLOCK() pthread_mutex_unlock(&jit_lock)
+#else
+#  define JIT_LOCK()
+#  define JIT_UNLOCK()
+#endif
+
+/* x86-64 register numbers */
+#define JIT_RAX  0
+#define JIT_RCX  1
+#define JIT_RDX  2
+#define JIT_RBX  3
+#define JIT_RSP  4
+#define JIT_RSI  6
+#define JIT_RDI  7
+#define JIT_R13 13
+#define JIT_XMM0 0
+#define JIT_XMM1 1
+
+/* the interpreter and the register frame base live in callee-saved registers */
+#define JIT_INTERP JIT_RBX
+#define JIT_BP     JIT_R13
+
+/* condition codes for Jcc and SETcc */
+#define JIT_CC_AE 0x3
+#define JIT_CC_E  0x4
+#define JIT_CC_NE 0x5
+#define JIT_CC_A  0x7
+#define JIT_CC_P  0xA
+#define JIT_CC_L  0xC
+#define JIT_CC_LE 0xE
+#define JIT_CC_G  0xF
+#define JIT_JMP   (-1)
+
+/* no machine code at this opcode_t (inside an op, or not translated) */
+#define JIT_NO_BLOCK ((size_t)-1)
+
+typedef struct jit_fixup {
+    size_t at;      /* offset of the rel32 to patch */
+    size_t target;  /* opcode_t index of the branch target */
+} jit_fixup;
+
+typedef struct jit_state {
+    Interp            *interp;
+    PackFile_ByteCode *cs;
+    unsigned char     *code;
+    size_t             size;
+    size_t             allocated;
+    size_t            *offsets;     /* machine code offset per opcode_t */
+    jit_fixup         *fixups;
+    size_t             n_fixups;
+    size_t             allocated_fixups;
+    size_t             exit;        /* offset of the epilogue */
+    size_t             dispatch;    /* offset of the dispatch sequence */
+} jit_state;
+
+/* HEADERIZER HFILE: include/parrot/runcore_jit.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void emit_branch(ARGMOD(jit_state *st), int cc, size_t target)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_byte(ARGMOD(jit_state *st), int byte)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_call_op(
+    ARGMOD(jit_state *st),
+    ARGIN(opcode_t *pc),
+    size_t n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*st);
+
+static void emit_int32(ARGMOD(jit_state *st), INTVAL value)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_jump(ARGMOD(jit_state *st), int cc, size_t offset)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_load_int(
+    ARGMOD(jit_state *st),
+    int reg,
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int i)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*st);
+
+static void emit_load_num(
+    ARGMOD(jit_state *st),
+    int xmm,
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int i)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*st);
+
+static void emit_load_num_const(
+    ARGMOD(jit_state *st),
+    int xmm,
+    FLOATVAL value)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_mov_imm(ARGMOD(jit_state *st), int reg, INTVAL value)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_opcode(
+    ARGMOD(jit_state *st),
+    int prefix,
+    int wide,
+    int opcode,
+    int reg,
+    int rm)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_reload_bp(ARGMOD(jit_state *st))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_rm(
+    ARGMOD(jit_state *st),
+    int prefix,
+    int wide,
+    int opcode,
+    int reg,
+    int base,
+    INTVAL disp)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_rr(
+    ARGMOD(jit_state *st),
+    int prefix,
+    int wide,
+    int opcode,
+    int reg,
+    int rm)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_set_pc(ARGMOD(jit_state *st), ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*st);
+
+static void emit_skip_if_unordered(ARGMOD(jit_state *st))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void emit_store_int(
+    ARGMOD(jit_state *st),
+    int reg,
+    ARGIN(const opcode_t *pc),
+    int i)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*st);
+
+static void emit_store_num(
+    ARGMOD(jit_state *st),
+    int xmm,
+    ARGIN(const opcode_t *pc),
+    int i)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*st);
+
+static int emit_template(
+    ARGMOD(jit_state *st),
+    ARGIN(const op_info_t *info),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*st);
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_jit_code * jit_enter(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+static void jit_free(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_jit_code *jit))
+        __attribute__nonnull__(2);
+
+static void jit_free_unused(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+static void jit_leave(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs),
+    ARGMOD(Parrot_jit_code *jit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*cs)
+        FUNC_MODIFIES(*jit);
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_jit_code * jit_translate(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void patch_rel32(ARGMOD(jit_state *st), size_t at, size_t offset)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL reg_offset(
+    ARGIN(const op_info_t *info),
+    ARGIN(const opcode_t *pc),
+    int i)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_jit_core(PARROT_INTERP,
+    Parrot_runcore_t *runcore,
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_emit_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_byte __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_call_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_int32 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_jump __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_load_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_load_num __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_load_num_const __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_mov_imm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_opcode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_reload_bp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_rm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_rr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_set_pc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_skip_if_unordered __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_emit_store_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_store_num __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_emit_template __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_jit_enter __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_jit_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(jit))
+#define ASSERT_ARGS_jit_free_unused __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_jit_leave __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs) \
+    , PARROT_ASSERT_ARG(jit))
+#define ASSERT_ARGS_jit_translate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_patch_rel32 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_reg_offset __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_runops_jit_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_runcore_jit_init(PARROT_INTERP)>
+
+Registers the JIT runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_jit_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_jit_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "jit");
+    coredata->id               = PARROT_JIT_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_jit_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = NULL;
+    coredata->flags            = 0;
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
+/*
+
+=item C<static opcode_t * runops_jit_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, translating each code segment to machine code when it is first
+entered.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_jit_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_jit_core)
+
+    while (pc) {
+        PackFile_ByteCode * const cs  = interp->code;
+        Parrot_jit_code   * const jit = jit_enter(interp, cs);
+
+        if (jit->blocks) {
+            void *block = NULL;
+
+            if (pc >= cs->base.data && pc < cs->base.data + cs->base.size)
+                block = jit->blocks[pc - cs->base.data];
+
+            if (block)
+                pc = (jit->entry)(interp, block);
+            else {
+                Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+                DO_OP(pc, interp);
+            }
+        }
+        else {
+            /* no machine code for this segment, run it like the fast core */
+            do {
+                Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+                DO_OP(pc, interp);
+            } while (pc && interp->code == cs);
+        }
+
+        jit_leave(interp, cs, jit);
+    }
+
+    return pc;
+}
+
+
+/*
+
+=item C<void Parrot_runcore_jit_free(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+Frees all machine code generated for the code segment C<cs>.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_jit_free(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(Parrot_runcore_jit_free)
+    Parrot_jit_code *jit;
+
+    JIT_LOCK();
+    jit = cs->jit_code;
+    cs->jit_code = NULL;
+    JIT_UNLOCK();
+
+    while (jit) {
+        Parrot_jit_code * const prev = jit->prev;
+
+        jit_free(interp, jit);
+        jit = prev;
+    }
+}
+
+/*
+
+=item C<static Parrot_jit_code * jit_enter(PARROT_INTERP, PackFile_ByteCode
+*cs)>
+
+Returns the machine code for the code segment C<cs>, translating the segment
+if it hasn't been translated yet or has grown since, and counts the caller as
+running it until C<jit_leave>.  If no executable memory could be had, or there
+is no JIT for this platform, the result has no C<blocks> and the segment is
+interpreted.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_jit_code *
+jit_enter(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(jit_enter)
+    Parrot_jit_code *jit;
+
+    JIT_LOCK();
+    jit = cs->jit_code;
+
+    if (!jit || jit->size != cs->base.size) {
+        jit          = jit_translate(interp, cs);
+        jit->prev    = cs->jit_code;
+        cs->jit_code = jit;
+        jit_free_unused(interp, cs);
+    }
+
+    ++jit->active;
+    JIT_UNLOCK();
+
+    return jit;
+}
+
+/*
+
+=item C<static void jit_leave(PARROT_INTERP, PackFile_ByteCode *cs,
+Parrot_jit_code *jit)>
+
+Called when the caller of C<jit_enter> no longer runs C<jit>.  Frees C<jit>
+if it has been replaced meanwhile and nobody else runs it.
+
+=cut
+
+*/
+
+static void
+jit_leave(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs), ARGMOD(Parrot_jit_code *jit))
+{
+    ASSERT_ARGS(jit_leave)
+
+    JIT_LOCK();
+    if (--jit->active == 0 && jit != cs->jit_code)
+        jit_free_unused(interp, cs);
+    JIT_UNLOCK();
+}
+
+/*
+
+=item C<static void jit_free_unused(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+Frees the old translations of C<cs> which no runloop is running.  The caller
+holds the lock.
+
+=cut
+
+*/
+
+static void
+jit_free_unused(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(jit_free_unused)
+    Parrot_jit_code *jit = cs->jit_code;
+
+    while (jit && jit->prev) {
+        Parrot_jit_code * const prev = jit->prev;
+
+        if (prev->active)
+            jit = prev;
+        else {
+            jit->prev = prev->prev;
+            jit_free(interp, prev);
+        }
+    }
+}
+
+/*
+
+=item C<static void jit_free(PARROT_INTERP, Parrot_jit_code *jit)>
+
+Frees the translation C<jit>.
+
+=cut
+
+*/
+
+static void
+jit_free(SHIM_INTERP, ARGFREE_NOTNULL(Parrot_jit_code *jit))
+{
+    ASSERT_ARGS(jit_free)
+
+#ifdef PARROT_HAS_JIT
+    if (jit->code)
+        munmap(jit->code, jit->code_size);
+#endif
+    if (jit->blocks)
+        mem_internal_free(jit->blocks);
+
+    mem_internal_free(jit);
+}
+
+/*
+
+=item C<static Parrot_jit_code * jit_translate(PARROT_INTERP, PackFile_ByteCode
+*cs)>
+
+Translates the code segment C<cs> to machine code.
+
+The code starts with the entry function, the shared epilogue and the dispatch
+sequence, followed by the code for each op in the order of the bytecode.  Ops
+fall through into the op after them.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_jit_code *
+jit_translate(PARROT_INTERP, ARGIN(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(jit_translate)
+    Parrot_jit_code * const jit  = mem_internal_allocate_zeroed_typed(Parrot_jit_code);
+    opcode_t        * const base = cs->base.data;
+    const size_t            size = cs->base.size;
+    jit_state               st;
+    size_t                  ops_end;
+    size_t                  i;
+    void                   *mem;
+
+    jit->size   = size;
+
+#ifdef PARROT_HAS_JIT
+    jit->blocks = mem_internal_allocate_n_zeroed_typed(size + 1, void *);
+
+    memset(&st, 0, sizeof (st));
+    st.interp    = interp;
+    st.cs        = cs;
+    st.allocated = 64 + size * 16;
+    st.code      = mem_gc_allocate_n_typed(interp, st.allocated, unsigned char);
+    st.offsets   = mem_gc_allocate_n_typed(interp, size + 1, size_t);
+
+    for (i = 0; i <= size; ++i)
+        st.offsets[i] = JIT_NO_BLOCK;
+
+    /* entry(interp, block): save registers, load the frame, jump to block */
+    emit_byte(&st, 0x53);                                       /* push rbx */
+    emit_byte(&st, 0x41);
+    emit_byte(&st, 0x55);                                       /* push r13 */
+    emit_rr(&st, 0, 1, 0x81, 5, JIT_RSP);                       /* sub rsp, 8 */
+    emit_int32(&st, 8);
+    emit_rr(&st, 0, 1, 0x89, JIT_RDI, JIT_INTERP);              /* mov rbx, rdi */
+    emit_reload_bp(&st);
+    emit_rr(&st, 0, 0, 0xFF, 4, JIT_RSI);                       /* jmp rsi */
+
+    /* exit: return the pc in rax */
+    st.exit = st.size;
+    emit_rr(&st, 0, 1, 0x81, 0, JIT_RSP);                       /* add rsp, 8 */
+    emit_int32(&st, 8);
+    emit_byte(&st, 0x41);
+    emit_byte(&st, 0x5D);                                       /* pop r13 */
+    emit_byte(&st, 0x5B);                                       /* pop rbx */
+    emit_byte(&st, 0xC3);                                       /* ret */
+
+    /* dispatch: continue at the pc in rax if it is in this segment */
+    st.dispatch = st.size;
+    emit_rr(&st, 0, 1, 0x85, JIT_RAX, JIT_RAX);                 /* test rax, rax */
+    emit_jump(&st, JIT_CC_E, st.exit);
+    emit_mov_imm(&st, JIT_RCX, PTR2INTVAL(cs));
+    emit_rm(&st, 0, 1, 0x39, JIT_RCX, JIT_INTERP, offsetof(Interp, code));
+    emit_jump(&st, JIT_CC_NE, st.exit);                         /* interp->code != cs */
+    emit_rr(&st, 0, 1, 0x89, JIT_RAX, JIT_RCX);                 /* mov rcx, rax */
+    emit_mov_imm(&st, JIT_RDX, PTR2INTVAL(base));
+    emit_rr(&st, 0, 1, 0x29, JIT_RDX, JIT_RCX);                 /* sub rcx, rdx */
+    emit_mov_imm(&st, JIT_RDX, (INTVAL)(size * sizeof (opcode_t)));
+    emit_rr(&st, 0, 1, 0x39, JIT_RDX, JIT_RCX);                 /* cmp rcx, rdx */
+    emit_jump(&st, JIT_CC_AE, st.exit);
+    emit_mov_imm(&st, JIT_RDX, PTR2INTVAL(jit->blocks));
+    emit_byte(&st, 0x48);                                       /* mov rdx, [rdx + rcx] */
+    emit_byte(&st, 0x8B);
+    emit_byte(&st, 0x14);
+    emit_byte(&st, 0x0A);
+    emit_rr(&st, 0, 1, 0x85, JIT_RDX, JIT_RDX);                 /* test rdx, rdx */
+    emit_jump(&st, JIT_CC_E, st.exit);
+    emit_rr(&st, 0, 0, 0xFF, 4, JIT_RDX);                       /* jmp rdx */
+
+    for (i = 0; i < size;) {
+        opcode_t * const pc = base + i;
+        const op_info_t *info;
+        size_t           n;
+
+        if (*pc < 0 || (size_t)*pc >= cs->op_count)
+            break;
+
+        info = cs->op_info_table[*pc];
+        n    = info->op_count;
+        ADD_OP_VAR_PART(interp, cs, pc, n);
+
+        if (i + n > size)
+            break;
+
+        st.offsets[i] = st.size;
+
+        if (!emit_template(&st, info, pc))
+            emit_call_op(&st, pc, n);
+
+        i += n;
+    }
+
+    /* ran off the end of the translated code */
+    ops_end = st.size;
+    emit_mov_imm(&st, JIT_RAX, PTR2INTVAL(base + i));
+    emit_jump(&st, JIT_JMP, st.dispatch);
+
+    /* branches to a position without code leave through dispatch */
+    for (i = 0; i < st.n_fixups; ++i) {
+        const jit_fixup * const fixup = &st.fixups[i];
+
+        if (st.offsets[fixup->target] == JIT_NO_BLOCK) {
+            st.offsets[fixup->target] = st.size;
+            emit_mov_imm(&st, JIT_RAX, PTR2INTVAL(base + fixup->target));
+            emit_jump(&st, JIT_JMP, st.dispatch);
+        }
+
+        patch_rel32(&st, fixup->at, st.offsets[fixup->target]);
+    }
+
+    mem = mmap(NULL, st.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+
+    if (mem != MAP_FAILED) {
+        memcpy(mem, st.code, st.size);
+
+        if (mprotect(mem, st.size, PROT_READ | PROT_EXEC) == 0) {
+            jit->code      = (unsigned char *)mem;
+            jit->code_size = st.size;
+            jit->entry     = (Parrot_jit_entry_t)D2FPTR(mem);
+        }
+        else
+            munmap(mem, st.size);
+    }
+
+    if (jit->code) {
+        /* branch stubs only lead back to dispatch, so map the ops alone */
+        for (i = 0; i < size; ++i)
+            if (st.offsets[i] < ops_end)
+                jit->blocks[i] = jit->code + st.offsets[i];
+    }
+    else {
+        mem_internal_free(jit->blocks);
+        jit->blocks = NULL;
+    }
+
+    mem_gc_free(interp, st.code);
+    mem_gc_free(interp, st.offsets);
+    if (st.fixups)
+        mem_gc_free(interp, st.fixups);
+#else
+    /* no JIT for this platform: without blocks the segment is interpreted */
+#endif
+
+    return jit;
+}
+
+/*
+
+=item C<static int emit_template(jit_state *st, const op_info_t *info, opcode_t
+*pc)>
+
+Emits the machine code template for the op at C<pc>, if there is one, and
+returns true.  Returns false for ops which have to be called.
+
+Templates exist for the core ops C<set>, C<null>, C<add>, C<sub>, C<mul>,
+C<inc>, C<dec>, C<neg>, C<abs> (FLOATVAL only), C<cmp>, C<eq>, C<ne>, C<lt>,
+C<le>, C<if>, C<unless>, C<branch> and C<noop> with INTVAL and FLOATVAL
+register and constant arguments.  Division and modulus may throw, so they are
+always called.
+
+=cut
+
+*/
+
+static int
+emit_template(ARGMOD(jit_state *st), ARGIN(const op_info_t *info), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(emit_template)
+    const char * const name  = info->name;
+    const int          nargs = info->op_count - 1;
+    const size_t       here  = pc - st->cs->base.data;
+    int                is_num;
+    int                i;
+
+    if (info->lib != PARROT_GET_CORE_OPLIB(st->interp))
+        return 0;
+
+    for (i = 0; i < nargs; ++i) {
+        switch (info->types[i]) {
+          case PARROT_ARG_I:
+          case PARROT_ARG_IC:
+          case PARROT_ARG_N:
+          case PARROT_ARG_NC:
+            break;
+          default:
+            return 0;
+        }
+    }
+
+    /* type of the last argument, or of the compared ones for branches */
+    is_num = nargs > 0 && (info->types[nargs - 1] & ~PARROT_ARG_CONSTANT) == PARROT_ARG_N;
+
+    if (STREQ(name, "noop")) {
+        return 1;
+    }
+    else if (STREQ(name, "branch") && nargs == 1 && info->types[0] == PARROT_ARG_IC) {
+        /* like the op, give the scheduler a chance to run on every branch */
+        emit_set_pc(st, pc);
+        emit_rr(st, 0, 1, 0x89, JIT_INTERP, JIT_RDI);           /* mov rdi, rbx */
+        emit_mov_imm(st, JIT_RSI, PTR2INTVAL(pc + pc[1]));
+        emit_mov_imm(st, JIT_RAX, PTR2INTVAL(D2FPTR(Parrot_cx_check_scheduler)));
+        emit_rr(st, 0, 0, 0xFF, 2, JIT_RAX);                    /* call rax */
+        emit_reload_bp(st);
+        emit_rr(st, 0, 1, 0x85, JIT_RAX, JIT_RAX);              /* test rax, rax */
+        emit_jump(st, JIT_CC_E, st->exit);
+        emit_branch(st, JIT_JMP, here + pc[1]);
+    }
+    else if (STREQ(name, "set") && nargs == 2) {
+        const int to_num   = info->types[0] == PARROT_ARG_N;
+        const int from_num = is_num;
+
+        if (to_num && from_num) {
+            emit_load_num(st, JIT_XMM0, info, pc, 2);
+        }
+        else if (to_num) {
+            emit_load_int(st, JIT_RAX, info, pc, 2);
+            emit_rr(st, 0xF2, 1, 0x0F2A, JIT_XMM0, JIT_RAX);    /* cvtsi2sd xmm0, rax */
+        }
+        else if (from_num) {
+            emit_load_num(st, JIT_XMM0, info, pc, 2);
+            emit_rr(st, 0xF2, 1, 0x0F2C, JIT_RAX, JIT_XMM0);    /* cvttsd2si rax, xmm0 */
+        }
+        else {
+            emit_load_int(st, JIT_RAX, info, pc, 2);
+        }
+
+        if (to_num)
+            emit_store_num(st, JIT_XMM0, pc, 1);
+        else
+            emit_store_int(st, JIT_RAX, pc, 1);
+    }
+    else if (STREQ(name, "null") && nargs == 1) {
+        /* 0 and 0.0 are both all bits clear */
+        emit_rm(st, 0, 1, 0xC7, 0, JIT_BP, reg_offset(info, pc, 1));
+        emit_int32(st, 0);
+    }
+    else if ((STREQ(name, "add") || STREQ(name, "sub") || STREQ(name, "mul"))
+         && (nargs == 2 || nargs == 3)) {
+        const int a = nargs == 2 ? 1 : 2;
+        const int b = a + 1;
+
+        if (is_num) {
+            const int opc = name[0] == 'a' ? 0x0F58 : name[0] == 's' ? 0x0F5C : 0x0F59;
+
+            emit_load_num(st, JIT_XMM0, info, pc, a);
+            emit_load_num(st, JIT_XMM1, info, pc, b);
+            emit_rr(st, 0xF2, 0, opc, JIT_XMM0, JIT_XMM1);      /* addsd/subsd/mulsd */
+            emit_store_num(st, JIT_XMM0, pc, 1);
+        }
+        else {
+            emit_load_int(st, JIT_RAX, info, pc, a);
+            emit_load_int(st, JIT_RCX, info, pc, b);
+            if (name[0] == 'm')
+                emit_rr(st, 0, 1, 0x0FAF, JIT_RAX, JIT_RCX);    /* imul rax, rcx */
+            else
+                emit_rr(st, 0, 1, name[0] == 'a' ? 0x01 : 0x29, JIT_RCX, JIT_RAX);
+            emit_store_int(st, JIT_RAX, pc, 1);
+        }
+    }
+    else if ((STREQ(name, "inc") || STREQ(name, "dec")) && nargs == 1) {
+        if (is_num) {
+            emit_load_num(st, JIT_XMM0, info, pc, 1);
+            emit_load_num_const(st, JIT_XMM1, 1.0);
+            emit_rr(st, 0xF2, 0, name[0] == 'i' ? 0x0F58 : 0x0F5C, JIT_XMM0, JIT_XMM1);
+            emit_store_num(st, JIT_XMM0, pc, 1);
+        }
+        else {
+            emit_load_int(st, JIT_RAX, info, pc, 1);
+            emit_rr(st, 0, 1, 0xFF, name[0] == 'i' ? 0 : 1, JIT_RAX);  /* inc/dec rax */
+            emit_store_int(st, JIT_RAX, pc, 1);
+        }
+    }
+    else if ((STREQ(name, "neg") || STREQ(name, "abs")) && (nargs == 1 || nargs == 2)) {
+        if (is_num) {
+            /* flip or clear the sign bit */
+            emit_load_num(st, JIT_XMM0, info, pc, nargs);
+            emit_rr(st, 0x66, 1, 0x0F7E, JIT_XMM0, JIT_RAX);    /* movq rax, xmm0 */
+            emit_rr(st, 0, 1, 0x0FBA, name[0] == 'n' ? 7 : 6, JIT_RAX);
+            emit_byte(st, 63);                                  /* btc/btr rax, 63 */
+            emit_rm(st, 0, 1, 0x89, JIT_RAX, JIT_BP, reg_offset(info, pc, 1));
+        }
+        else if (name[0] == 'n') {
+            emit_load_int(st, JIT_RAX, info, pc, nargs);
+            emit_rr(st, 0, 1, 0xF7, 3, JIT_RAX);                /* neg rax */
+            emit_store_int(st, JIT_RAX, pc, 1);
+        }
+        else {
+            /* abs_i truncates through int; leave that to the op */
+            return 0;
+        }
+    }
+    else if (STREQ(name, "cmp") && nargs == 3) {
+        /* rax = (a > b) - (a < b) */
+        emit_rr(st, 0, 0, 0x31, JIT_RAX, JIT_RAX);              /* xor eax, eax */
+        emit_rr(st, 0, 0, 0x31, JIT_RDX, JIT_RDX);              /* xor edx, edx */
+
+        if (is_num) {
+            emit_load_num(st, JIT_XMM0, info, pc, 2);
+            emit_load_num(st, JIT_XMM1, info, pc, 3);
+            emit_rr(st, 0x66, 0, 0x0F2E, JIT_XMM0, JIT_XMM1);   /* ucomisd xmm0, xmm1 */
+            emit_rr(st, 0, 0, 0x0F90 | JIT_CC_A, 0, JIT_RAX);   /* seta al */
+            emit_rr(st, 0x66, 0, 0x0F2E, JIT_XMM1, JIT_XMM0);   /* ucomisd xmm1, xmm0 */
+            emit_rr(st, 0, 0, 0x0F90 | JIT_CC_A, 0, JIT_RDX);   /* seta dl */
+        }
+        else {
+            emit_load_int(st, JIT_RCX, info, pc, 2);
+            emit_load_int(st, JIT_RSI, info, pc, 3);
+            emit_rr(st, 0, 1, 0x39, JIT_RSI, JIT_RCX);          /* cmp rcx, rsi */
+            emit_rr(st, 0, 0, 0x0F90 | JIT_CC_G, 0, JIT_RAX);   /* setg al */
+            emit_rr(st, 0, 0, 0x0F90 | JIT_CC_L, 0, JIT_RDX);   /* setl dl */
+        }
+
+        emit_rr(st, 0, 1, 0x29, JIT_RDX, JIT_RAX);              /* sub rax, rdx */
+        emit_store_int(st, JIT_RAX, pc, 1);
+    }
+    else if ((STREQ(name, "eq") || STREQ(name, "ne") || STREQ(name, "lt") || STREQ(name, "le"))
+         && nargs == 3 && info->types[2] == PARROT_ARG_IC) {
+        const size_t target = here + pc[3];
+
+        is_num = (info->types[0] & ~PARROT_ARG_CONSTANT) == PARROT_ARG_N;
+
+        if (is_num) {
+            emit_load_num(st, JIT_XMM0, info, pc, 1);
+            emit_load_num(st, JIT_XMM1, info, pc, 2);
+
+            /* unordered compares (NaN) are only true for ne */
+            if (name[0] == 'e') {
+                emit_rr(st, 0x66, 0, 0x0F2E, JIT_XMM0, JIT_XMM1); /* ucomisd xmm0, xmm1 */
+                emit_skip_if_unordered(st);
+                emit_branch(st, JIT_CC_E, target);
+            }
+            else if (name[0] == 'n') {
+                emit_rr(st, 0x66, 0, 0x0F2E, JIT_XMM0, JIT_XMM1);
+                emit_branch(st, JIT_CC_P, target);
+                emit_branch(st, JIT_CC_NE, target);
+            }
+            else {
+                /* a < b is b > a, which is false when unordered */
+                emit_rr(st, 0x66, 0, 0x0F2E, JIT_XMM1, JIT_XMM0); /* ucomisd xmm1, xmm0 */
+                emit_branch(st, name[1] == 't' ? JIT_CC_A : JIT_CC_AE, target);
+            }
+        }
+        else {
+            const int cc = name[0] == 'e' ? JIT_CC_E
+                         : name[0] == 'n' ? JIT_CC_NE
+                         : name[1] == 't' ? JIT_CC_L
+                         :                  JIT_CC_LE;
+
+            emit_load_int(st, JIT_RAX, info, pc, 1);
+            emit_load_int(st, JIT_RCX, info, pc, 2);
+            emit_rr(st, 0, 1, 0x39, JIT_RCX, JIT_RAX);          /* cmp rax, rcx */
+            emit_branch(st, cc, target);
+        }
+    }
+    else if ((STREQ(name, "if") || STREQ(name, "unless"))
+         && nargs == 2 && info->types[1] == PARROT_ARG_IC) {
+        const size_t target = here + pc[2];
+        const int    is_if  = name[0] == 'i';
+
+        if ((info->types[0] & ~PARROT_ARG_CONSTANT) == PARROT_ARG_N) {
+            emit_load_num(st, JIT_XMM0, info, pc, 1);
+            emit_rr(st, 0x66, 0, 0x0F57, JIT_XMM1, JIT_XMM1);   /* xorpd xmm1, xmm1 */
+            emit_rr(st, 0x66, 0, 0x0F2E, JIT_XMM0, JIT_XMM1);   /* ucomisd xmm0, xmm1 */
+
+            /* NaN is not zero */
+            if (is_if) {
+                emit_branch(st, JIT_CC_P, target);
+                emit_branch(st, JIT_CC_NE, target);
+            }
+            else {
+                emit_skip_if_unordered(st);
+                emit_branch(st, JIT_CC_E, target);
+            }
+        }
+        else {
+            emit_load_int(st, JIT_RAX, info, pc, 1);
+            emit_rr(st, 0, 1, 0x85, JIT_RAX, JIT_RAX);          /* test rax, rax */
+            emit_branch(st, is_if ? JIT_CC_NE : JIT_CC_E, target);
+        }
+    }
+    else {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static void emit_call_op(jit_state *st, opcode_t *pc, size_t n)>
+
+Emits a call to the op function of the op at C<pc>, which is C<n> opcodes
+long, after storing C<pc> in the current context like the fast core does.
+Execution falls through to the next op if the op returns it, and goes through
+dispatch otherwise.
+
+=cut
+
+*/
+
+static void
+emit_call_op(ARGMOD(jit_state *st), ARGIN(opcode_t *pc), size_t n)
+{
+    ASSERT_ARGS(emit_call_op)
+
+    emit_set_pc(st, pc);                                        /* leaves pc in rdi */
+    emit_rr(st, 0, 1, 0x89, JIT_INTERP, JIT_RSI);               /* mov rsi, rbx */
+    emit_rm(st, 0, 1, 0x8B, JIT_RCX, JIT_INTERP, offsetof(Interp, code));
+    emit_rm(st, 0, 1, 0x8B, JIT_RCX, JIT_RCX, offsetof(PackFile_ByteCode, op_func_table));
+    emit_rm(st, 0, 1, 0x8B, JIT_RAX, JIT_RDI, 0);               /* mov rax, [rdi] */
+    emit_byte(st, 0x48);                                        /* mov rax, [rcx + rax * 8] */
+    emit_byte(st, 0x8B);
+    emit_byte(st, 0x04);
+    emit_byte(st, 0xC1);
+    emit_rr(st, 0, 0, 0xFF, 2, JIT_RAX);                        /* call rax */
+    emit_reload_bp(st);
+    emit_mov_imm(st, JIT_RCX, PTR2INTVAL(pc + n));
+    emit_rr(st, 0, 1, 0x39, JIT_RCX, JIT_RAX);                  /* cmp rax, rcx */
+    emit_jump(st, JIT_CC_NE, st->dispatch);
+}
+
+/*
+
+=item C<static void emit_set_pc(jit_state *st, opcode_t *pc)>
+
+Emits code storing C<pc> as the current pc of the current context.  C<pc> is
+left in C<rdi>.
+
+=item C<static void emit_reload_bp(jit_state *st)>
+
+Emits code loading the register frame base of the current context into
+C<r13>.
+
+=cut
+
+*/
+
+static void
+emit_set_pc(ARGMOD(jit_state *st), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(emit_set_pc)
+
+    emit_mov_imm(st, JIT_RDI, PTR2INTVAL(pc));
+    emit_rm(st, 0, 1, 0x8B, JIT_RCX, JIT_INTERP, offsetof(Interp, ctx));
+    emit_rm(st, 0, 1, 0x8B, JIT_RCX, JIT_RCX, offsetof(PMC, data));
+    emit_rm(st, 0, 1, 0x89, JIT_RDI, JIT_RCX, offsetof(Parrot_Context, current_pc));
+}
+
+static void
+emit_reload_bp(ARGMOD(jit_state *st))
+{
+    ASSERT_ARGS(emit_reload_bp)
+
+    emit_rm(st, 0, 1, 0x8B, JIT_RCX, JIT_INTERP, offsetof(Interp, ctx));
+    emit_rm(st, 0, 1, 0x8B, JIT_RCX, JIT_RCX, offsetof(PMC, data));
+    emit_rm(st, 0, 1, 0x8B, JIT_BP, JIT_RCX, offsetof(Parrot_Context, bp));
+}
+
+/*
+
+=item C<static INTVAL reg_offset(const op_info_t *info, const opcode_t *pc, int
+i)>
+
+Returns the offset from the register frame base of the INTVAL or FLOATVAL
+register which is argument C<i> of the op at C<pc>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+reg_offset(ARGIN(const op_info_t *info), ARGIN(const opcode_t *pc), int i)
+{
+    ASSERT_ARGS(reg_offset)
+
+    if ((info->types[i - 1] & ~PARROT_ARG_CONSTANT) == PARROT_ARG_N)
+        return -(INTVAL)sizeof (FLOATVAL) * (pc[i] + 1);
+
+    return (INTVAL)sizeof (INTVAL) * pc[i];
+}
+
+/*
+
+=item C<static void emit_load_int(jit_state *st, int reg, const op_info_t *info,
+const opcode_t *pc, int i)>
+
+=item C<static void emit_store_int(jit_state *st, int reg, const opcode_t *pc,
+int i)>
+
+Emit code to load argument C<i> of the op at C<pc>, an INTVAL register or
+constant, into the general purpose register C<reg>, or to store C<reg> into
+the INTVAL register which is argument C<i>.
+
+=item C<static void emit_load_num(jit_state *st, int xmm, const op_info_t *info,
+const opcode_t *pc, int i)>
+
+=item C<static void emit_store_num(jit_state *st, int xmm, const opcode_t *pc,
+int i)>
+
+=item C<static void emit_load_num_const(jit_state *st, int xmm, FLOATVAL value)>
+
+The same for FLOATVAL registers and constants and the SSE register C<xmm>.
+Loading a constant clobbers C<rsi>.
+
+=cut
+
+*/
+
+static void
+emit_load_int(ARGMOD(jit_state *st), int reg, ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int i)
+{
+    ASSERT_ARGS(emit_load_int)
+
+    if (info->types[i - 1] == PARROT_ARG_IC)
+        emit_mov_imm(st, reg, pc[i]);
+    else
+        emit_rm(st, 0, 1, 0x8B, reg, JIT_BP, reg_offset(info, pc, i));
+}
+
+static void
+emit_store_int(ARGMOD(jit_state *st), int reg, ARGIN(const opcode_t *pc), int i)
+{
+    ASSERT_ARGS(emit_store_int)
+
+    emit_rm(st, 0, 1, 0x89, reg, JIT_BP, (INTVAL)sizeof (INTVAL) * pc[i]);
+}
+
+static void
+emit_load_num(ARGMOD(jit_state *st), int xmm, ARGIN(const op_info_t *info),
+        ARGIN(const opcode_t *pc), int i)
+{
+    ASSERT_ARGS(emit_load_num)
+
+    if (info->types[i - 1] == PARROT_ARG_NC)
+        emit_load_num_const(st, xmm, st->cs->const_table->num.constants[pc[i]]);
+    else
+        emit_rm(st, 0xF2, 0, 0x0F10, xmm, JIT_BP, reg_offset(info, pc, i));
+}
+
+static void
+emit_store_num(ARGMOD(jit_state *st), int xmm, ARGIN(const opcode_t *pc), int i)
+{
+    ASSERT_ARGS(emit_store_num)
+
+    emit_rm(st, 0xF2, 0, 0x0F11, xmm, JIT_BP, -(INTVAL)sizeof (FLOATVAL) * (pc[i] + 1));
+}
+
+static void
+emit_load_num_const(ARGMOD(jit_state *st), int xmm, FLOATVAL value)
+{
+    ASSERT_ARGS(emit_load_num_const)
+    INTVAL bits;
+
+    memcpy(&bits, &value, sizeof (bits));
+    emit_mov_imm(st, JIT_RSI, bits);
+    emit_rr(st, 0x66, 1, 0x0F6E, xmm, JIT_RSI);                 /* movq xmm, rsi */
+}
+
+/*
+
+=item C<static void emit_branch(jit_state *st, int cc, size_t target)>
+
+Emits a jump, conditional on C<cc> unless that is C<JIT_JMP>, to the op at
+opcode_t index C<target> of the segment.  The offset is filled in once all ops
+have been translated.
+
+=item C<static void emit_jump(jit_state *st, int cc, size_t offset)>
+
+Emits a jump to the machine code at C<offset>, which has already been emitted.
+
+=item C<static void emit_skip_if_unordered(jit_state *st)>
+
+Emits a jump over the conditional branch following it if the last float
+comparison was unordered.
+
+=item C<static void patch_rel32(jit_state *st, size_t at, size_t offset)>
+
+Makes the rel32 operand at C<at> refer to C<offset>.
+
+=cut
+
+*/
+
+static void
+emit_branch(ARGMOD(jit_state *st), int cc, size_t target)
+{
+    ASSERT_ARGS(emit_branch)
+    jit_fixup *fixup;
+
+    /* a target outside of the segment is treated as its end */
+    if (target > st->cs->base.size)
+        target = st->cs->base.size;
+
+    emit_jump(st, cc, st->size);
+
+    if (st->n_fixups == st->allocated_fixups) {
+        st->allocated_fixups = st->allocated_fixups ? st->allocated_fixups * 2 : 16;
+        st->fixups = st->fixups
+                   ? mem_gc_realloc_n_typed(st->interp, st->fixups, st->allocated_fixups, jit_fixup)
+                   : mem_gc_allocate_n_typed(st->interp, st->allocated_fixups, jit_fixup);
+    }
+
+    fixup         = &st->fixups[st->n_fixups++];
+    fixup->at     = st->size - 4;
+    fixup->target = target;
+}
+
+static void
+emit_jump(ARGMOD(jit_state *st), int cc, size_t offset)
+{
+    ASSERT_ARGS(emit_jump)
+
+    if (cc == JIT_JMP)
+        emit_byte(st, 0xE9);
+    else {
+        emit_byte(st, 0x0F);
+        emit_byte(st, 0x80 | cc);
+    }
+
+    emit_int32(st, 0);
+    patch_rel32(st, st->size - 4, offset);
+}
+
+static void
+emit_skip_if_unordered(ARGMOD(jit_state *st))
+{
+    ASSERT_ARGS(emit_skip_if_unordered)
+
+    /* jp over the 6 byte jcc rel32 */
+    emit_byte(st, 0x70 | JIT_CC_P);
+    emit_byte(st, 6);
+}
+
+static void
+patch_rel32(ARGMOD(jit_state *st), size_t at, size_t offset)
+{
+    ASSERT_ARGS(patch_rel32)
+    const INTVAL rel = (INTVAL)offset - (INTVAL)(at + 4);
+    int          i;
+
+    for (i = 0; i < 4; ++i)
+        st->code[at + i] = (unsigned char)((rel >> (8 * i)) & 0xFF);
+}
+
+/*
+
+=item C<static void emit_rm(jit_state *st, int prefix, int wide, int opcode, int
+reg, int base, INTVAL disp)>
+
+Emits the instruction C<opcode> (one byte, or two starting with C<0x0F>) with
+the register or opcode extension C<reg> and the memory operand C<[base +
+disp]>.  C<prefix> is a mandatory prefix (C<0x66>, C<0xF2>) or 0; C<wide>
+selects 64 bit operands.
+
+=item C<static void emit_rr(jit_state *st, int prefix, int wide, int opcode, int
+reg, int rm)>
+
+The same with the register operand C<rm>.
+
+=item C<static void emit_mov_imm(jit_state *st, int reg, INTVAL value)>
+
+Emits code loading C<value> into C<reg>.
+
+=item C<static void emit_byte(jit_state *st, int byte)>
+
+=item C<static void emit_int32(jit_state *st, INTVAL value)>
+
+Append raw bytes to the machine code.
+
+=cut
+
+*/
+
+static void
+emit_rm(ARGMOD(jit_state *st), int prefix, int wide, int opcode, int reg, int base, INTVAL disp)
+{
+    ASSERT_ARGS(emit_rm)
+    const int short_disp = disp >= -128 && disp <= 127;
+
+    emit_opcode(st, prefix, wide, opcode, reg, base);
+    emit_byte(st, (short_disp ? 0x40 : 0x80) | ((reg & 7) << 3) | (base & 7));
+
+    /* rsp and r12 as base need a SIB byte */
+    if ((base & 7) == JIT_RSP)
+        emit_byte(st, 0x24);
+
+    if (short_disp)
+        emit_byte(st, (int)(disp & 0xFF));
+    else
+        emit_int32(st, disp);
+}
+
+static void
+emit_rr(ARGMOD(jit_state *st), int prefix, int wide, int opcode, int reg, int rm)
+{
+    ASSERT_ARGS(emit_rr)
+
+    emit_opcode(st, prefix, wide, opcode, reg, rm);
+    emit_byte(st, 0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+/*
+
+=item C<static void emit_opcode(jit_state *st, int prefix, int wide, int opcode,
+int reg, int rm)>
+
+Emits the prefixes and opcode bytes shared by C<emit_rm> and C<emit_rr>.
+
+=cut
+
+*/
+
+static void
+emit_opcode(ARGMOD(jit_state *st), int prefix, int wide, int opcode, int reg, int rm)
+{
+    ASSERT_ARGS(emit_opcode)
+    const int rex = (wide ? 8 : 0) | (reg & 8 ? 4 : 0) | (rm & 8 ? 1 : 0);
+
+    if (prefix)
+        emit_byte(st, prefix);
+
+    if (rex)
+        emit_byte(st, 0x40 | rex);
+
+    if (opcode > 0xFF)
+        emit_byte(st, opcode >> 8);
+
+    emit_byte(st, opcode & 0xFF);
+}
+
+static void
+emit_mov_imm(ARGMOD(jit_state *st), int reg, INTVAL value)
+{
+    ASSERT_ARGS(emit_mov_imm)
+
+    if (value >= -2147483647L - 1 && value <= 2147483647L) {
+        emit_rr(st, 0, 1, 0xC7, 0, reg);                        /* mov reg, imm32 */
+        emit_int32(st, value);
+    }
+    else {
+        int i;
+
+        emit_byte(st, 0x48 | (reg & 8 ? 1 : 0));                /* mov reg, imm64 */
+        emit_byte(st, 0xB8 | (reg & 7));
+
+        for (i = 0; i < 8; ++i)
+            emit_byte(st, (int)(((UINTVAL)value >> (8 * i)) & 0xFF));
+    }
+}
+
+static void
+emit_byte(ARGMOD(jit_state *st), int byte)
+{
+    ASSERT_ARGS(emit_byte)
+
+    if (st->size == st->allocated) {
+        st->allocated *= 2;
+        st->code = mem_gc_realloc_n_typed(st->interp, st->code, st->allocated, unsigned char);
+    }
+
+    st->code[st->size++] = (unsigned char)byte;
+}
+
+static void
+emit_int32(ARGMOD(jit_state *st), INTVAL value)
+{
+    ASSERT_ARGS(emit_int32)
+    int i;
+
+    for (i = 0; i < 4; ++i)
+        emit_byte(st, (int)((value >> (8 * i)) & 0xFF));
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/runcore/cores.c>, F<include/parrot/runcore_jit.h>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
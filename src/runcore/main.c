@@ -19,6 +19,7 @@ The runcore API handles running the operations.
 
 #include "parrot/parrot.h"
 #include "parrot/runcore_api.h"
+#include "parrot/runcore_jit.h"
 #include "parrot/runcore_profiling.h"
 #include "parrot/runcore_subprof.h"
 #include "parrot/oplib/core_ops.h"
@@ -68,6 +69,8 @@ Parrot_runcore_init(PARROT_INTERP)
 
     Parrot_runcore_slow_init(interp);
     Parrot_runcore_fast_init(interp);
+    Parrot_runcore_cgoto_init(interp);
+    Parrot_runcore_jit_init(interp);
 
     Parrot_runcore_subprof_init(interp);
     Parrot_runcore_exec_init(interp);
@@ -387,7 +387,9 @@ ARGIN(opcode_t *pc))
         preop_ctx             = PMC_data_typed(preop_ctx_pmc, Parrot_Context*);
         preop_ctx->current_pc = pc;
         preop_pc              = pc;
-        preop_opname          = interp->code->op_info_table[*pc]->name;
+        preop_opname          = Profiling_full_opnames_TEST(runcore)
+                              ? interp->code->op_info_table[*pc]->full_name
+                              : interp->code->op_info_table[*pc]->name;
         preop_line_num        = get_line_num_from_cache(interp, runcore, preop_ctx_pmc);
 
         Profiling_exit_check_CLEAR(runcore);
@@ -934,6 +936,11 @@ init_basic_output(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore))
         Profiling_canonical_output_SET(runcore);
     }
 
+    /* full op names are needed to find superinstruction candidates */
+    if (!STRING_IS_NULL(Parrot_getenv(interp, CONST_STRING(interp, "PARROT_PROFILING_FULL_OPNAMES")))) {
+        Profiling_full_opnames_SET(runcore);
+    }
+
 }
 
 /*
@@ -21,6 +21,8 @@ exceptions, async I/O, and concurrent tasks (threads).
 #include "parrot/runcore_api.h"
 #include "parrot/alarm.h"
 #include "parrot/scheduler.h"
+#include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
 
 #include "pmc/pmc_scheduler.h"
 #include "pmc/pmc_task.h"
@@ -28,6 +30,7 @@ exceptions, async I/O, and concurrent tasks (threads).
 #include "pmc/pmc_alarm.h"
 #include "pmc/pmc_pmclist.h"
 #include "pmc/pmc_continuation.h"
+#include "pmc/pmc_sub.h"
 
 #include "scheduler.str"
 
@@ -42,10 +45,20 @@ static void Parrot_cx_disable_preemption(PARROT_INTERP)
 static void Parrot_cx_enable_preemption(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_CAN_RETURN_NULL
+static opcode_t * Parrot_cx_find_method_call(PARROT_INTERP,
+    ARGMOD(Parrot_Scheduler_attributes *sched))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*sched);
+
 #define ASSERT_ARGS_Parrot_cx_disable_preemption __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_enable_preemption __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_cx_find_method_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sched))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -77,6 +90,11 @@ Parrot_cx_init_scheduler(PARROT_INTERP)
         /* Make sure the program can handle alarm signals */
         Parrot_alarm_init();
     }
+
+    /* A thread can't use its parent's scheduler, but it leaves signals to
+     * the parent's thread */
+    else if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        interp->scheduler = Parrot_pmc_new(interp, enum_class_Scheduler);
 }
 
 /*
@@ -134,7 +152,7 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
     ASSERT_ARGS(Parrot_cx_outer_runloop)
     PMC * const scheduler = interp->scheduler;
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    INTVAL alarm_count;
+    INTVAL alarm_count, io_count;
 
     do {
         while (VTABLE_get_integer(interp, sched->task_queue) > 0) {
@@ -148,10 +166,30 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
 
             /* add expired alarms to the task queue */
             Parrot_cx_check_alarms(interp, interp->scheduler);
+
+            /* and tasks whose handles have become ready */
+            Parrot_cx_check_io(interp, interp->scheduler, 0.0);
         }
 
         alarm_count = VTABLE_get_integer(interp, sched->alarms);
-        if (alarm_count > 0) {
+        io_count    = VTABLE_elements(interp, sched->io_waits);
+        if (io_count > 0) {
+            /* Sleep in the reactor until a handle is ready or the next
+             * alarm is due */
+            FLOATVAL timeout = -1.0;
+
+            if (alarm_count > 0) {
+                PMC * const alarm = VTABLE_shift_pmc(interp, sched->alarms);
+                timeout = VTABLE_get_number(interp, alarm) - Parrot_floatval_time();
+                VTABLE_unshift_pmc(interp, sched->alarms, alarm);
+                if (timeout < 0.0)
+                    timeout = 0.0;
+            }
+
+            Parrot_cx_check_io(interp, interp->scheduler, timeout);
+            Parrot_cx_check_alarms(interp, interp->scheduler);
+        }
+        else if (alarm_count > 0) {
 #ifdef _WIN32
             /* TODO: Implement on Windows */
 #else
@@ -160,7 +198,7 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
 #endif
             Parrot_cx_check_alarms(interp, interp->scheduler);
         }
-    } while (alarm_count);
+    } while (alarm_count || io_count);
 }
 
 /*
@@ -608,6 +646,143 @@ Parrot_cx_check_alarms(PARROT_INTERP, ARGIN(PMC *scheduler))
 
 /*
 
+=item C<INTVAL Parrot_cx_park_for_io(PARROT_INTERP, PMC *handle, INTVAL which)>
+
+Called by a handle method before an operation that might block.  C<which>
+says whether the method is about to read (C<PIO_POLL_READ>) or write
+(C<PIO_POLL_WRITE>).  If the operation would have to wait for the OS, the
+current task is stopped and handed to the reactor, and true is returned: the
+method must then return at once, and the invoking NativePCCMethod leaves the
+runloop.  When the handle is ready the task is scheduled again and the method
+call runs from its C<set_args>, so it must not have changed anything before
+parking.
+
+Otherwise returns false, and the method goes ahead and blocks as usual.  That
+is the case whenever the task can't be resumed at the call: before the
+scheduler runs, in nested runloops, for methods called from C, and for handles
+the reactor can't wait on.  Only one task can wait on a handle at a time.
+Closing the handle wakes the task; see C<Parrot_cx_wake_io>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_cx_park_for_io(PARROT_INTERP, ARGIN(PMC *handle), INTVAL which)
+{
+    ASSERT_ARGS(Parrot_cx_park_for_io)
+    Parrot_Scheduler_attributes *sched;
+    PIOHANDLE  os_handle;
+    opcode_t  *call_pc;
+    PMC       *task;
+
+    if (!interp->scheduler || PMC_IS_NULL(interp->cur_task)
+    ||  interp->current_runloop_level > 1
+    ||  interp->current_cont != NEED_CONTINUATION)
+        return 0;
+
+    sched = PARROT_SCHEDULER(interp->scheduler);
+    if (!sched->enable_scheduling)
+        return 0;
+
+    if (!Parrot_io_would_block(interp, handle, which))
+        return 0;
+
+    os_handle = Parrot_io_get_os_handle(interp, handle);
+    if (VTABLE_exists_keyed_int(interp, sched->io_waits, (INTVAL)os_handle))
+        return 0;
+
+    call_pc = Parrot_cx_find_method_call(interp, sched);
+    if (!call_pc)
+        return 0;
+
+    if (!sched->reactor)
+        sched->reactor = Parrot_io_reactor_new(interp);
+    if (!Parrot_io_reactor_add(interp, sched->reactor, os_handle, which))
+        return 0;
+
+    task = Parrot_cx_stop_task(interp, call_pc);
+    TASK_io_block_SET(task);
+    VTABLE_set_pmc_keyed_int(interp, sched->io_waits, (INTVAL)os_handle, task);
+
+    return 1;
+}
+
+/*
+
+=item C<void Parrot_cx_check_io(PARROT_INTERP, PMC *scheduler, FLOATVAL
+timeout)>
+
+Waits up to C<timeout> seconds (without limit if negative) for handles that
+tasks are parked on, and adds the tasks whose handles are ready to the task
+queue.
+
+=cut
+
+*/
+
+void
+Parrot_cx_check_io(PARROT_INTERP, ARGIN(PMC *scheduler), FLOATVAL timeout)
+{
+    ASSERT_ARGS(Parrot_cx_check_io)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PIOHANDLE ready[16];
+    INTVAL    i, n;
+
+    if (!sched->reactor || !VTABLE_elements(interp, sched->io_waits))
+        return;
+
+    n = Parrot_io_reactor_wait(interp, sched->reactor, timeout, ready,
+            sizeof ready / sizeof *ready);
+
+    for (i = 0; i < n; ++i) {
+        const INTVAL key  = (INTVAL)ready[i];
+        PMC * const  task = VTABLE_get_pmc_keyed_int(interp, sched->io_waits, key);
+
+        VTABLE_delete_keyed_int(interp, sched->io_waits, key);
+        if (!PMC_IS_NULL(task))
+            Parrot_cx_schedule_task(interp, task);
+    }
+}
+
+/*
+
+=item C<void Parrot_cx_wake_io(PARROT_INTERP, PIOHANDLE os_handle)>
+
+Called when C<os_handle> is about to be closed.  A task parked on it is
+scheduled again, so that it repeats its call on the closed handle and gets
+the error or end of file from that, instead of waiting forever.
+
+=cut
+
+*/
+
+void
+Parrot_cx_wake_io(PARROT_INTERP, PIOHANDLE os_handle)
+{
+    ASSERT_ARGS(Parrot_cx_wake_io)
+    Parrot_Scheduler_attributes *sched;
+    PMC *task;
+
+    if (!interp->scheduler || os_handle == PIO_INVALID_HANDLE)
+        return;
+
+    sched = PARROT_SCHEDULER(interp->scheduler);
+    if (!sched->reactor
+    ||  !VTABLE_exists_keyed_int(interp, sched->io_waits, (INTVAL)os_handle))
+        return;
+
+    task = VTABLE_get_pmc_keyed_int(interp, sched->io_waits, (INTVAL)os_handle);
+    VTABLE_delete_keyed_int(interp, sched->io_waits, (INTVAL)os_handle);
+    Parrot_io_reactor_remove(interp, sched->reactor, os_handle);
+
+    if (!PMC_IS_NULL(task))
+        Parrot_cx_schedule_task(interp, task);
+}
+
+/*
+
 =back
 
 =head2 Opcode Functions
@@ -699,6 +874,112 @@ Parrot_cx_disable_preemption(PARROT_INTERP)
 
 /*
 
+=item C<static opcode_t * Parrot_cx_find_method_call(PARROT_INTERP,
+Parrot_Scheduler_attributes *sched)>
+
+Returns the C<set_args> op of the C<callmethodcc> that invoked the running
+method, or NULL if the method wasn't called that way.  The context only
+records where the call returns to, so the current sub is decoded from its
+start up to there.  Calls found are cached in C<sched> by return address, for
+the code segment they were found in.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+Parrot_cx_find_method_call(PARROT_INTERP, ARGMOD(Parrot_Scheduler_attributes *sched))
+{
+    ASSERT_ARGS(Parrot_cx_find_method_call)
+    PMC      * const ctx  = CURRENT_CONTEXT(interp);
+    PMC      * const sub  = Parrot_pcc_get_sub(interp, ctx);
+    opcode_t * const next = Parrot_pcc_get_pc(interp, ctx);
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    const op_info_t  *args = NULL, *call = NULL;
+    opcode_t         *args_pc = NULL, *call_pc = NULL;
+    Parrot_Sub_attributes *sub_attrs;
+    PackFile_ByteCode     *seg;
+    opcode_t              *pc;
+
+    if (PMC_IS_NULL(sub) || !next)
+        return NULL;
+    if (!VTABLE_isa(interp, sub, CONST_STRING(interp, "Sub")))
+        return NULL;
+
+    PMC_get_sub(interp, sub, sub_attrs);
+    seg = sub_attrs->seg;
+    if (seg != interp->code)
+        return NULL;
+
+    pc = seg->base.data + sub_attrs->start_offs;
+    if (next <= pc || next > seg->base.data + sub_attrs->end_offs)
+        return NULL;
+
+    if (sched->io_calls && sched->io_calls_seg == seg) {
+        opcode_t * const cached = (opcode_t *)Parrot_hash_get(interp, sched->io_calls, next);
+
+        if (cached)
+            return cached;
+    }
+
+    while (pc < next) {
+        const op_info_t *info;
+        size_t           n;
+
+        if (*pc < 0 || (size_t)*pc >= seg->op_count)
+            return NULL;
+
+        info = seg->op_info_table[*pc];
+        n    = info->op_count;
+
+        /* the signature gives the number of variable arguments */
+        if (info->lib == core_ops) {
+            switch (OP_INFO_OPNUM(info)) {
+              case PARROT_OP_set_args_pc:
+              case PARROT_OP_get_results_pc:
+              case PARROT_OP_get_params_pc:
+              case PARROT_OP_set_returns_pc:
+                n += VTABLE_elements(interp, seg->const_table->pmc.constants[pc[1]]);
+                break;
+              default:
+                break;
+            }
+        }
+
+        args    = call;
+        args_pc = call_pc;
+        call    = info;
+        call_pc = pc;
+        pc     += n;
+    }
+
+    if (pc != next || !args || args->lib != core_ops || call->lib != core_ops
+    ||  OP_INFO_OPNUM(args) != PARROT_OP_set_args_pc)
+        return NULL;
+
+    switch (OP_INFO_OPNUM(call)) {
+      case PARROT_OP_callmethodcc_p_s:
+      case PARROT_OP_callmethodcc_p_sc:
+      case PARROT_OP_callmethodcc_p_p:
+        break;
+      default:
+        return NULL;
+    }
+
+    if (sched->io_calls_seg != seg) {
+        if (sched->io_calls)
+            Parrot_hash_destroy(interp, sched->io_calls);
+        sched->io_calls     = Parrot_hash_new_pointer_hash(interp);
+        sched->io_calls_seg = seg;
+    }
+    Parrot_hash_put(interp, sched->io_calls, next, args_pc);
+
+    return args_pc;
+}
+
+/*
+
 =back
 
 =head1 SEE ALSO
@@ -37,6 +37,24 @@ STRING *STRINGNULL;
     PARROT_ASSERT((s)->encoding); \
     PARROT_ASSERT(!PObj_on_free_list_TEST(s))
 
+/* Number of strings whose character offsets are cached */
+#define STRING_INDEX_SLOTS 4
+
+/* Byte offsets of the characters 0, STRING_INDEX_STEP, 2 * STRING_INDEX_STEP
+ * and so on of a few long variable width strings */
+typedef struct _Parrot_String_Index {
+    struct {
+        const STRING *str;          /* Indexed string */
+        const char   *strstart;     /* Its buffer and lengths when indexed */
+        UINTVAL       bufused;
+        UINTVAL       strlen;
+        size_t        gc_runs;      /* GC runs when indexed */
+        UINTVAL      *offsets;
+        UINTVAL       size;         /* Allocated number of offsets */
+    } slots[STRING_INDEX_SLOTS];
+    UINTVAL next;                   /* Slot to reuse next */
+} Parrot_String_Index;
+
 /* HEADERIZER HFILE: include/parrot/string_funcs.h */
 
 /* HEADERIZER BEGIN: static */
@@ -135,9 +153,14 @@ Parrot_str_init(PARROT_INTERP)
     if (interp->parent_interpreter) {
         interp->const_cstring_table =
             interp->parent_interpreter->const_cstring_table;
-        interp->const_cstring_hash  =
-            interp->parent_interpreter->const_cstring_hash;
-        return;
+
+        if (!Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
+            interp->const_cstring_hash  =
+                interp->parent_interpreter->const_cstring_hash;
+            interp->intern_hash         =
+                interp->parent_interpreter->intern_hash;
+            return;
+        }
     }
 
     /* Set up the cstring cache, then load the basic encodings */
@@ -146,6 +169,25 @@ Parrot_str_init(PARROT_INTERP)
                                         Hash_key_type_cstring,
                                         n_parrot_cstrings);
     interp->const_cstring_hash  = const_cstring_hash;
+
+    /* A thread caches the constants it creates itself, as the parent's
+     * cache isn't locked.  It interns nothing, as strings interned by two
+     * tables could be equal without being the same string. */
+    if (interp->parent_interpreter) {
+        for (i = 0; i < n_parrot_cstrings; ++i) {
+            DECL_CONST_CAST;
+            Parrot_hash_put(interp, const_cstring_hash,
+                PARROT_const_cast(char *, parrot_cstrings[i].string),
+                (void *)interp->const_cstring_table[i]);
+        }
+        return;
+    }
+
+    interp->intern_hash         = Parrot_hash_create_sized(interp,
+                                        enum_type_STRING,
+                                        Hash_key_type_STRING_enc,
+                                        n_parrot_cstrings);
+
     Parrot_encodings_init(interp);
 
     /* initialize STRINGNULL, but not in the constant table */
@@ -158,12 +200,12 @@ Parrot_str_init(PARROT_INTERP)
 
     for (i = 0; i < n_parrot_cstrings; ++i) {
         DECL_CONST_CAST;
-        STRING * const s =
+        STRING * const s = Parrot_str_intern(interp,
             Parrot_str_new_init(interp,
                 parrot_cstrings[i].string,
                 parrot_cstrings[i].len,
                 Parrot_default_encoding_ptr,
-                PObj_external_FLAG|PObj_constant_FLAG);
+                PObj_external_FLAG|PObj_constant_FLAG));
         Parrot_hash_put(interp, const_cstring_hash,
             PARROT_const_cast(char *, parrot_cstrings[i].string), (void *)s);
         interp->const_cstring_table[i] = s;
@@ -187,13 +229,117 @@ Parrot_str_finish(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_str_finish)
 
-    /* all are shared between interpreters */
+    /* all but a thread's cstring cache are shared between interpreters */
     if (!interp->parent_interpreter) {
         mem_internal_free(interp->const_cstring_table);
         interp->const_cstring_table = NULL;
         Parrot_deinit_encodings(interp);
         Parrot_hash_destroy(interp, interp->const_cstring_hash);
+        Parrot_hash_destroy(interp, interp->intern_hash);
+    }
+    else if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_hash_destroy(interp, interp->const_cstring_hash);
+
+    if (interp->string_index) {
+        Parrot_String_Index * const cache = interp->string_index;
+        int i;
+
+        for (i = 0; i < STRING_INDEX_SLOTS; ++i)
+            mem_internal_free(cache->slots[i].offsets);
+
+        mem_internal_free(cache);
+        interp->string_index = NULL;
+    }
+}
+
+
+/*
+
+=item C<const UINTVAL * Parrot_str_get_char_index(PARROT_INTERP, const STRING
+*s)>
+
+Returns the cached byte offsets of every C<STRING_INDEX_STEP>'th character of
+C<s>, starting with character 0, or NULL if they aren't cached.
+
+An entry is only trusted if no mark or compaction run has happened since it
+was made.  A string can't be freed or moved without one, so the same header,
+buffer and lengths then still mean the same string.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const UINTVAL *
+Parrot_str_get_char_index(PARROT_INTERP, ARGIN(const STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_get_char_index)
+    Parrot_String_Index * const cache = interp->string_index;
+    int i;
+
+    if (!cache)
+        return NULL;
+
+    for (i = 0; i < STRING_INDEX_SLOTS; ++i) {
+        if (cache->slots[i].str      == s
+        &&  cache->slots[i].strstart == s->strstart
+        &&  cache->slots[i].bufused  == s->bufused
+        &&  cache->slots[i].strlen   == s->strlen) {
+            if (cache->slots[i].gc_runs == Parrot_gc_count_mark_runs(interp)
+                                         + Parrot_gc_count_collect_runs(interp))
+                return cache->slots[i].offsets;
+
+            cache->slots[i].str = NULL;
+            break;
+        }
     }
+
+    return NULL;
+}
+
+
+/*
+
+=item C<UINTVAL * Parrot_str_new_char_index(PARROT_INTERP, const STRING *s)>
+
+Makes room for the character offsets of C<s> in the cache, replacing the
+oldest entry, and returns the array for the encoding to fill in.  It has
+C<s-E<gt>strlen / STRING_INDEX_STEP + 1> elements.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+UINTVAL *
+Parrot_str_new_char_index(PARROT_INTERP, ARGIN(const STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_new_char_index)
+    Parrot_String_Index *cache = interp->string_index;
+    const UINTVAL        size  = s->strlen / STRING_INDEX_STEP + 1;
+    UINTVAL              i;
+
+    if (!cache)
+        cache = interp->string_index = mem_internal_allocate_zeroed_typed(Parrot_String_Index);
+
+    i             = cache->next;
+    cache->next   = (i + 1) % STRING_INDEX_SLOTS;
+
+    if (cache->slots[i].size < size) {
+        cache->slots[i].offsets = (UINTVAL *)mem_internal_realloc(cache->slots[i].offsets,
+                                        size * sizeof (UINTVAL));
+        cache->slots[i].size    = size;
+    }
+
+    cache->slots[i].str      = s;
+    cache->slots[i].strstart = s->strstart;
+    cache->slots[i].bufused  = s->bufused;
+    cache->slots[i].strlen   = s->strlen;
+    cache->slots[i].gc_runs  = Parrot_gc_count_mark_runs(interp)
+                             + Parrot_gc_count_collect_runs(interp);
+
+    return cache->slots[i].offsets;
 }
 
 
@@ -390,10 +536,15 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     d = Parrot_gc_new_string_header(interp,
         PObj_get_FLAGS(s) & ~PObj_constant_FLAG);
 
-    /* This might set the constant flag again but it is the right thing
-     * to do */
     STRUCT_COPY(d, s);
 
+    /* A copy of a constant isn't constant itself, or the GC would never free
+     * it; the buffer still belongs to the original, which keeps it in place */
+    if (PObj_constant_TEST(s)) {
+        PObj_constant_CLEAR(d);
+        PObj_external_SET(d);
+    }
+
     /*
      * FIXME. It's abstraction leak here from GC.
      * Basically if we are copying string from older generation
@@ -404,6 +555,13 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     /* Clear live flag. It might be set on constant strings */
     PObj_live_CLEAR(d);
 
+    /* Only the original is in the intern table */
+    PObj_get_FLAGS(d) &= ~STRING_interned_FLAG;
+
+    /* The copy keeps a mapped file mapped too */
+    if (STRING_mapped_TEST(d))
+        Parrot_io_retain_mapping(Buffer_bufstart(d));
+
     /* Set the string copy flag */
     PObj_is_string_copy_SET(d);
 
@@ -504,16 +662,42 @@ Parrot_str_concat(PARROT_INTERP, ARGIN_NULLOK(const STRING *a),
         dest->encoding = enc;
         dest->hashval = 0;
     }
+    else if (PObj_is_growable_TESTALL(b)
+         &&  (size_t)(b->strstart - (char *)Buffer_bufstart(b)) >= a->bufused) {
+        /* String b is growable and there's enough space in front of it */
+        DECL_CONST_CAST;
+
+        dest = Parrot_str_copy(interp, b);
+
+        /* Switch string copy flags */
+        PObj_is_string_copy_SET(PARROT_const_cast(STRING *, b));
+        PObj_is_string_copy_CLEAR(dest);
+
+        /* Prepend a */
+        dest->strstart -= a->bufused;
+        mem_sys_memcopy(dest->strstart, a->strstart, a->bufused);
+
+        dest->encoding = enc;
+        dest->hashval = 0;
+    }
     else {
+        UINTVAL front = 0;
+
         if (4 * b->bufused < a->bufused) {
             /* Preallocate more memory if we're appending a short string to
                a long string */
             total_length += total_length >> 1;
         }
+        else if (4 * a->bufused < b->bufused) {
+            /* Or leave room in front when prepending one */
+            front         = total_length >> 1;
+            total_length += front;
+        }
 
         dest = Parrot_str_new_noinit(interp, total_length);
         PARROT_ASSERT(enc);
-        dest->encoding = enc;
+        dest->encoding  = enc;
+        dest->strstart += front;
 
         /* Copy A first */
         mem_sys_memcopy(dest->strstart, a->strstart, a->bufused);
@@ -620,9 +804,10 @@ Parrot_str_new_constant(PARROT_INTERP, ARGIN(const char *buffer))
     if (s)
         return s;
 
-    s = Parrot_str_new_init(interp, buffer, strlen(buffer),
+    s = Parrot_str_intern(interp,
+            Parrot_str_new_init(interp, buffer, strlen(buffer),
                        Parrot_default_encoding_ptr,
-                       PObj_external_FLAG|PObj_constant_FLAG);
+                       PObj_external_FLAG|PObj_constant_FLAG));
 
     Parrot_hash_put(interp, cstring_cache,
         PARROT_const_cast(char *, buffer), (void *)s);
@@ -630,6 +815,51 @@ Parrot_str_new_constant(PARROT_INTERP, ARGIN(const char *buffer))
     return s;
 }
 
+
+/*
+
+=item C<STRING * Parrot_str_intern(PARROT_INTERP, STRING *s)>
+
+Returns the interned string with the same contents and encoding as C<s>,
+interning C<s> itself if it is a constant.  Interned strings are constants
+flagged with C<STRING_interned_FLAG>; two of them with the same encoding are
+equal only if they are the same string.  The table holds its strings for the
+life of the interpreter, so strings that aren't constants are never added; for
+them this only finds the equal constant, if there is one.  C<s> is returned as
+is if there is none, or if the interpreter has no intern table, as threads
+don't.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+STRING *
+Parrot_str_intern(PARROT_INTERP, ARGIN(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_intern)
+    Hash   * const table = interp->intern_hash;
+    STRING *interned;
+
+    if (!table || STRING_IS_NULL(s) || STRING_interned_TEST(s))
+        return s;
+
+    interned = (STRING *)Parrot_hash_get(interp, table, s);
+
+    if (interned)
+        return interned;
+
+    if (!PObj_constant_TEST(s))
+        return s;
+
+    PObj_get_FLAGS(s) |= STRING_interned_FLAG;
+    Parrot_hash_put(interp, table, s, s);
+
+    return s;
+}
+
 /*
 
 =item C<STRING * Parrot_str_new_init(PARROT_INTERP, const char *buffer, UINTVAL
@@ -2268,12 +2498,13 @@ void
 Parrot_str_pin(SHIM_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_str_pin)
-    const size_t size = Buffer_buflen(s);
+    const size_t size   = Buffer_buflen(s);
+    const size_t offset = s->strstart - (char *)Buffer_bufstart(s);
     char * const memory = (char *)mem_internal_allocate(size);
 
     mem_sys_memcopy(memory, Buffer_bufstart(s), size);
     Buffer_bufstart(s) = memory;
-    s->strstart        = memory;
+    s->strstart        = memory + offset;
 
     /* Mark the memory as both from the system and immobile */
     PObj_sysmem_SET(s);
@@ -2296,14 +2527,15 @@ Parrot_str_unpin(PARROT_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_str_unpin)
     void  *memory;
-    size_t size;
+    size_t size, offset;
 
     /* If this string is not marked using system memory,
      * we just don't do this */
     if (!PObj_sysmem_TEST(s))
         return;
 
-    size = Buffer_buflen(s);
+    size   = Buffer_buflen(s);
+    offset = s->strstart - (char *)Buffer_bufstart(s);
 
     /* We need a handle on the fixed memory so we can get rid of it later */
     memory = Buffer_bufstart(s);
@@ -2318,6 +2550,7 @@ Parrot_str_unpin(PARROT_INTERP, ARGMOD(STRING *s))
     Parrot_gc_allocate_string_storage(interp, s, size);
     Parrot_unblock_GC_sweep(interp);
     mem_sys_memcopy(Buffer_bufstart(s), memory, size);
+    s->strstart = (char *)Buffer_bufstart(s) + offset;
 
     /* Mark the memory as neither immobile nor system allocated */
     PObj_sysmem_CLEAR(s);
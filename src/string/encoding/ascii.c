@@ -208,18 +208,20 @@ ascii_partial_scan(PARROT_INTERP, ARGIN(const char *buf),
     if (chars >= 0 && (UINTVAL)chars < len)
         len = chars;
 
-    for (i = 0; i < len; ++i) {
+    i = encoding_ascii_span(buf, len, delim);
+
+    if (i < len) {
         c = (unsigned char)buf[i];
 
         if (c >= 0x80)
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_STRING_REPRESENTATION,
                 "Invalid character in ASCII string");
 
-        if (c == delim) {
-            len = i + 1;
-            break;
-        }
+        /* Stopped at delim */
+        len = i + 1;
     }
+    else if (len > 0)
+        c = (unsigned char)buf[len - 1];
 
     bounds->bytes = len;
     bounds->chars = len;
@@ -167,7 +167,6 @@ static INTVAL
 binary_partial_scan(SHIM_INTERP, ARGIN(const char *buf), ARGMOD(Parrot_String_Bounds *bounds))
 {
     ASSERT_ARGS(binary_partial_scan)
-    UINTVAL       i;
     UINTVAL       len   = bounds->bytes;
     const INTVAL  chars = bounds->chars;
     const INTVAL  delim = bounds->delim;
@@ -177,14 +176,15 @@ binary_partial_scan(SHIM_INTERP, ARGIN(const char *buf), ARGMOD(Parrot_String_Bo
         len = chars;
 
     if (delim >= 0) {
-        for (i = 0; i < len; ++i) {
-            c = (unsigned char)buf[i];
-
-            if (c == delim) {
-                len = i + 1;
-                break;
-            }
-        }
+        const char * const end = delim < 0x100
+                               ? (const char *)memchr(buf, (int)delim, len)
+                               : NULL;
+
+        if (end)
+            len = end - buf + 1;
+
+        if (len > 0)
+            c = (unsigned char)buf[len - 1];
     }
     else {
         c = buf[len-1];
@@ -197,15 +197,15 @@ latin1_partial_scan(SHIM_INTERP, ARGIN(const char *buf), ARGMOD(Parrot_String_Bo
         len = chars;
 
     if (delim >= 0) {
-        UINTVAL i;
-        for (i = 0; i < len; ++i) {
-            c = (unsigned char)buf[i];
-
-            if (c == delim) {
-                len = i + 1;
-                break;
-            }
-        }
+        const char * const end = delim < 0x100
+                               ? (const char *)memchr(buf, (int)delim, len)
+                               : NULL;
+
+        if (end)
+            len = end - buf + 1;
+
+        if (len > 0)
+            c = (unsigned char)buf[len - 1];
     }
     else {
         c = buf[len-1];
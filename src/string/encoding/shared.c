@@ -158,6 +158,9 @@ encoding_equal(PARROT_INTERP, ARGIN(const STRING *lhs), ARGIN(const STRING *rhs)
         return 1;
     if (lhs == rhs)
         return 1;
+    if (lhs->encoding == rhs->encoding
+    &&  STRING_interned_TEST(lhs) && STRING_interned_TEST(rhs))
+        return 0;
     if (lhs->hashval && rhs->hashval && lhs->hashval != rhs->hashval)
         return 0;
     if (lhs->encoding == rhs->encoding)
@@ -345,22 +348,81 @@ encoding_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
     ASSERT_ARGS(encoding_hash)
     DECL_CONST_CAST;
     STRING * const s = PARROT_const_cast(STRING *, src);
-    String_iter iter;
+    String_iter       iter;
+    Parrot_hash_state st;
 
     STRING_ITER_INIT(interp, &iter);
+    Parrot_hash_state_init(&st, hashval);
 
     while (iter.charpos < s->strlen) {
         const UINTVAL c = STRING_iter_get_and_advance(interp, s, &iter);
-        hashval += hashval << 5;
-        hashval += c;
+        PARROT_HASH_ADD_CODEPOINT(&st, c);
     }
 
-    s->hashval = hashval;
+    s->hashval = hashval = Parrot_hash_state_finish(&st);
 
     return hashval;
 }
 
 
+/*
+
+=item C<size_t encoding_ascii_span(const char *buf, size_t len, INTVAL delim)>
+
+Returns the number of bytes at the start of C<buf> that are ASCII and not
+equal to C<delim>, looking at no more than C<len> bytes.  Pass -1 as
+C<delim> to stop only at non-ASCII bytes.
+
+The scanners call this to skip over plain ASCII text a machine word at a time
+and only decode the rest byte by byte.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+size_t
+encoding_ascii_span(ARGIN(const char *buf), size_t len, INTVAL delim)
+{
+    ASSERT_ARGS(encoding_ascii_span)
+    const unsigned char * const p = (const unsigned char *)buf;
+    const UINTVAL ones  = ~(UINTVAL)0 / 0xFF;
+    const UINTVAL highs = ones * 0x80;
+    size_t        i     = 0;
+
+    if (delim >= 0 && delim < 0x80) {
+        const UINTVAL pattern = ones * (UINTVAL)delim;
+
+        for (; i + sizeof (UINTVAL) <= len; i += sizeof (UINTVAL)) {
+            UINTVAL word, diff;
+
+            memcpy(&word, p + i, sizeof (UINTVAL));
+            diff = word ^ pattern;
+
+            /* Any high bit set, or any byte equal to delim */
+            if ((word | ((diff - ones) & ~diff)) & highs)
+                break;
+        }
+    }
+    else {
+        for (; i + sizeof (UINTVAL) <= len; i += sizeof (UINTVAL)) {
+            UINTVAL word;
+
+            memcpy(&word, p + i, sizeof (UINTVAL));
+
+            if (word & highs)
+                break;
+        }
+    }
+
+    while (i < len && p[i] < 0x80 && p[i] != delim)
+        ++i;
+
+    return i;
+}
+
+
 /*
 
 =item C<static int u_iscclass(PARROT_INTERP, UINTVAL codepoint, INTVAL flags)>
@@ -813,6 +875,9 @@ fixed8_equal(PARROT_INTERP, ARGIN(const STRING *lhs), ARGIN(const STRING *rhs))
         return 1;
     if (lhs == rhs)
         return 1;
+    if (lhs->encoding == rhs->encoding
+    &&  STRING_interned_TEST(lhs) && STRING_interned_TEST(rhs))
+        return 0;
     if (lhs->hashval && rhs->hashval && lhs->hashval != rhs->hashval)
         return 0;
 
@@ -391,13 +391,16 @@ ucs2_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
     STRING * const s   = PARROT_const_cast(STRING *, src);
     const utf16_t *ptr = (utf16_t *)s->strstart;
     UINTVAL        len = s->strlen;
+    Parrot_hash_state st;
+
+    Parrot_hash_state_init(&st, hashval);
 
     while (len--) {
-        hashval += hashval << 5;
-        hashval += *(ptr++);
+        PARROT_HASH_ADD_CODEPOINT(&st, *ptr);
+        ++ptr;
     }
 
-    s->hashval = hashval;
+    s->hashval = hashval = Parrot_hash_state_finish(&st);
 
     return hashval;
 }
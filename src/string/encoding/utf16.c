@@ -70,6 +70,7 @@ static void utf16_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGMOD(String_iter *i),
     INTVAL skip)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*i);
@@ -93,6 +94,16 @@ static void utf16_scan(PARROT_INTERP, ARGMOD(STRING *src))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*src);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const utf16_t * utf16_seek(PARROT_INTERP,
+    ARGIN(const STRING *str),
+    ARGIN(const String_iter *i),
+    UINTVAL charpos)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 static const utf16_t * utf16_skip_backward(
@@ -131,7 +142,8 @@ static STRING * utf16_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
     , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf16_iter_skip __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(str) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf16_ord __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -143,6 +155,10 @@ static STRING * utf16_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf16_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_utf16_seek __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
+    , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf16_skip_backward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(p))
 #define ASSERT_ARGS_utf16_skip_forward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -450,6 +466,7 @@ utf16_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     ASSERT_ARGS(utf16_ord)
     const UINTVAL  len = STRING_length(src);
     const utf16_t *start;
+    String_iter    iter;
 
     if (idx < 0)
         idx += len;
@@ -457,12 +474,72 @@ utf16_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     if ((UINTVAL)idx >= len)
         encoding_ord_error(interp, src, idx);
 
-    start = utf16_skip_forward((const utf16_t *)src->strstart, idx);
+    STRING_ITER_INIT(interp, &iter);
+    start = utf16_seek(interp, src, &iter, idx);
 
     return utf16_decode(interp, start);
 }
 
 
+/*
+
+=item C<static const utf16_t * utf16_seek(PARROT_INTERP, const STRING *str,
+const String_iter *i, UINTVAL charpos)>
+
+Returns a pointer to character C<charpos> of C<str>.  Strings without
+surrogate pairs are indexed directly.  Otherwise the search starts at C<i> if
+that is close, else at the nearest offset in the character index of C<str>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const utf16_t *
+utf16_seek(PARROT_INTERP, ARGIN(const STRING *str), ARGIN(const String_iter *i),
+        UINTVAL charpos)
+{
+    ASSERT_ARGS(utf16_seek)
+    const utf16_t * const start = (const utf16_t *)str->strstart;
+    const UINTVAL        *index;
+
+    if (str->bufused == str->strlen * sizeof (utf16_t))
+        return start + charpos;
+
+    if (charpos >= i->charpos && charpos - i->charpos < STRING_INDEX_STEP)
+        return utf16_skip_forward((const utf16_t *)(str->strstart + i->bytepos),
+                    charpos - i->charpos);
+
+    if (charpos < i->charpos && i->charpos - charpos < STRING_INDEX_STEP)
+        return utf16_skip_backward((const utf16_t *)(str->strstart + i->bytepos),
+                    i->charpos - charpos);
+
+    if (charpos < STRING_INDEX_STEP)
+        return utf16_skip_forward(start, charpos);
+
+    index = Parrot_str_get_char_index(interp, str);
+
+    if (!index) {
+        UINTVAL * const offsets = Parrot_str_new_char_index(interp, str);
+        const utf16_t  *ptr     = start;
+        UINTVAL         k;
+
+        offsets[0] = 0;
+
+        for (k = 1; k <= str->strlen / STRING_INDEX_STEP; ++k) {
+            ptr        = utf16_skip_forward(ptr, STRING_INDEX_STEP);
+            offsets[k] = (const char *)ptr - str->strstart;
+        }
+
+        index = offsets;
+    }
+
+    return utf16_skip_forward((const utf16_t *)(str->strstart + index[charpos / STRING_INDEX_STEP]),
+                charpos % STRING_INDEX_STEP);
+}
+
+
 /*
 
 =item C<static UINTVAL utf16_iter_get(PARROT_INTERP, const STRING *str, const
@@ -503,21 +580,16 @@ Moves the string iterator C<i> by C<skip> characters.
 */
 
 static void
-utf16_iter_skip(SHIM_INTERP,
+utf16_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str), ARGMOD(String_iter *i), INTVAL skip)
 {
     ASSERT_ARGS(utf16_iter_skip)
-    const utf16_t *ptr = (utf16_t *)(str->strstart + i->bytepos);
+    const utf16_t * const ptr = utf16_seek(interp, str, i, i->charpos + skip);
 
     i->charpos += skip;
 
     PARROT_ASSERT(i->charpos <= str->strlen);
 
-    if (skip > 0)
-        ptr = utf16_skip_forward(ptr, skip);
-    else if (skip < 0)
-        ptr = utf16_skip_backward(ptr, -skip);
-
     i->bytepos = (const char *)ptr - (const char *)str->strstart;
 
     PARROT_ASSERT(i->bytepos <= str->bufused);
@@ -35,6 +35,12 @@ static utf8_t * utf8_encode(PARROT_INTERP, ARGMOD(utf8_t *ptr), UINTVAL c)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*ptr);
 
+static size_t utf8_hash(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    size_t hashval)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static UINTVAL utf8_iter_get(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGIN(const String_iter *i),
@@ -65,6 +71,7 @@ static void utf8_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGMOD(String_iter *i),
     INTVAL skip)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*i);
@@ -86,6 +93,16 @@ static void utf8_scan(PARROT_INTERP, ARGMOD(STRING *src))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*src);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const utf8_t * utf8_seek(PARROT_INTERP,
+    ARGIN(const STRING *str),
+    ARGIN(const String_iter *i),
+    UINTVAL charpos)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static const utf8_t * utf8_skip_backward(
@@ -107,6 +124,9 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf8_encode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_utf8_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_utf8_iter_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str) \
@@ -120,7 +140,8 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
     , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_iter_skip __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(str) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_ord __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -132,6 +153,10 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf8_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_utf8_seek __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
+    , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_skip_backward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ptr))
 #define ASSERT_ARGS_utf8_skip_forward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -257,6 +282,24 @@ utf8_partial_scan(PARROT_INTERP, ARGIN(const char *buf),
     for (i = 0; i < len && chars < max_chars; ++i) {
         c = p[i];
 
+        /* Skip a run of ASCII characters at once */
+        if (UNICODE_IS_INVARIANT(c) && c != delim) {
+            UINTVAL run = len - i;
+
+            if (run > (UINTVAL)(max_chars - chars))
+                run = max_chars - chars;
+
+            run    = encoding_ascii_span((const char *)p + i, run, delim);
+            i     += run;
+            chars += run;
+            c      = p[i - 1];
+
+            if (i == len || chars == max_chars)
+                break;
+
+            c = p[i];
+        }
+
         if (UTF8_IS_START(c)) {
             UINTVAL len2 = Parrot_utf8skip[c];
             UINTVAL count;
@@ -324,6 +367,7 @@ utf8_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     ASSERT_ARGS(utf8_ord)
     const UINTVAL len = STRING_length(src);
     const utf8_t *start;
+    String_iter   iter;
 
     if (idx < 0)
         idx += len;
@@ -331,12 +375,42 @@ utf8_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     if ((UINTVAL)idx >= len)
         encoding_ord_error(interp, src, idx);
 
-    start = utf8_skip_forward((utf8_t *)src->strstart, idx);
+    STRING_ITER_INIT(interp, &iter);
+    start = utf8_seek(interp, src, &iter, idx);
 
     return utf8_decode(interp, start);
 }
 
 
+/*
+
+=item C<static size_t utf8_hash(PARROT_INTERP, const STRING *src, size_t
+hashval)>
+
+Returns the hashed value of the string, given a seed in hashval.  Pure ASCII
+strings are hashed straight from the buffer, a word at a time.
+
+=cut
+
+*/
+
+static size_t
+utf8_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
+{
+    ASSERT_ARGS(utf8_hash)
+    DECL_CONST_CAST;
+    STRING * const s = PARROT_const_cast(STRING *, src);
+
+    if (s->bufused != s->strlen)
+        return encoding_hash(interp, src, hashval);
+
+    s->hashval = Parrot_hash_buffer((const unsigned char *)s->strstart,
+                    s->bufused, hashval);
+
+    return s->hashval;
+}
+
+
 /*
 
 =item C<static UINTVAL utf8_decode(PARROT_INTERP, const utf8_t *ptr)>
@@ -463,6 +537,64 @@ utf8_skip_backward(ARGIN(const utf8_t *ptr), UINTVAL n)
 }
 
 
+/*
+
+=item C<static const utf8_t * utf8_seek(PARROT_INTERP, const STRING *str, const
+String_iter *i, UINTVAL charpos)>
+
+Returns a pointer to character C<charpos> of C<str>.  Pure ASCII strings are
+indexed directly.  Otherwise the search starts at C<i> if that is close, else
+at the nearest offset in the character index of C<str>, which is built the
+first time a long string is searched.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const utf8_t *
+utf8_seek(PARROT_INTERP, ARGIN(const STRING *str), ARGIN(const String_iter *i),
+        UINTVAL charpos)
+{
+    ASSERT_ARGS(utf8_seek)
+    const utf8_t * const start = (const utf8_t *)str->strstart;
+    const UINTVAL       *index;
+
+    if (str->bufused == str->strlen)
+        return start + charpos;
+
+    if (charpos >= i->charpos && charpos - i->charpos < STRING_INDEX_STEP)
+        return utf8_skip_forward(start + i->bytepos, charpos - i->charpos);
+
+    if (charpos < i->charpos && i->charpos - charpos < STRING_INDEX_STEP)
+        return utf8_skip_backward(start + i->bytepos, i->charpos - charpos);
+
+    if (charpos < STRING_INDEX_STEP)
+        return utf8_skip_forward(start, charpos);
+
+    index = Parrot_str_get_char_index(interp, str);
+
+    if (!index) {
+        UINTVAL * const offsets = Parrot_str_new_char_index(interp, str);
+        const utf8_t   *ptr     = start;
+        UINTVAL         k;
+
+        offsets[0] = 0;
+
+        for (k = 1; k <= str->strlen / STRING_INDEX_STEP; ++k) {
+            ptr        = utf8_skip_forward(ptr, STRING_INDEX_STEP);
+            offsets[k] = ptr - start;
+        }
+
+        index = offsets;
+    }
+
+    return utf8_skip_forward(start + index[charpos / STRING_INDEX_STEP],
+                charpos % STRING_INDEX_STEP);
+}
+
+
 /*
 
 =item C<static UINTVAL utf8_iter_get(PARROT_INTERP, const STRING *str, const
@@ -504,21 +636,16 @@ Moves the string iterator C<i> by C<skip> characters.
 */
 
 static void
-utf8_iter_skip(SHIM_INTERP,
+utf8_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str), ARGMOD(String_iter *i), INTVAL skip)
 {
     ASSERT_ARGS(utf8_iter_skip)
-    const utf8_t *ptr = (utf8_t *)(str->strstart + i->bytepos);
+    const utf8_t * const ptr = utf8_seek(interp, str, i, i->charpos + skip);
 
     i->charpos += skip;
 
     PARROT_ASSERT(i->charpos <= str->strlen);
 
-    if (skip > 0)
-        ptr = utf8_skip_forward(ptr, skip);
-    else if (skip < 0)
-        ptr = utf8_skip_backward(ptr, -skip);
-
     i->bytepos = (const char *)ptr - (const char *)str->strstart;
 
     PARROT_ASSERT(i->bytepos <= str->bufused);
@@ -595,7 +722,7 @@ static STR_VTABLE Parrot_utf8_encoding = {
     encoding_compare,
     encoding_index,
     encoding_rindex,
-    encoding_hash,
+    utf8_hash,
 
     utf8_scan,
     utf8_partial_scan,
@@ -22,6 +22,7 @@ Subroutines, continuations, co-routines and other fun stuff...
 #include "sub.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_continuation.h"
+#include "pmc/pmc_lexpad.h"
 #include "parrot/oplib/core_ops.h"
 
 /* HEADERIZER HFILE: include/parrot/sub.h */
@@ -357,6 +358,125 @@ Parrot_sub_find_pad(PARROT_INTERP, ARGIN(STRING *lex_name), ARGIN(PMC *ctx))
 }
 
 
+/*
+
+=item C<PMC * Parrot_sub_find_lex_register(PARROT_INTERP, const opcode_t *site,
+STRING *lex_name, PMC *ctx, INTVAL reg_type, INTVAL *reg)>
+
+Locate the lexical C<lex_name> for the C<find_lex> or C<store_lex> at C<site>
+running in C<ctx>, like C<Parrot_sub_find_pad> does.  Returns the context
+holding the lexical and sets C<*reg> to its register number if the lexical
+lives in a register of type C<reg_type> of a C<LexPad>.  Returns PMCNULL
+otherwise, and the caller has to go through the pad.
+
+Each site remembers where it found its lexical along with the LexInfo of the
+pads it passed, so later lookups only walk the outer contexts.  Pads of any
+other type than C<LexPad>, such as C<DynLexPad>, are never cached.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_sub_find_lex_register(PARROT_INTERP, ARGIN(const opcode_t *site),
+        ARGIN(STRING *lex_name), ARGIN(PMC *ctx), INTVAL reg_type,
+        ARGOUT(INTVAL *reg))
+{
+    ASSERT_ARGS(Parrot_sub_find_lex_register)
+    Caches * const mc = interp->caches;
+    Lex_ic        *ic;
+    PMC           *lexinfo[LEX_IC_DEPTH];
+    PMC           *cur;
+    UINTVAL        depth;
+
+    if (mc->lex_ics) {
+        ic = &mc->lex_ics[(PTR2UINTVAL(site) >> 3) & LEX_IC_SIZE_MASK];
+
+        if (ic->site == site && ic->version == mc->ic_version
+        && (ic->name == lex_name || STRING_equal(interp, ic->name, lex_name))
+        && (ic->reg & 3) == reg_type) {
+            for (cur = ctx, depth = 0; !PMC_IS_NULL(cur); ++depth) {
+                PMC * const lex_pad = Parrot_pcc_get_lex_pad(interp, cur);
+
+                if (PMC_IS_NULL(lex_pad)) {
+                    if (ic->lexinfo[depth])
+                        break;
+                }
+                else if (lex_pad->vtable->base_type != enum_class_LexPad
+                     ||  PARROT_LEXPAD(lex_pad)->lexinfo != ic->lexinfo[depth])
+                    break;
+
+                if (depth == ic->depth) {
+                    *reg = ic->reg >> 2;
+                    return cur;
+                }
+
+                cur = Parrot_pcc_get_outer_ctx(interp, cur);
+            }
+        }
+    }
+
+    /* No hit.  Walk the pads the way Parrot_sub_find_pad does. */
+    for (cur = ctx, depth = 0; depth < LEX_IC_DEPTH; ++depth) {
+        PMC * const lex_pad = Parrot_pcc_get_lex_pad(interp, cur);
+        PMC        *info;
+        Hash       *hash;
+        HashBucket *b;
+
+        if (PMC_IS_NULL(lex_pad)) {
+            lexinfo[depth] = NULL;
+            cur            = Parrot_pcc_get_outer_ctx(interp, cur);
+
+            if (PMC_IS_NULL(cur))
+                return PMCNULL;
+
+            continue;
+        }
+
+        if (lex_pad->vtable->base_type != enum_class_LexPad)
+            return PMCNULL;
+
+        info           = PARROT_LEXPAD(lex_pad)->lexinfo;
+        lexinfo[depth] = info;
+        hash           = (Hash *)VTABLE_get_pointer(interp, info);
+        b              = hash->entries
+                       ? Parrot_hash_get_bucket(interp, hash, lex_name)
+                       : NULL;
+
+        if (b) {
+            const INTVAL value = (INTVAL)b->value;
+
+            if ((value & 3) != reg_type)
+                return PMCNULL;
+
+            if (!mc->lex_ics)
+                mc->lex_ics = mem_gc_allocate_n_zeroed_typed(interp,
+                                    LEX_IC_SIZE, Lex_ic);
+
+            ic          = &mc->lex_ics[(PTR2UINTVAL(site) >> 3) & LEX_IC_SIZE_MASK];
+            ic->site    = site;
+            ic->version = mc->ic_version;
+            ic->name    = lex_name;
+            ic->depth   = depth;
+            ic->reg     = value;
+            memcpy(ic->lexinfo, lexinfo, (depth + 1) * sizeof (PMC *));
+
+            *reg = value >> 2;
+            return cur;
+        }
+
+        cur = Parrot_pcc_get_outer_ctx(interp, cur);
+
+        if (PMC_IS_NULL(cur))
+            return PMCNULL;
+    }
+
+    return PMCNULL;
+}
+
+
 /*
 
 =item C<PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP, STRING *lex_name, PMC
@@ -411,6 +531,7 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
     Parrot_Sub_attributes *sub;
 
     PMC_get_sub(interp, Parrot_pcc_get_sub(interp, ctx), current_sub);
+    Parrot_pcc_capture_contexts(interp);
 
     /* MultiSub gets special treatment */
     if (VTABLE_isa(interp, sub_pmc, CONST_STRING(interp, "MultiSub"))) {
@@ -475,6 +596,33 @@ Parrot_sub_new_closure(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 }
 
 
+/*
+
+=item C<PMC * Parrot_sub_new_return_continuation(PARROT_INTERP)>
+
+Creates the return continuation for a call from the current context.  Unlike
+other continuations it only leads back into a context which is still active,
+so creating it does not keep the register frames of active contexts from being
+released on return.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_sub_new_return_continuation(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_sub_new_return_continuation)
+    const UINTVAL captures = interp->context_captures;
+    PMC * const   ccont    = Parrot_pmc_new(interp, enum_class_Continuation);
+
+    interp->context_captures = captures;
+    return ccont;
+}
+
+
 /*
 
 =item C<void Parrot_sub_continuation_check(PARROT_INTERP, const PMC *pmc)>
@@ -0,0 +1,936 @@
+/*
+Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+src/thread.c - Worker interpreters on OS threads
+
+=head1 DESCRIPTION
+
+A worker pool runs subs on other cores.  Each worker is an OS thread with an
+interpreter of its own, made with C<PARROT_IS_THREAD> so that it has its own
+heap and collects garbage without any locking: the only things it shares with
+the interpreter which made the pool are immutable.  When the pool is made,
+every worker loads the bytecode that the parent has loaded, and later looks
+up the subs it is given by their names.
+
+A job is a call of a sub with at most one argument.  The call and its result
+cross between heaps frozen, so each side works on a deep copy and no object
+is ever reachable from two threads.
+
+Every worker has a deque of jobs.  The parent hands jobs out round robin.  A
+worker takes the newest job from the bottom of its own deque, and when that
+is empty, it steals the oldest job from the top of another worker's deque, so
+that a few long jobs don't leave the other cores idle.
+
+Without POSIX threads a pool has no workers, and a job runs in the parent
+when its result is asked for.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/thread.h"
+#include "parrot/oplib/core_ops.h"
+#include "pmc/pmc_sub.h"
+#include "thread.str"
+
+#if defined(PARROT_HAS_THREADS) && defined(PARROT_HAS_HEADER_PTHREAD)
+#  include <pthread.h>
+#  include <signal.h>
+#  include <unistd.h>
+#  define THR_WORKERS 1
+#endif
+
+#ifdef THR_WORKERS
+typedef pthread_mutex_t thr_lock_t;
+typedef pthread_cond_t  thr_cond_t;
+#  define THR_LOCK(l)           pthread_mutex_lock(l)
+#  define THR_UNLOCK(l)         pthread_mutex_unlock(l)
+#  define THR_WAIT(c, l)        pthread_cond_wait((c), (l))
+#  define THR_SIGNAL(c)         pthread_cond_signal(c)
+#  define THR_BROADCAST(c)      pthread_cond_broadcast(c)
+#else
+typedef int thr_lock_t;
+typedef int thr_cond_t;
+#  define THR_LOCK(l)
+#  define THR_UNLOCK(l)
+#  define THR_WAIT(c, l)
+#  define THR_SIGNAL(c)
+#  define THR_BROADCAST(c)
+#endif
+
+/* Upper bound for the number of workers in a pool */
+#define THR_MAX_WORKERS 256
+
+/* A call of a sub, replaced by its result once the job has run */
+typedef struct Parrot_Job {
+    char   *image;      /* frozen call or result; NULL for a PMCNULL result */
+    size_t  size;
+    char   *error;      /* message of the exception the job died with */
+    int     done;       /* set under the pool lock */
+} Parrot_Job;
+
+/* Jobs queued for one worker. Its owner works at the bottom, thieves take
+ * from the top */
+typedef struct Parrot_Job_Deque {
+    Parrot_Job **jobs;
+    size_t       alloc;     /* a power of two */
+    size_t       top;       /* the oldest job */
+    size_t       bottom;    /* one past the newest job */
+    thr_lock_t   lock;
+} Parrot_Job_Deque;
+
+typedef struct Parrot_Worker {
+    struct Parrot_Worker_Pool *pool;
+    Interp                    *interp;
+    Parrot_Job_Deque           deque;
+#ifdef THR_WORKERS
+    pthread_t                  thread;
+#endif
+} Parrot_Worker;
+
+struct Parrot_Worker_Pool {
+    Parrot_Worker  *workers;
+    size_t          n_workers;
+    size_t          next;           /* worker to get the next job */
+    Parrot_Job    **jobs;           /* by id; only the parent uses these */
+    size_t          n_jobs;
+    size_t          alloc_jobs;
+    thr_lock_t      lock;           /* protects the fields below and
+                                     * Parrot_Job.done */
+    thr_cond_t      work;           /* signalled when a job is queued */
+    thr_cond_t      done;           /* signalled when a job is done */
+    size_t          queued;         /* jobs in the deques */
+    int             shutdown;
+};
+
+/* HEADERIZER HFILE: include/parrot/thread.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void call_job(PARROT_INTERP, ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+static void destroy_worker(PARROT_INTERP, ARGMOD(Parrot_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*worker);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Job * find_job(PARROT_INTERP,
+    ARGIN(const Parrot_Worker_Pool *pool),
+    INTVAL id)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void free_job(ARGFREE_NOTNULL(Parrot_Job *job))
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * get_image(PARROT_INTERP, ARGIN(const Parrot_Job *job))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void job_failed(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *exception),
+    ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+static void load_code(PARROT_INTERP, ARGMOD(Interp *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*worker);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * load_packfile(PARROT_INTERP,
+    ARGMOD(Interp *worker),
+    ARGIN(PackFile *pf))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*worker);
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Job * pop_job(ARGMOD(Parrot_Job_Deque *deque))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*deque);
+
+static void push_job(
+    ARGMOD(Parrot_Job_Deque *deque),
+    ARGIN(Parrot_Job *job))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*deque);
+
+static void run_job(PARROT_INTERP, ARGMOD(Parrot_Job *job))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*job);
+
+static void set_image(PARROT_INTERP,
+    ARGMOD(Parrot_Job *job),
+    ARGIN_NULLOK(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*job);
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Job * steal_job(ARGMOD(Parrot_Job_Deque *deque))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*deque);
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Job * take_job(ARGMOD(Parrot_Worker *worker))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*worker);
+
+PARROT_CAN_RETURN_NULL
+static void * worker_main(ARGIN(void *arg))
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_call_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_destroy_worker __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_find_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_free_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_get_image __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_job_failed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_load_code __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_load_packfile __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(worker) \
+    , PARROT_ASSERT_ARG(pf))
+#define ASSERT_ARGS_pop_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque))
+#define ASSERT_ARGS_push_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_run_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_set_image __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_steal_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(deque))
+#define ASSERT_ARGS_take_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_worker_main __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arg))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<Parrot_Worker_Pool * Parrot_thr_pool_new(PARROT_INTERP, INTVAL
+n_workers)>
+
+Makes a pool of C<n_workers> workers, or one per processor if C<n_workers>
+isn't positive.  Each worker's interpreter is made and loads the bytecode
+here, on the calling thread; the C<:load> subs run in every worker.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_MALLOC
+Parrot_Worker_Pool *
+Parrot_thr_pool_new(PARROT_INTERP, INTVAL n_workers)
+{
+    ASSERT_ARGS(Parrot_thr_pool_new)
+    Parrot_Worker_Pool * const pool = mem_internal_allocate_zeroed_typed(Parrot_Worker_Pool);
+#ifdef THR_WORKERS
+    sigset_t all, old;
+    size_t   i;
+
+#  ifdef _SC_NPROCESSORS_ONLN
+    if (n_workers <= 0)
+        n_workers = sysconf(_SC_NPROCESSORS_ONLN);
+#  endif
+    if (n_workers <= 0)
+        n_workers = 1;
+    if (n_workers > THR_MAX_WORKERS)
+        n_workers = THR_MAX_WORKERS;
+
+    /* Workers may look up ops by name; build the table while alone */
+    PARROT_CORE_OPLIB_INIT(interp, 1)->_op_code(interp, "noop", 0);
+
+    pool->workers   = mem_internal_allocate_n_zeroed_typed(n_workers, Parrot_Worker);
+    pool->n_workers = n_workers;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (i = 0; i < pool->n_workers; ++i) {
+        Parrot_Worker * const worker = &pool->workers[i];
+
+        worker->pool   = pool;
+        worker->interp = Parrot_interp_make_interpreter(interp, PARROT_IS_THREAD);
+        pthread_mutex_init(&worker->deque.lock, NULL);
+        load_code(interp, worker->interp);
+    }
+
+    /* Signals belong to the interpreter's thread, see src/alarm.c */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    for (i = 0; i < pool->n_workers; ++i)
+        if (pthread_create(&pool->workers[i].thread, NULL,
+                worker_main, &pool->workers[i]))
+            break;
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    /* Make do with the threads we got */
+    if (i < pool->n_workers) {
+        const size_t started = i;
+
+        for (; i < pool->n_workers; ++i)
+            destroy_worker(interp, &pool->workers[i]);
+
+        pool->n_workers = started;
+    }
+#else
+    UNUSED(n_workers);
+#endif
+
+    return pool;
+}
+
+/*
+
+=item C<void Parrot_thr_pool_destroy(PARROT_INTERP, Parrot_Worker_Pool *pool)>
+
+Stops the workers and frees the pool.  Queued jobs are dropped, and a job
+which is running is waited for.  The workers' interpreters are destroyed on
+the calling thread, which must be the one which made the pool.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_thr_pool_destroy(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_Worker_Pool *pool))
+{
+    ASSERT_ARGS(Parrot_thr_pool_destroy)
+    size_t i;
+
+    THR_LOCK(&pool->lock);
+    pool->shutdown = 1;
+    THR_BROADCAST(&pool->work);
+    THR_UNLOCK(&pool->lock);
+
+    for (i = 0; i < pool->n_workers; ++i) {
+#ifdef THR_WORKERS
+        pthread_join(pool->workers[i].thread, NULL);
+#endif
+        destroy_worker(interp, &pool->workers[i]);
+    }
+
+    for (i = 0; i < pool->n_jobs; ++i)
+        if (pool->jobs[i])
+            free_job(pool->jobs[i]);
+
+#ifdef THR_WORKERS
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+#endif
+    mem_internal_free(pool->jobs);
+    mem_internal_free(pool->workers);
+    mem_internal_free(pool);
+}
+
+/*
+
+=item C<INTVAL Parrot_thr_pool_size(const Parrot_Worker_Pool *pool)>
+
+Returns the number of workers in C<pool>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_PURE_FUNCTION
+INTVAL
+Parrot_thr_pool_size(ARGIN(const Parrot_Worker_Pool *pool))
+{
+    ASSERT_ARGS(Parrot_thr_pool_size)
+    return pool->n_workers;
+}
+
+/*
+
+=item C<INTVAL Parrot_thr_pool_submit(PARROT_INTERP, Parrot_Worker_Pool *pool,
+PMC *sub, PMC *arg)>
+
+Queues a call of C<sub> with a deep copy of C<arg>, or with no argument if
+C<arg> is null, and returns the id of the job.  The worker looks C<sub> up by
+its namespace and name, so it can't be an anonymous sub, and closures lose
+their outer lexicals.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_thr_pool_submit(PARROT_INTERP, ARGMOD(Parrot_Worker_Pool *pool),
+        ARGIN(PMC *sub), ARGIN_NULLOK(PMC *arg))
+{
+    ASSERT_ARGS(Parrot_thr_pool_submit)
+    Parrot_Job * const job  = mem_internal_allocate_zeroed_typed(Parrot_Job);
+    PMC        * const call = Parrot_pmc_new_init_int(interp,
+                                enum_class_ResizablePMCArray, 2);
+    Parrot_Sub_attributes *sub_attrs;
+    PMC                   *name;
+
+    if (!VTABLE_isa(interp, sub, CONST_STRING(interp, "Sub")))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "a worker job must be a Sub");
+
+    PMC_get_sub(interp, sub, sub_attrs);
+    if (PMC_IS_NULL(sub_attrs->namespace_stash) || STRING_IS_NULL(sub_attrs->ns_entry_name))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "a worker job can't be an anonymous sub");
+
+    name = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, name, sub_attrs->ns_entry_name);
+    VTABLE_set_pmc_keyed_int(interp, call, 0,
+        Parrot_ns_get_name(interp, sub_attrs->namespace_stash));
+    VTABLE_set_pmc_keyed_int(interp, call, 1, name);
+    if (!PMC_IS_NULL(arg))
+        VTABLE_push_pmc(interp, call, arg);
+
+    set_image(interp, job, call);
+
+    if (pool->n_jobs == pool->alloc_jobs) {
+        pool->alloc_jobs = pool->alloc_jobs ? pool->alloc_jobs * 2 : 16;
+        pool->jobs       = (Parrot_Job **)mem_internal_realloc(pool->jobs,
+                                pool->alloc_jobs * sizeof (Parrot_Job *));
+    }
+    pool->jobs[pool->n_jobs] = job;
+
+    if (pool->n_workers) {
+        Parrot_Worker * const worker = &pool->workers[pool->next];
+
+        pool->next = (pool->next + 1) % pool->n_workers;
+        push_job(&worker->deque, job);
+
+        THR_LOCK(&pool->lock);
+        ++pool->queued;
+        THR_SIGNAL(&pool->work);
+        THR_UNLOCK(&pool->lock);
+    }
+
+    return pool->n_jobs++;
+}
+
+/*
+
+=item C<INTVAL Parrot_thr_pool_ready(PARROT_INTERP, Parrot_Worker_Pool *pool,
+INTVAL id)>
+
+Checks without waiting whether job C<id> is done.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_thr_pool_ready(PARROT_INTERP, ARGMOD(Parrot_Worker_Pool *pool), INTVAL id)
+{
+    ASSERT_ARGS(Parrot_thr_pool_ready)
+    Parrot_Job * const job = find_job(interp, pool, id);
+    INTVAL             done;
+
+    if (!pool->n_workers && !job->done)
+        run_job(interp, job);
+
+    THR_LOCK(&pool->lock);
+    done = job->done;
+    THR_UNLOCK(&pool->lock);
+
+    return done;
+}
+
+/*
+
+=item C<PMC * Parrot_thr_pool_result(PARROT_INTERP, Parrot_Worker_Pool *pool,
+INTVAL id)>
+
+Waits for job C<id> and returns a copy of what its sub returned, or rethrows
+the message of the exception it died with.  Either way the job is gone
+afterwards.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_thr_pool_result(PARROT_INTERP, ARGMOD(Parrot_Worker_Pool *pool), INTVAL id)
+{
+    ASSERT_ARGS(Parrot_thr_pool_result)
+    Parrot_Job * const job = find_job(interp, pool, id);
+    PMC               *result;
+
+    if (!pool->n_workers && !job->done)
+        run_job(interp, job);
+
+    THR_LOCK(&pool->lock);
+    while (!job->done)
+        THR_WAIT(&pool->done, &pool->lock);
+    THR_UNLOCK(&pool->lock);
+
+    pool->jobs[id] = NULL;
+
+    if (job->error) {
+        STRING * const message = Parrot_str_new(interp, job->error, 0);
+
+        free_job(job);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "%Ss", message);
+    }
+
+    result = get_image(interp, job);
+    free_job(job);
+
+    return result;
+}
+
+/*
+
+=back
+
+=head2 Static Functions
+
+=over 4
+
+=item C<static Parrot_Job * find_job(PARROT_INTERP, const Parrot_Worker_Pool
+*pool, INTVAL id)>
+
+Returns job C<id>, or throws if there is no such job.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Job *
+find_job(PARROT_INTERP, ARGIN(const Parrot_Worker_Pool *pool), INTVAL id)
+{
+    ASSERT_ARGS(find_job)
+
+    if (id < 0 || (size_t)id >= pool->n_jobs || !pool->jobs[id])
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "no worker job %d", (int)id);
+
+    return pool->jobs[id];
+}
+
+/*
+
+=item C<static void free_job(Parrot_Job *job)>
+
+Frees C<job>.
+
+=cut
+
+*/
+
+static void
+free_job(ARGFREE_NOTNULL(Parrot_Job *job))
+{
+    ASSERT_ARGS(free_job)
+
+    mem_internal_free(job->image);
+    if (job->error)
+        Parrot_str_free_cstring(job->error);
+    mem_internal_free(job);
+}
+
+/*
+
+=item C<static void set_image(PARROT_INTERP, Parrot_Job *job, PMC *pmc)>
+
+=item C<static PMC * get_image(PARROT_INTERP, const Parrot_Job *job)>
+
+Freeze C<pmc> into memory outside of any heap, and thaw it into the heap of
+C<interp>.
+
+=cut
+
+*/
+
+static void
+set_image(PARROT_INTERP, ARGMOD(Parrot_Job *job), ARGIN_NULLOK(PMC *pmc))
+{
+    ASSERT_ARGS(set_image)
+
+    mem_internal_free(job->image);
+    job->image = NULL;
+    job->size  = 0;
+
+    if (!PMC_IS_NULL(pmc)) {
+        STRING * const image = Parrot_freeze(interp, pmc);
+
+        job->size  = Parrot_str_byte_length(interp, image);
+        job->image = (char *)mem_internal_allocate(job->size);
+        memcpy(job->image, image->strstart, job->size);
+    }
+}
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+get_image(PARROT_INTERP, ARGIN(const Parrot_Job *job))
+{
+    ASSERT_ARGS(get_image)
+
+    if (!job->image)
+        return PMCNULL;
+
+    return Parrot_thaw(interp, Parrot_str_new_init(interp, job->image, job->size,
+                Parrot_binary_encoding_ptr, 0));
+}
+
+/*
+
+=item C<static void run_job(PARROT_INTERP, Parrot_Job *job)>
+
+Runs C<job> in C<interp> and marks it done.
+
+=item C<static void call_job(PARROT_INTERP, void *data)>
+
+=item C<static void job_failed(PARROT_INTERP, PMC *exception, void *data)>
+
+The body and the exception handler of a job.
+
+=cut
+
+*/
+
+static void
+run_job(PARROT_INTERP, ARGMOD(Parrot_Job *job))
+{
+    ASSERT_ARGS(run_job)
+
+    Parrot_ext_try(interp, call_job, job_failed, job);
+}
+
+static void
+call_job(PARROT_INTERP, ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(call_job)
+    Parrot_Job * const job    = (Parrot_Job *)data;
+    PMC        * const call   = get_image(interp, job);
+    STRING     * const name   = VTABLE_get_string_keyed_int(interp, call, 1);
+    PMC        * const ns     = Parrot_ns_get_namespace_keyed(interp,
+                                    interp->root_namespace,
+                                    VTABLE_get_pmc_keyed_int(interp, call, 0));
+    PMC        *sub           = PMCNULL;
+    PMC        *result        = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        sub = VTABLE_get_pmc_keyed_str(interp, ns, name);
+
+    if (PMC_IS_NULL(sub))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_GLOBAL_NOT_FOUND,
+            "worker can't find sub '%Ss'", name);
+
+    if (VTABLE_elements(interp, call) > 2)
+        Parrot_ext_call(interp, sub, "P->P",
+            VTABLE_get_pmc_keyed_int(interp, call, 2), &result);
+    else
+        Parrot_ext_call(interp, sub, "->P", &result);
+
+    set_image(interp, job, result);
+}
+
+static void
+job_failed(PARROT_INTERP, ARGIN_NULLOK(PMC *exception), ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(job_failed)
+    Parrot_Job * const job     = (Parrot_Job *)data;
+    STRING     *message        = STRINGNULL;
+
+    if (!PMC_IS_NULL(exception))
+        message = VTABLE_get_string(interp, exception);
+    if (STRING_IS_NULL(message) || !Parrot_str_byte_length(interp, message))
+        message = CONST_STRING(interp, "worker job died");
+
+    job->error = Parrot_str_to_cstring(interp, message);
+}
+
+/*
+
+=item C<static void push_job(Parrot_Job_Deque *deque, Parrot_Job *job)>
+
+Adds C<job> at the bottom of C<deque>.
+
+=item C<static Parrot_Job * pop_job(Parrot_Job_Deque *deque)>
+
+Takes the newest job from the bottom of C<deque>.
+
+=item C<static Parrot_Job * steal_job(Parrot_Job_Deque *deque)>
+
+Takes the oldest job from the top of C<deque>.
+
+=cut
+
+*/
+
+static void
+push_job(ARGMOD(Parrot_Job_Deque *deque), ARGIN(Parrot_Job *job))
+{
+    ASSERT_ARGS(push_job)
+
+    THR_LOCK(&deque->lock);
+
+    if (deque->bottom - deque->top == deque->alloc) {
+        const size_t  alloc = deque->alloc ? deque->alloc * 2 : 16;
+        Parrot_Job  **jobs  = (Parrot_Job **)mem_internal_allocate(alloc * sizeof (Parrot_Job *));
+        size_t        i;
+
+        for (i = deque->top; i < deque->bottom; ++i)
+            jobs[i & (alloc - 1)] = deque->jobs[i & (deque->alloc - 1)];
+
+        mem_internal_free(deque->jobs);
+        deque->jobs  = jobs;
+        deque->alloc = alloc;
+    }
+
+    deque->jobs[deque->bottom++ & (deque->alloc - 1)] = job;
+
+    THR_UNLOCK(&deque->lock);
+}
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Job *
+pop_job(ARGMOD(Parrot_Job_Deque *deque))
+{
+    ASSERT_ARGS(pop_job)
+    Parrot_Job *job = NULL;
+
+    THR_LOCK(&deque->lock);
+    if (deque->bottom != deque->top)
+        job = deque->jobs[--deque->bottom & (deque->alloc - 1)];
+    THR_UNLOCK(&deque->lock);
+
+    return job;
+}
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Job *
+steal_job(ARGMOD(Parrot_Job_Deque *deque))
+{
+    ASSERT_ARGS(steal_job)
+    Parrot_Job *job = NULL;
+
+    THR_LOCK(&deque->lock);
+    if (deque->bottom != deque->top)
+        job = deque->jobs[deque->top++ & (deque->alloc - 1)];
+    THR_UNLOCK(&deque->lock);
+
+    return job;
+}
+
+/*
+
+=item C<static void load_code(PARROT_INTERP, Interp *worker)>
+
+Loads every packfile that C<interp> has loaded into C<worker>, and makes the
+current one current there too.
+
+=item C<static PMC * load_packfile(PARROT_INTERP, Interp *worker, PackFile *pf)>
+
+Loads a copy of C<pf> into C<worker> and runs its C<:load> subs.
+
+=cut
+
+*/
+
+static void
+load_code(PARROT_INTERP, ARGMOD(Interp *worker))
+{
+    ASSERT_ARGS(load_code)
+    PMC * const loaded  = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                            IGLOBALS_LOADED_PBCS);
+    PMC * const iter    = VTABLE_get_iter(interp, loaded);
+    PackFile * const pf = interp->code ? interp->code->base.pf : NULL;
+
+    /* worker's own stack top comes with its thread */
+    Parrot_interp_init_stacktop(worker, (void *)&worker);
+
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING   * const path    = VTABLE_shift_string(interp, iter);
+        PMC      * const view    = VTABLE_get_pmc_keyed_str(interp, loaded, path);
+        PackFile * const library = (PackFile *)VTABLE_get_pointer(interp, view);
+
+        if (library && library != pf)
+            load_packfile(interp, worker, library);
+    }
+
+    if (pf)
+        Parrot_pf_set_current_packfile(worker, load_packfile(interp, worker, pf));
+}
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+load_packfile(PARROT_INTERP, ARGMOD(Interp *worker), ARGIN(PackFile *pf))
+{
+    ASSERT_ARGS(load_packfile)
+    STRING * const image = Parrot_pf_serialize(interp, pf);
+    STRING * const copy  = Parrot_str_new_init(worker, image->strstart,
+                                Parrot_str_byte_length(interp, image),
+                                Parrot_binary_encoding_ptr, 0);
+    PMC    * const view  = Parrot_pf_get_packfile_pmc(worker,
+                                Parrot_pf_deserialize(worker, copy), STRINGNULL);
+
+    Parrot_pf_prepare_packfile_load(worker, view);
+
+    return view;
+}
+
+/*
+
+=item C<static void destroy_worker(PARROT_INTERP, Parrot_Worker *worker)>
+
+Frees C<worker>'s deque and destroys its interpreter, whose thread is done.
+
+=cut
+
+*/
+
+static void
+destroy_worker(PARROT_INTERP, ARGMOD(Parrot_Worker *worker))
+{
+    ASSERT_ARGS(destroy_worker)
+    UNUSED(interp);
+
+    Parrot_interp_init_stacktop(worker->interp, (void *)&worker);
+    Parrot_interp_really_destroy(worker->interp, 0, NULL);
+    worker->interp = NULL;
+
+#ifdef THR_WORKERS
+    pthread_mutex_destroy(&worker->deque.lock);
+#endif
+    mem_internal_free(worker->deque.jobs);
+}
+
+/*
+
+=item C<static void * worker_main(void *arg)>
+
+Main loop of a worker thread: runs jobs until the pool shuts down.
+
+=item C<static Parrot_Job * take_job(Parrot_Worker *worker)>
+
+Returns the next job for C<worker>, from its own deque or stolen from
+another, or NULL when the pool shuts down.  Sleeps while there is no job.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+worker_main(ARGIN(void *arg))
+{
+    ASSERT_ARGS(worker_main)
+    Parrot_Worker      * const worker = (Parrot_Worker *)arg;
+    Parrot_Worker_Pool * const pool   = worker->pool;
+    Parrot_Job         *job;
+
+    Parrot_interp_init_stacktop(worker->interp, (void *)&job);
+
+    while ((job = take_job(worker)) != NULL) {
+        run_job(worker->interp, job);
+
+        THR_LOCK(&pool->lock);
+        job->done = 1;
+        THR_BROADCAST(&pool->done);
+        THR_UNLOCK(&pool->lock);
+    }
+
+    return NULL;
+}
+
+PARROT_CAN_RETURN_NULL
+static Parrot_Job *
+take_job(ARGMOD(Parrot_Worker *worker))
+{
+    ASSERT_ARGS(take_job)
+    Parrot_Worker_Pool * const pool = worker->pool;
+    const size_t               self = worker - pool->workers;
+
+    for (;;) {
+        Parrot_Job *job = NULL;
+        size_t      i;
+
+        THR_LOCK(&pool->lock);
+        while (!pool->queued && !pool->shutdown)
+            THR_WAIT(&pool->work, &pool->lock);
+        THR_UNLOCK(&pool->lock);
+
+        if (pool->shutdown)
+            return NULL;
+
+        job = pop_job(&worker->deque);
+        for (i = 1; !job && i < pool->n_workers; ++i)
+            job = steal_job(&pool->workers[(self + i) % pool->n_workers].deque);
+
+        if (job) {
+            THR_LOCK(&pool->lock);
+            --pool->queued;
+            THR_UNLOCK(&pool->lock);
+
+            return job;
+        }
+    }
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/pmc/workerpool.pmc>, F<include/parrot/thread.h>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
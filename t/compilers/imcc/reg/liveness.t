@@ -0,0 +1,126 @@
+#!perl
+# Copyright (C) 2013, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Parrot::Test tests => 5;
+
+##############################
+# Liveness-based register allocation at -O1.
+
+$ENV{TEST_PROG_ARGS} = '-O1';
+
+pir_output_is( <<'CODE', <<'OUT', "temporaries with disjoint lifetimes share registers" );
+.sub main :main
+    $I0 = 1
+    $I1 = $I0 + 2
+    $I2 = $I1 * 3
+    $I3 = $I2 - 4
+    $I4 = $I3 * 5
+    say $I4
+    $S0 = "a"
+    $S1 = concat $S0, "b"
+    $S2 = concat $S1, "c"
+    say $S2
+    $P0 = get_global 'main'
+    $I5 = $P0.'__get_regs_used'('I')
+    $I6 = islt $I5, 5
+    say $I6
+    $I5 = $P0.'__get_regs_used'('S')
+    $I6 = islt $I5, 3
+    say $I6
+.end
+CODE
+25
+abc
+1
+1
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values live around a loop are kept" );
+.sub main :main
+    $I0 = 0
+    $I1 = 0
+    $I9 = 7
+  loop:
+    $I2 = $I0 * 2
+    $I1 += $I2
+    inc $I0
+    if $I0 < 10 goto loop
+    say $I1
+    say $I9
+.end
+CODE
+90
+7
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values read by an exception handler are kept" );
+.sub main :main
+    push_eh handler
+    $I0 = 42
+    $S0 = "kept"
+    $P0 = new 'Exception'
+    $I1 = 1
+    $I2 = $I1 + 1
+    throw $P0
+    say "not reached"
+  handler:
+    .get_results($P1)
+    pop_eh
+    say $I0
+    say $S0
+.end
+CODE
+42
+kept
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "lexicals keep their registers" );
+.sub main :main
+    .lex '$a', $P0
+    $P0 = box 1
+    $I0 = 3
+    $I1 = $I0 + 4
+    say $I1
+    $P1 = box 2
+    inner()
+    say $P0
+.end
+.sub inner :outer('main')
+    $P0 = find_lex '$a'
+    $P1 = box 10
+    $P0 += $P1
+.end
+CODE
+7
+11
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "call arguments and results" );
+.sub main :main
+    $I0 = 1
+    $I1 = 2
+    $I2 = 'add'($I0, $I1)
+    $I3 = 'add'($I2, $I0)
+    say $I2
+    say $I3
+.end
+.sub add
+    .param int a
+    .param int b
+    $I0 = a + b
+    .return ($I0)
+.end
+CODE
+3
+4
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,85 @@
+#!perl
+# Copyright (C) 2013, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Test::More;
+use File::Spec;
+use Parrot::Config;
+use Parrot::Test;
+
+my $disassemble = File::Spec->catfile( ".", "pbc_disassemble" );
+unless ( -f $disassemble . $PConfig{exe} ) {
+    plan skip_all => "pbc_disassemble hasn't been built. Run make parrot_utils";
+    exit(0);
+}
+plan tests => 5;
+
+##############################
+# Superinstructions from src/ops/ops.super, fused by IMCC at -O1.
+
+my $primes = <<'CODE';
+.sub main :main
+    $I0 = 10
+    $I1 = 0
+loop:
+    $I2 = 2
+test:
+    $I3 = $I0 % $I2
+    unless $I3 goto next
+    inc $I2
+    if $I2 < $I0 goto test
+    inc $I1
+next:
+    inc $I0
+    if $I0 < 30 goto loop
+    say $I1
+.end
+CODE
+
+my $zigzag = <<'CODE';
+.sub main :main
+    $I0 = 10
+    $I1 = 0
+loop:
+    $I2 = $I1 % 3
+    unless $I2 goto up
+    dec $I0
+    goto next
+up:
+    $I0 += 2
+next:
+    inc $I1
+    if $I1 < 6 goto loop
+    say $I0
+.end
+CODE
+
+$ENV{TEST_PROG_ARGS} = '';
+
+pbc_postprocess_output_like( $disassemble, $primes, 'pir', qr/^(?!.*__)/s,
+    'nothing is fused without -O' );
+
+$ENV{TEST_PROG_ARGS} = '-O1';
+
+pbc_postprocess_output_like( $disassemble, $primes, 'pir', qr/\bmod_i_i_i__unless_i_ic\b/,
+    'mod_i_i_i and unless_i_ic are fused' );
+
+pbc_postprocess_output_like( $disassemble, $zigzag, 'pir', qr/\bdec_i__branch_ic\b/,
+    'dec_i and branch_ic are fused' );
+
+pir_output_is( $primes, <<'OUT', 'fused mod and unless run' );
+6
+OUT
+
+pir_output_is( $zigzag, <<'OUT', 'fused dec and branch run' );
+10
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -14,7 +14,11 @@ my @files := <
 
 my $f := Ops::File.new(:oplib($oplib), |@files, :core(1));
 
-my @ops := $f.ops;
+# Skip the superinstructions appended from ops.super.
+my @ops;
+for $f.ops -> $op {
+    @ops.push($op) unless $op ~~ Ops::SuperOp;
+}
 # 82 core
 # 116 math
 # We can generate more than 1 Ops::Op per op due args expansion.
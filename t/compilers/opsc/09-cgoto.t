@@ -0,0 +1,81 @@
+#! ./parrot-nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+pir::load_bytecode("opsc.pbc");
+
+plan(10);
+
+my $trans := Ops::Trans::CGoto.new();
+
+my $lib := Ops::OpLib.new();
+my $emitter := Ops::Emitter.new(
+    :ops_file(Ops::File.new(
+        :oplib($lib),
+        :core(1),
+        'src/ops/cmp.ops')
+    ),
+    :trans($trans),
+    :script('ops2c'),
+    :flags(
+        hash( dir => 'tmp/', core => 1 )
+    ),
+);
+
+ok( $emitter, "Emitter created");
+ok( $emitter<func_header> ~~ /core_ops_cg\.h$/, 'header file named after suffix');
+
+my $fh := pir::new__Ps('StringHandle');
+$fh.open('header.h', 'w');
+$emitter.emit_c_runcore_header($fh);
+$fh.close();
+my $header := $fh.readall();
+
+ok($header ~~ /define \s PARROT_OPLIB_CORE_OPS_CG_H_GUARD/, 'Guard generated');
+ok($header ~~ /Parrot_runops_core_ops_cg/, 'Dispatch function declared');
+
+$fh := pir::new__Ps('StringHandle');
+$fh.open('core.c', 'w');
+$emitter.emit_c_runcore_source($fh);
+$fh.close();
+my $source := $fh.readall();
+
+ok($source ~~ /'&&cg_eq_i_i_ic'/, 'Label table generated');
+ok($source ~~ /'cg_eq_i_i_ic:'/, 'Op body labelled');
+ok($source ~~ /'goto *cg_thread'/, 'Ops dispatched through the thread');
+ok($source ~! /'return (opcode_t *)'/, 'Op bodies do not return');
+
+my $op_body := '
+inline op do_stuff(invar PMC)
+{
+    goto ADDRESS(234);
+}';
+my $new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'cur_opcode = (opcode_t *)(234); goto cg_dispatch_address;'/,
+    "goto ADDRESS() translated ok");
+
+$op_body := '
+inline op branch(in LABEL) :base_loop :flow {
+    goto OFFSET($1);
+}';
+$new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'cur_opcode += IREG(1); DISPATCH_OP();'/,
+    "goto OFFSET() translated ok");
+
+sub translate_op_body($trans, $body) {
+    my $file  := Ops::File.new_str(
+        :oplib($lib), $body);
+    my $emitter := Ops::Emitter.new(
+        :ops_file($file),
+        :trans($trans),
+        :script("opsc"),
+        :flags( hash(core => '1') )
+    );
+
+    my $sh := pir::new__Ps('StringHandle');
+    $sh.open('your_bank_account_information.txt', 'w');
+    $emitter.emit_c_runcore_source($sh);
+    $sh.close();
+    $sh.readall();
+}
+
+# vim: expandtab shiftwidth=4 ft=perl6:
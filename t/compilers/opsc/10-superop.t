@@ -0,0 +1,54 @@
+#! ./parrot-nqp
+# Copyright (C) 2011, Parrot Foundation.
+
+pir::load_bytecode("opsc.pbc");
+
+plan(12);
+
+my $compiler := pir::compreg__Ps('Ops');
+my $trans    := Ops::Trans::C.new;
+
+my $past := $compiler.compile(q«
+inline op set_it(out INT, in INT) {
+    $1 = $2;
+}
+
+inline op add_it(inout INT, in INT) {
+    $1 += $2;
+}
+
+inline op lt_it(in INT, in INT, inconst LABEL) {
+    if ($1 < $2)
+        goto OFFSET($3);
+}
+
+inline op here_it(out INT) {
+    $1 = CUR_OPCODE - (opcode_t *)0;
+}
+», target => 'past');
+
+my %ops;
+for @($past<ops>) -> $op {
+    %ops{$op.full_name} := $op;
+}
+
+ok( %ops<set_it_i_i>.can_fuse,  'simple op can be fused');
+ok( !%ops<lt_it_i_i_ic>.can_fuse, 'branching op cannot be fused');
+ok( !%ops<here_it_i>.can_fuse,  'op using its own address cannot be fused');
+
+my $super := Ops::SuperOp.fuse(list(%ops<set_it_i_i>, %ops<add_it_i_ic>, %ops<lt_it_i_i_ic>));
+
+ok( $super.full_name eq 'set_it_i_i__add_it_i_ic__lt_it_i_i_ic', 'full name joins fused ops');
+ok( $super.size == 8, 'superinstruction takes all arguments');
+ok( +$super.arg_types == 7, 'argument types concatenated');
+ok( $super.jump, 'jump flags taken from last op');
+
+my $body := $super.get_body($trans);
+
+ok( $body ~~ /^ '{' .* '}' \s* $/, 'fused bodies wrapped in a single block');
+ok( $body ~~ / 'IREG(1) = IREG(2)' /, 'first op reads its own arguments');
+ok( $body ~~ / 'IREG(3) += ICONST(4)' /, 'second op arguments shifted');
+ok( $body ~~ / 'cur_opcode + ICONST(7)' /, 'last op branches relative to superinstruction');
+ok( $body ~~ / 'return (opcode_t *)cur_opcode + 8' /, 'next op is after superinstruction');
+
+# vim: expandtab shiftwidth=4 ft=perl6:
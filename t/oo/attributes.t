@@ -18,11 +18,96 @@ Tests OO features related to adding and removing attributes.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(3)
+    plan(7)
 
+    cached_access()
     remove_1()
 .end
 
+.sub cached_access
+    .local pmc one, two, three, objects, object
+    .local string got
+
+    one = newclass 'CachedOne'
+    addattribute one, 'a'
+    addattribute one, 'b'
+    two = newclass 'CachedTwo'
+    addattribute two, 'b'
+    three = subclass one, 'CachedThree'
+    addattribute three, 'c'
+
+    objects = new 'ResizablePMCArray'
+    $P0 = new one
+    push objects, $P0
+    $P0 = new two
+    push objects, $P0
+    $P0 = new three
+    push objects, $P0
+
+    # the same ops see objects of each class in turn
+    $I0 = 0
+  set_loop:
+    object = objects[$I0]
+    $S0 = $I0
+    $P1 = box $S0
+    setattribute object, 'b', $P1
+    inc $I0
+    if $I0 < 3 goto set_loop
+
+    got = ''
+    $I1 = 0
+  get_loop:
+    $I0 = 0
+  get_class_loop:
+    object = objects[$I0]
+    $P1 = getattribute object, 'b'
+    $S0 = $P1
+    got .= $S0
+    inc $I0
+    if $I0 < 3 goto get_class_loop
+    inc $I1
+    if $I1 < 2 goto get_loop
+    is(got, '012012', 'attribute accesses cached for several classes')
+
+    object = objects[0]
+    $P1 = getattribute object, 'a'
+    $I0 = isnull $P1
+    ok($I0, 'other attributes untouched')
+
+    $P0 = new 'CachedOverride'
+    $I1 = 0
+  override_loop:
+    $P1 = getattribute $P0, 'b'
+    inc $I1
+    if $I1 < 2 goto override_loop
+    is($P1, 'overridden b', 'get_attr_str override is run on every access')
+
+    $P0 = new 'CachedTwo'
+    push_eh missing
+    $P1 = getattribute $P0, 'a'
+    pop_eh
+    ok(0, 'missing attribute found')
+    .return ()
+  missing:
+    pop_eh
+    ok(1, 'missing attribute throws')
+.end
+
+.namespace ['CachedOverride']
+
+.sub '' :init :load :anon
+    $P0 = newclass 'CachedOverride'
+    addattribute $P0, 'b'
+.end
+
+.sub 'get_attr_str' :vtable :method
+    .param string name
+    $S0 = 'overridden ' . name
+    .return ($S0)
+.end
+
+.namespace []
+
 .sub remove_1
     .local pmc class, object, init_hash
     .local pmc exception, message
@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2007-2010, Parrot Foundation.
+# Copyright (C) 2007-2011, Parrot Foundation.
 
 =head1 NAME
 
@@ -22,7 +22,7 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     create_library()
 
-    plan(6)
+    plan(9)
 
     loading_methods_from_file()
     loading_methods_from_eval()
@@ -30,6 +30,10 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     overridden_core_pmc()
 
+    polymorphic_call_site()
+    non_constant_method_names()
+    redefined_method_after_call()
+
     try_delete_library()
 
 .end
@@ -149,6 +153,115 @@ END
     .return(1)
 .end
 
+.namespace []
+
+.sub 'polymorphic_call_site'
+    .local pmc invocants
+    .local string res
+    invocants = new 'ResizablePMCArray'
+    $P0 = newclass 'SiteA'
+    $P0 = newclass 'SiteB'
+    $P0 = newclass 'SiteC'
+    $P0 = newclass 'SiteD'
+    $P0 = new 'SiteA'
+    push invocants, $P0
+    $P0 = new 'SiteB'
+    push invocants, $P0
+    $P0 = new 'SiteC'
+    push invocants, $P0
+    $P0 = new 'SiteD'
+    push invocants, $P0
+    $P0 = new 'ResizableStringArray'
+    push invocants, $P0
+
+    # more invocant types than a call site caches
+    res = ''
+    $I0 = 0
+  loop:
+    $I1 = $I0 % 5
+    $P0 = invocants[$I1]
+    $S0 = $P0.'who'()
+    res .= $S0
+    inc $I0
+    if $I0 < 10 goto loop
+
+    is(res, 'abcdsabcds', 'call site with many invocant types')
+.end
+
+.sub 'non_constant_method_names'
+    .local string res
+    $P0 = new 'SiteA'
+    res = ''
+    $I0 = 0
+  loop:
+    $S1 = 'who'
+    $I1 = $I0 % 2
+    unless $I1 goto call
+    $S1 = 'what'
+  call:
+    $S0 = $P0.$S1()
+    res .= $S0
+    inc $I0
+    if $I0 < 4 goto loop
+
+    is(res, 'aAaA', 'call site with varying method names')
+.end
+
+.sub 'redefined_method_after_call'
+    $P0 = new 'ResizableStringArray'
+    $S0 = call_greet($P0)
+
+    $S2 = <<'END'
+        .namespace ['ResizableStringArray']
+        .sub 'greet' :method
+            .return ('two')
+        .end
+END
+    $P2 = compreg 'PIR'
+    $P2($S2)
+
+    $S1 = call_greet($P0)
+    $S0 .= $S1
+    is($S0, 'onetwo', 'call site sees redefined method')
+.end
+
+.sub 'call_greet'
+    .param pmc obj
+    $S0 = obj.'greet'()
+    .return ($S0)
+.end
+
+.namespace ['SiteA']
+.sub 'who' :method
+    .return ('a')
+.end
+.sub 'what' :method
+    .return ('A')
+.end
+
+.namespace ['SiteB']
+.sub 'who' :method
+    .return ('b')
+.end
+
+.namespace ['SiteC']
+.sub 'who' :method
+    .return ('c')
+.end
+
+.namespace ['SiteD']
+.sub 'who' :method
+    .return ('d')
+.end
+
+.namespace ['ResizableStringArray']
+.sub 'who' :method
+    .return ('s')
+.end
+.sub 'greet' :method
+    .return ('one')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
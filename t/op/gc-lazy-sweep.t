@@ -0,0 +1,170 @@
+#! perl
+# Copyright (C) 2011, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Test::More;
+use Parrot::Test tests => 3;
+
+=head1 NAME
+
+t/op/gc-lazy-sweep.t - Destroying PMCs from collections which sweep lazily
+
+=head1 SYNOPSIS
+
+    % prove t/op/gc-lazy-sweep.t
+
+=head1 DESCRIPTION
+
+A collection started by running out of headers leaves most dead PMCs to be
+swept by later allocations.  Dead FileHandles with unflushed output must still
+be destroyed, and so write their output, before the next collection.
+
+Live PMCs written to before the sweep reaches them must still be promoted
+along with their parents, or the next collection of their generation frees
+them.
+
+=cut
+
+my $temp = 'temp_gc_lazy_sweep.txt';
+
+END {
+    unlink $temp;
+}
+
+my $code = <<"CODE";
+.include 'interpinfo.pasm'
+
+.sub main :main
+    .local pmc handles, fh, junk
+    .local int i, runs
+
+    handles = new ['ResizablePMCArray']
+    i = 0
+  open_loop:
+    fh = new ['FileHandle']
+    fh.'open'('$temp', 'a')
+    fh.'print'("line\\n")
+    push handles, fh
+    inc i
+    if i < 200 goto open_loop
+
+    # Let the handles get old before they die
+    i = 0
+  age_loop:
+    sweep 1
+    inc i
+    if i < 12 goto age_loop
+    null handles
+    null fh
+
+    # Run out of headers until the handles' generation was collected
+    runs = interpinfo .INTERPINFO_GC_MARK_RUNS
+    runs += 25
+  churn:
+    junk = new ['ResizablePMCArray']
+    \$S0 = i
+    push junk, \$S0
+    inc i
+    \$I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    if \$I0 < runs goto churn
+
+    junk = new ['ResizablePMCArray']
+    sweep 1
+
+    fh = new ['FileHandle']
+    \$S0 = fh.'readall'('$temp')
+    \$I0 = length \$S0
+    \$I0 /= 5
+    say \$I0
+.end
+CODE
+
+# A small nursery keeps GMS from allocating a few percent of memory per run
+for my $gc ('gms --gc-nursery-size=0.01', 'ms') {
+    unlink $temp;
+    local $ENV{TEST_PROG_ARGS} = ($ENV{TEST_PROG_ARGS} || '') . " --gc $gc";
+    pir_output_is( $code, "200\n", "dead FileHandles are destroyed with --gc $gc" );
+}
+
+{
+    local $ENV{TEST_PROG_ARGS} = ($ENV{TEST_PROG_ARGS} || '') . ' --gc gms --gc-nursery-size=0.01';
+    pir_output_is( <<'CODE', "2000\n", 'PMCs written to before the sweep reaches them' );
+.include 'interpinfo.pasm'
+
+.sub main :main
+    .local pmc holders, holder, box, junk
+    .local int i, n, runs
+
+    # Holders come first, so the sweep promotes them before their boxes
+    n = 2000
+    holders = new ['ResizablePMCArray']
+    i = 0
+  holder_loop:
+    holder = new ['ResizablePMCArray']
+    push holders, holder
+    inc i
+    if i < n goto holder_loop
+
+    i = 0
+  box_loop:
+    box = new ['ResizableIntegerArray']
+    holder = holders[i]
+    push holder, box
+    inc i
+    if i < n goto box_loop
+
+    sweep 1
+
+    # Allocate up to the next collection of generation 1, which is lazy
+  churn:
+    junk = new ['ResizablePMCArray']
+    $I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I0 %= 10
+    if $I0 goto churn
+
+    # Write to the boxes before the sweep reaches them
+    i = 0
+  push_loop:
+    holder = holders[i]
+    box = holder[0]
+    push box, i
+    inc i
+    if i < n goto push_loop
+
+    # Collect generation 1 a few more times
+    runs = interpinfo .INTERPINFO_GC_MARK_RUNS
+    runs += 25
+  churn_more:
+    junk = new ['ResizablePMCArray']
+    $S0 = i
+    push junk, $S0
+    inc i
+    $I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    if $I0 < runs goto churn_more
+
+    n = 0
+    i = 0
+  check_loop:
+    holder = holders[i]
+    box = holder[0]
+    $S0 = typeof box
+    if $S0 != 'ResizableIntegerArray' goto next
+    $I0 = box[0]
+    if $I0 != i goto next
+    inc n
+  next:
+    inc i
+    if i < 2000 goto check_loop
+    say n
+.end
+CODE
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 61;
+use Parrot::Test tests => 67;
 
 =head1 NAME
 
@@ -17,16 +17,19 @@ t/op/jit.t - JIT register allocation
 
 =head1 DESCRIPTION
 
-Tests JIT register allocation. The tests are written for 4 mapped
+Tests the JIT core. The register allocation tests are written for 4 mapped
 registers per kind, i.e. the crippled x86 architecture. If you are
 experimenting with register allocation please just use settings like
 in jit/i386/jit_emit, i.e. 4 mapped regs, 2 volatile ints ...
 
-These tests are of course usable for other run cores too, the results
-should just be the same.
+These tests are run with the C<jit> core unless the harness selected another
+one; the results should just be the same.
 
 =cut
 
+$ENV{TEST_PROG_ARGS} ||= '';
+$ENV{TEST_PROG_ARGS} .= ' -R jit' unless $ENV{TEST_PROG_ARGS} =~ /runcore|-R\b/;
+
 pasm_output_is( <<'CODE', <<'OUTPUT', "add_i_i_i 1,2,3 mapped" );
 .pcc_sub :main main:
 set I0,0
@@ -1306,6 +1309,165 @@ CODE
 16
 OUTPUT
 
+pasm_output_is( <<'CODE', <<'OUTPUT', "loop with backward branch" );
+.pcc_sub :main main:
+    set I0, 0
+    set I1, 0
+loop:
+    add I1, I1, I0
+    inc I0
+    lt I0, 100000, loop
+    print I1
+    print "\n"
+    end
+CODE
+4999950000
+OUTPUT
+
+pasm_output_is( <<'CODE', <<'OUTPUT', "64 bit constants" );
+.pcc_sub :main main:
+    set I0, 4294967296
+    add I1, I0, 8589934592
+    print I1
+    print "\n"
+    set I2, -4294967297
+    mul I2, I2, 2
+    print I2
+    print "\n"
+    eq I1, 12884901888, ok
+    print "not "
+ok:
+    print "ok\n"
+    end
+CODE
+12884901888
+-8589934594
+ok
+OUTPUT
+
+pasm_output_is( <<'CODE', <<'OUTPUT', "templated ops mixed with called ops" );
+.pcc_sub :main main:
+    set I0, 17
+    set I1, 5
+    div I2, I0, I1
+    mod I3, I0, I1
+    add I4, I2, I3
+    abs I5, -7
+    print I4
+    print " "
+    print I5
+    print "\n"
+    set N0, 7.5
+    div N1, N0, 2.5
+    sub N1, N1, 0.5
+    print N1
+    print "\n"
+    end
+CODE
+5 7
+2.5
+OUTPUT
+
+pasm_output_is( <<'CODE', <<'OUTPUT', "cmp, neg, abs and conversions" );
+.pcc_sub :main main:
+    cmp I0, 1, 2
+    cmp I1, 2, 2
+    cmp I2, 3, 2
+    print I0
+    print I1
+    print I2
+    print "\n"
+    set N0, -2.5
+    cmp I0, N0, 1.0
+    neg N1, N0
+    abs N2, N0
+    neg I3, I2
+    set I4, N1
+    set N3, I3
+    print I0
+    print " "
+    print N1
+    print " "
+    print N2
+    print " "
+    print I3
+    print " "
+    print I4
+    print " "
+    print N3
+    print "\n"
+    end
+CODE
+-101
+-1 2.5 2.5 -1 2 -1
+OUTPUT
+
+pasm_output_is( <<'CODE', <<'OUTPUT', "NaN compares" );
+.pcc_sub :main main:
+    set N0, "NaN"
+    eq N0, N0, bad
+    print "ok 1\n"
+    lt N0, 1.0, bad
+    le N0, 1.0, bad
+    lt 1.0, N0, bad
+    print "ok 2\n"
+    ne N0, N0, ok3
+    print "not "
+ok3:
+    print "ok 3\n"
+    if N0, ok4
+    print "not "
+ok4:
+    print "ok 4\n"
+    unless N0, bad
+    print "ok 5\n"
+    cmp I0, N0, 1.0
+    print I0
+    print "\n"
+    end
+bad:
+    print "bad\n"
+    end
+CODE
+ok 1
+ok 2
+ok 3
+ok 4
+ok 5
+0
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "calls and exceptions across jitted code" );
+.sub main :main
+    $I0 = fib(20)
+    say $I0
+    push_eh handler
+    $I1 = 0
+    $N0 = 1.5
+    $N0 += 1.0
+    $I1 = 1 / $I1
+    say "not reached"
+  handler:
+    pop_eh
+    say $N0
+.end
+
+.sub fib
+    .param int n
+    if n < 2 goto done
+    $I0 = n - 1
+    $I1 = fib($I0)
+    $I2 = n - 2
+    $I3 = fib($I2)
+    n = $I1 + $I3
+  done:
+    .return (n)
+.end
+CODE
+6765
+2.5
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -19,10 +19,14 @@ t/op/jitn.t - JIT register allocation
 =head1 DESCRIPTION
 
 Tests JIT register allocation. These tests are written for four mappable
-registers.
+registers. They are run with the C<jit> core unless the harness selected
+another one.
 
 =cut
 
+$ENV{TEST_PROG_ARGS} ||= '';
+$ENV{TEST_PROG_ARGS} .= ' -R jit' unless $ENV{TEST_PROG_ARGS} =~ /runcore|-R\b/;
+
 my $output;
 
 pasm_output_is( <<'CODE', <<'OUTPUT', "sub_n_n_n 1,2,3 mapped" );
@@ -13,7 +13,7 @@ $ENV{TEST_PROG_ARGS} ||= '';
 plan( skip_all => 'lexicals not thawed properly from PBC, TT #1171' )
     if $ENV{TEST_PROG_ARGS} =~ /--run-pbc/;
 
-plan( tests => 54 );
+plan( tests => 55 );
 
 =head1 NAME
 
@@ -1644,6 +1644,60 @@ Starobrno
 Pilsner Urquell
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', 'repeated lexical access through nested closures' );
+.sub main :main
+    .lex 'i', $I0
+    .lex 's', $S0
+    $I0 = 0
+    $S0 = ''
+    $P0 = get_global 'middle'
+    $P1 = newclosure $P0
+    $I1 = 0
+  loop:
+    $P1($I1)
+    inc $I1
+    if $I1 < 5 goto loop
+    $I2 = find_lex 'i'
+    say $I2
+    $S2 = find_lex 's'
+    say $S2
+    'shadow'()
+.end
+.sub 'middle' :outer('main')
+    .param int n
+    .lex 'n', $N0
+    $N0 = n
+    $N0 /= 2
+    $P0 = get_global 'inner'
+    $P1 = newclosure $P0
+    $P1()
+.end
+.sub 'inner' :outer('middle')
+    $I0 = find_lex 'i'
+    $I0 += 10
+    store_lex 'i', $I0
+    $N0 = find_lex 'n'
+    $S0 = $N0
+    $S1 = find_lex 's'
+    $S1 .= ' '
+    $S1 .= $S0
+    store_lex 's', $S1
+.end
+.sub 'shadow' :outer('main')
+    .lex 'i', $P0
+    $P0 = box 7
+    'reader'()
+.end
+.sub 'reader' :outer('shadow')
+    $P0 = find_lex 'i'
+    say $P0
+.end
+CODE
+50
+ 0 0.5 1 1.5 2
+7
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
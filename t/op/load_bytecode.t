@@ -5,7 +5,8 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 3;
+use Parrot::Test tests => 5;
+use Parrot::Config;
 
 =head1 NAME
 
@@ -45,6 +46,169 @@ CODE
 /"load_bytecode" couldn't find file 'no_file_by_this_name'/
 OUTPUT
 
+my $temp = "temp_load_bytecode";
+
+my $shared = "temp_load_bytecode_shared";
+
+END {
+    unlink( "$temp.pir", "$temp.pbc", "$shared.pir", "$shared.pbc" );
+}
+
+open my $S, '>', "$temp.pir" or die "Can't write $temp.pir";
+print $S <<'EOF';
+.sub 'top'
+    .return ('top')
+.end
+.namespace ['A']
+.sub 'a1'
+    .return ('A a1')
+.end
+.sub 'hidden' :anon
+    .return ('anon')
+.end
+.namespace ['A'; 'B']
+.sub 'ab'
+    .return ('A::B ab')
+.end
+.sub 'm' :multi(int)
+    .return ('A::B m int')
+.end
+.sub 'm' :multi(string)
+    .return ('A::B m string')
+.end
+.namespace ['A']
+.sub 'a2'
+    .return ('A a2')
+.end
+.HLL 'load_bytecode_test'
+.namespace ['C']
+.sub 'c'
+    .return ('C c')
+.end
+EOF
+close $S;
+
+system(".$PConfig{slash}parrot$PConfig{exe}", '-o', "$temp.pbc", "$temp.pir") == 0
+    or die "Can't compile $temp.pir: exit status $?";
+
+pir_output_is( <<'CODE', <<'OUTPUT', "load_bytecode stores subs across namespaces and HLLs" );
+.sub main :main
+    load_bytecode 'temp_load_bytecode.pbc'
+    $P0 = get_global 'top'
+    $S0 = $P0()
+    say $S0
+    $P0 = get_global ['A'], 'a1'
+    $S0 = $P0()
+    say $S0
+    $P0 = get_global ['A'], 'a2'
+    $S0 = $P0()
+    say $S0
+    $P0 = get_global ['A'], 'hidden'
+    $I0 = isnull $P0
+    say $I0
+    $P0 = get_global ['A'; 'B'], 'ab'
+    $S0 = $P0()
+    say $S0
+    $P0 = get_global ['A'; 'B'], 'm'
+    $S0 = $P0(1)
+    say $S0
+    $S0 = $P0('x')
+    say $S0
+    $P0 = get_root_global ['load_bytecode_test'; 'C'], 'c'
+    $S0 = $P0()
+    say $S0
+.end
+CODE
+top
+A a1
+A a2
+1
+A::B ab
+A::B m int
+A::B m string
+C c
+OUTPUT
+
+# Later PMC constants refer back into the objects of earlier ones: the
+# closures' :outer sub, their namespace and the multi subs' signatures.
+open $S, '>', "$shared.pir" or die "Can't write $shared.pir";
+print $S <<'EOF';
+.namespace ['Shared'; 'Deep']
+.sub 'counter'
+    .lex '$n', $P0
+    $P0 = new 'Integer'
+    $P0 = 10
+    .const 'Sub' inc = 'inc_n'
+    .const 'Sub' dbl = 'dbl_n'
+    $P1 = newclosure inc
+    $P2 = newclosure dbl
+    $P3 = new 'ResizablePMCArray'
+    push $P3, $P1
+    push $P3, $P2
+    .return ($P3)
+.end
+.sub 'inc_n' :outer('counter')
+    $P0 = find_lex '$n'
+    inc $P0
+    .return ($P0)
+.end
+.sub 'dbl_n' :outer('counter')
+    $P0 = find_lex '$n'
+    $P0 *= 2
+    .return ($P0)
+.end
+.sub 'm' :multi(int, int)
+    .return ('int int')
+.end
+.sub 'm' :multi(int, string)
+    .return ('int string')
+.end
+EOF
+close $S;
+
+system(".$PConfig{slash}parrot$PConfig{exe}", '-o', "$shared.pbc", "$shared.pir") == 0
+    or die "Can't compile $shared.pir: exit status $?";
+
+pir_output_is( <<'CODE', <<'OUTPUT', "load_bytecode thaws PMC constants sharing objects" );
+.sub main :main
+    load_bytecode 'temp_load_bytecode_shared.pbc'
+    .local pmc counter, inc, dbl, subs
+    counter = get_global ['Shared'; 'Deep'], 'counter'
+    inc     = get_global ['Shared'; 'Deep'], 'inc_n'
+    dbl     = get_global ['Shared'; 'Deep'], 'dbl_n'
+    $P0 = inc.'get_outer'()
+    $I0 = issame $P0, counter
+    say $I0
+    $P0 = dbl.'get_outer'()
+    $I0 = issame $P0, counter
+    say $I0
+    $P0 = inc.'get_namespace'()
+    $P1 = dbl.'get_namespace'()
+    $I0 = issame $P0, $P1
+    say $I0
+    subs = counter()
+    $P0 = subs[0]
+    $P1 = $P0()
+    say $P1
+    $P0 = subs[1]
+    $P1 = $P0()
+    say $P1
+    $P0 = get_global ['Shared'; 'Deep'], 'm'
+    $S0 = $P0(1, 2)
+    say $S0
+    $S0 = $P0(1, 'x')
+    say $S0
+.end
+CODE
+1
+1
+1
+11
+22
+int int
+int string
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -115,6 +115,8 @@ Tests Parrot string registers and operations.
     cow_with_chopn_leaving_original_untouched()
     check_that_bug_bug_16874_was_fixed()
     stress_concat()
+    concat_at_both_ends()
+    interned_strings()
     ord_and_substring_see_bug_17035()
 
     test_sprintf()
@@ -1184,6 +1186,83 @@ WHILE:
     ok(1, 'stress concat test')
 .end
 
+.sub concat_at_both_ends
+    .local string s, t, u, v, w
+    s = 'mid'
+    $I0 = 0
+  LOOP:
+    s = concat 'L', s
+    s = concat s, 'R'
+    inc $I0
+    if $I0 < 100 goto LOOP
+
+    $I0 = length s
+    is( $I0, 203, 'concat at both ends - length' )
+    $S0 = substr s, 98, 7
+    is( $S0, 'LLmidRR', 'concat at both ends - middle' )
+
+    # Only the first of two concats can use the spare room
+    t = concat 'a', s
+    u = concat 'b', s
+    v = concat s, 'c'
+    w = concat s, 'd'
+    $S0 = substr t, 0, 2
+    is( $S0, 'aL', 'concat at both ends - first prepend' )
+    $S0 = substr u, 0, 2
+    is( $S0, 'bL', 'concat at both ends - second prepend' )
+    $S0 = substr v, -2
+    is( $S0, 'Rc', 'concat at both ends - first append' )
+    $S0 = substr w, -2
+    is( $S0, 'Rd', 'concat at both ends - second append' )
+    $S0 = substr s, 0, 1
+    $S1 = substr s, -1
+    $S0 .= $S1
+    is( $S0, 'LR', 'concat at both ends - original untouched' )
+
+    s = concat unicode:"\u263a", s
+    $S0 = substr s, 0, 2
+    is( $S0, unicode:"\u263aL", 'concat at both ends - prepend utf8' )
+.end
+
+.sub interned_strings
+    .local pmc compiler, code
+    compiler = compreg 'PIR'
+    code     = compiler(<<'CODE')
+.sub 'interned_name'
+    .return ('interned_name')
+.end
+CODE
+    $P0 = get_global 'interned_name'
+    $S0 = $P0()
+    $I0 = issame $S0, 'interned_name'
+    ok( $I0, 'interned strings - constants of two units are the same string' )
+
+    $S1 = utf8:"interned_name"
+    $I0 = iseq $S1, 'interned_name'
+    ok( $I0, 'interned strings - equal across encodings' )
+    $I0 = iseq 'interned_name', 'interned_other'
+    nok( $I0, 'interned strings - distinct constants differ' )
+
+    $P1 = newclass 'InternedNames'
+    $P2 = new $P1
+    $S2 = 'interned_'
+    $I1 = 0
+  call_loop:
+    $S3 = concat $S2, 'method'
+    $S4 = $P2.$S3()
+    inc $I1
+    if $I1 < 3 goto call_loop
+    is( $S4, 'called', 'interned strings - method names built at runtime' )
+.end
+
+.namespace ['InternedNames']
+
+.sub 'interned_method' :method
+    .return ('called')
+.end
+
+.namespace []
+
 .sub ord_and_substring_see_bug_17035
     set $S0, "abcdef"
     substr $S1, $S0, 2, 3
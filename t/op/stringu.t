@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 47;
+use Parrot::Test tests => 49;
 use Parrot::Config;
 
 =head1 NAME
@@ -773,6 +773,101 @@ CODE
 0x10FFFD
 OUT
 
+pir_output_is( <<'CODE', <<'OUT', 'utf8 and ascii scans across long ASCII runs' );
+.sub 'main' :main
+    'test_length'(binary:"abcdefghijklmnopqrstuvwxyz", 'utf8')
+    'test_length'(binary:"abcdefghijklmnop\xC3\xA9qrstuvwxyz0123456789\xE2\x98\xBA!", 'utf8')
+    'test_length'(binary:"\xC3\xA9abcdefghijklmnopqrstuvwxyz", 'utf8')
+    'test_length'(binary:"abcdefghijklmnopqrstuvw\x80", 'utf8')
+    'test_length'(binary:"abcdefghijklmnopqrstuvw\xE2\x98", 'utf8')
+    'test_length'(binary:"abcdefghijklmnopqrstuvwxyz", 'ascii')
+    'test_length'(binary:"abcdefghijklmnopqrstuvwx\xE9yz", 'ascii')
+.end
+
+.sub 'test_length'
+    .param string chars
+    .param string encoding
+    .local pmc eh, bb
+    bb = new 'ByteBuffer'
+    bb = chars
+    eh = new 'ExceptionHandler'
+    set_label eh, handler
+    push_eh eh
+    chars = bb.'get_string'(encoding)
+    $I0 = length chars
+    say $I0
+    goto end
+  handler:
+    .local pmc ex
+    .get_results (ex)
+    $S0 = ex['message']
+    $S1 = substr $S0, -1
+    if $S1 == "\n" goto print_message
+    $S0 .= "\n"
+  print_message:
+    print $S0
+  end:
+    pop_eh
+.end
+CODE
+26
+39
+27
+Malformed UTF-8 string
+Unaligned end in UTF-8 string
+26
+Invalid character in ASCII string
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', 'indexing long utf8 and utf16 strings' );
+.sub 'main' :main
+    $S0 = utf8:"\x{e9}abcdefghij"
+    'check'($S0)
+    $S0 = utf8:"\x{e8}abcdefghij"
+    'check'($S0)
+    $S0 = utf8:"\x{1F600}abcdefghij"
+    $I0 = find_encoding 'utf16'
+    $S0 = trans_encoding $S0, $I0
+    'check'($S0)
+.end
+
+.sub 'check'
+    .param string unit
+    .local string s
+    .local int first, i, n, bad
+    first = ord unit
+    s     = repeat unit, 1000
+    n     = length s
+    bad   = 0
+    i     = n - 1
+  loop:
+    $I1 = i % 11
+    $I2 = $I1 + 96
+    if $I1 != 0 goto compare
+    $I2 = first
+  compare:
+    $I0 = ord s, i
+    if $I0 == $I2 goto check_substr
+    inc bad
+  check_substr:
+    $S0 = substr s, i, 1
+    $I0 = ord $S0
+    if $I0 == $I2 goto next
+    inc bad
+  next:
+    i -= 7
+    if i >= 0 goto loop
+    collect
+    print n
+    print ' '
+    say bad
+.end
+CODE
+11000 0
+11000 0
+11000 0
+OUT
+
 sub units_to_code {
     my $bytes_per_unit = shift;
 
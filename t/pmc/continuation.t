@@ -17,7 +17,7 @@ Tests the Continuation PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(9)
+    plan(11)
 
     test_new()
     invoke_with_init()
@@ -25,6 +25,8 @@ Tests the Continuation PMC.
     returns_tt1528()
     experimental_caller()
     get_pointer_and_string()
+    reenter_returned_frames()
+    return_continuation_reused()
 .end
 
 .sub test_new
@@ -173,6 +175,70 @@ end:
    dummy:
 .end
 
+.sub 'reenter_returned_frames'
+    .local pmc passes
+    passes = new 'Integer'
+    set_global '!passes', passes
+
+    $S0 = 'reenter_outer'()
+    inc passes
+    if passes > 1 goto done
+    $P0 = get_global '!reentry'
+    $P0()
+  done:
+    is($S0, 'outer 7 inner 43', 'registers of returned frames survive re-entry')
+.end
+
+.sub 'reenter_outer'
+    $I1 = 7
+    $I0 = 'reenter_inner'()
+    $S0 = 'outer '
+    $S1 = $I1
+    $S0 .= $S1
+    $S0 .= ' inner '
+    $S1 = $I0
+    $S0 .= $S1
+    .return ($S0)
+.end
+
+.sub 'reenter_inner'
+    $I0 = 41
+    $P0 = new 'Continuation'
+    set_label $P0, again
+    set_global '!reentry', $P0
+  again:
+    inc $I0
+    .return ($I0)
+.end
+
+.sub 'return_continuation_reused'
+    .local pmc passes
+    passes = new 'Integer'
+    set_global '!passes', passes
+
+    $I0 = 'reused_outer'()
+    inc passes
+    if passes > 1 goto done
+    $P0 = get_global '!return_cc'
+    $P0(100)
+  done:
+    is($I0, 105, 'frame returned into twice keeps its registers')
+.end
+
+.sub 'reused_outer'
+    $I1 = 5
+    $I0 = 'reused_inner'()
+    $I0 += $I1
+    .return ($I0)
+.end
+
+.sub 'reused_inner'
+    .include 'interpinfo.pasm'
+    $P0 = interpinfo .INTERPINFO_CURRENT_CONT
+    set_global '!return_cc', $P0
+    .return (1)
+.end
+
 # end of tests.
 
 # Local Variables:
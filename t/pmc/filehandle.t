@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 30;
+use Parrot::Test tests => 32;
 use Parrot::Test::Util 'create_tempfile';
 
 =head1 NAME
@@ -1070,6 +1070,132 @@ CODE
 1
 OUT
 
+pir_output_is( <<"CODE", <<'OUT', 'mapped file - readline, read, seek' );
+.sub test :main
+    .local pmc fh
+    .local string str
+    .local int i, n
+
+    fh = new 'FileHandle'
+    fh.'open'('$temp_file', 'w')
+    i = 0
+  print_loop:
+    fh.'print'("line ")
+    fh.'print'(i)
+    fh.'print'("\\n")
+    inc i
+    if i < 1000 goto print_loop
+    fh.'print'('last')
+    fh.'close'()
+
+    fh.'open'('$temp_file', 'rm')
+    n = 0
+  read_loop:
+    str = fh.'readline'()
+    if str == '' goto read_done
+    inc n
+    goto read_loop
+  read_done:
+    say n
+    say str
+    i = fh.'eof'()
+    say i
+
+    fh.'seek'(0, 0)
+    str = fh.'readline'()
+    print str
+    str = fh.'read'(6)
+    say str
+    i = fh.'tell'()
+    say i
+
+    fh.'seek'(2, -4)
+    str = fh.'read'(100)
+    say str
+    str = fh.'read'(100)
+    i = length str
+    say i
+    i = fh.'eof'()
+    say i
+    fh.'close'()
+
+    # copies share the mapping, and strings read from it, or substrings of
+    # them, keep it mapped after both handles are closed
+    fh.'open'('$temp_file', 'rm')
+    \$S0 = fh.'readline'()
+    \$P0 = clone fh
+    str = \$P0.'readline'()
+    \$P0.'close'()
+    \$S1 = fh.'readline'()
+    \$S2 = fh.'read'(20)
+    fh.'close'()
+    \$S2 = substr \$S2, 7, 6
+    sweep 1
+    collect
+    print \$S0
+    print str
+    print \$S1
+    say \$S2
+.end
+CODE
+1001
+
+1
+line 0
+line 1
+13
+last
+0
+1
+line 0
+line 1
+line 1
+line 3
+OUT
+
+pir_output_is( <<"CODE", <<'OUT', 'mapped file - utf8 and empty files' );
+.sub test :main
+    .local pmc fh
+    .local string str
+    .local int i
+
+    fh = new 'FileHandle'
+    fh.'open'('$temp_file', 'w')
+    fh.'encoding'('utf8')
+    str = utf8:"\\x{2022}\\x{2022}\\n\\x{263a}"
+    fh.'print'(str)
+    fh.'close'()
+
+    fh.'open'('$temp_file', 'rm')
+    fh.'encoding'('utf8')
+    str = fh.'readline'()
+    i = length str
+    say i
+    str = fh.'read'(1)
+    i = length str
+    say i
+    i = ord str
+    say i
+    fh.'close'()
+
+    fh.'open'('$temp_file', 'w')
+    fh.'close'()
+    fh.'open'('$temp_file', 'rm')
+    str = fh.'readline'()
+    i = length str
+    say i
+    i = fh.'eof'()
+    say i
+    fh.'close'()
+.end
+CODE
+3
+1
+9786
+0
+1
+OUT
+
 # TT #1178
 # L<PDD22/I\/O PMC API/=item get_fd>
 # NOTES: this is going to be platform dependent
@@ -68,8 +68,10 @@ well.
     broken_delete()
     unicode_keys_register_rt_39249()
     unicode_keys_literal_rt_39249()
+    keys_in_other_encodings()
 
     integer_keys()
+    integer_keys_deleted_in_bulk()
     value_types_convertion()
     elements_in_hash()
     equality_tests()
@@ -1334,6 +1336,36 @@ postit_end:
   is( $S1, 'ok', 'literal unicode key lookup via var' )
 .end
 
+.sub keys_in_other_encodings
+    .local pmc hash
+    hash = new ['Hash']
+
+    $S0 = "a_rather_long_identifier"
+    hash[$S0] = "ascii"
+    $S1 = utf8:"caf\u00e9 na\u00efve \u7777 r\u00e9sum\u00e9"
+    hash[$S1] = "wide"
+
+    $I0 = find_encoding 'utf8'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'ascii', 'ascii key found via utf8 copy' )
+
+    $I0 = find_encoding 'ucs4'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'ascii', 'ascii key found via ucs4 copy' )
+
+    $I0 = find_encoding 'utf16'
+    $S2 = trans_encoding $S1, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'wide', 'utf8 key found via utf16 copy' )
+
+    $I0 = find_encoding 'ucs4'
+    $S2 = trans_encoding $S1, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'wide', 'utf8 key found via ucs4 copy' )
+.end
+
 # Switch to use integer keys instead of strings.
 .sub integer_keys
     .include "hash_key_type.pasm"
@@ -1363,6 +1395,56 @@ postit_end:
     is($S0, '', 'Item with key 0 deleted')
 .end
 
+.sub integer_keys_deleted_in_bulk
+    .include "hash_key_type.pasm"
+    .local pmc hash, it
+    .local int i, found, missing, seen
+    hash = new ['Hash']
+    hash = .Hash_key_type_int
+
+    i = 0
+  fill:
+    hash[i] = i
+    inc i
+    if i < 20000 goto fill
+
+    i = 0
+  remove:
+    delete hash[i]
+    i += 2
+    if i < 20000 goto remove
+
+    found   = 0
+    missing = 0
+    i       = 0
+  check:
+    $I0 = exists hash[i]
+    $I1 = i % 2
+    if $I0 == $I1 goto next
+    inc missing
+  next:
+    found += $I0
+    inc i
+    if i < 20000 goto check
+
+    is(found, 10000, 'odd integer keys survive deleting the even ones')
+    is(missing, 0, 'no key is found or lost by mistake')
+
+    seen = 0
+    it   = iter hash
+  iter_loop:
+    unless it goto iter_done
+    $P0 = shift it
+    $S0 = $P0
+    $I0 = $S0
+    $I1 = hash[$I0]
+    if $I0 != $I1 goto iter_loop
+    inc seen
+    goto iter_loop
+  iter_done:
+    is(seen, 10000, 'iteration visits each remaining key once')
+.end
+
 # Check that we can set various value types and they properly converted
 .sub value_types_convertion
     .local pmc hash
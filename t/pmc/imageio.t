@@ -18,7 +18,7 @@ Tests the ImageIO PMC.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(12)
+    plan(21)
 
     .local pmc frz, thw
     frz = new ['ImageIOFreeze']
@@ -57,6 +57,56 @@ Tests the ImageIO PMC.
     $P1 = thaw $S1
     is_deeply($P0, $P1, 'thaw gives same PMC as ImageIO (aggregate)')
     is_deeply($P0, test_pmc, 'round trip gives same PMC (aggregate)')
+
+    .local pmc fh
+    fh = new ['StringHandle']
+    fh.'open'('image', 'wb')
+    frz = new ['ImageIOFreeze'], fh
+    test_pmc = 'get_test_large'()
+    setref frz, test_pmc
+    $S0 = frz
+    is($S0, '', 'streamed image is not kept (large)')
+    $S0 = fh.'readall'()
+    fh.'close'()
+    $S1 = freeze test_pmc
+    is($S0, $S1, 'streamed image is the same as from freeze (large)')
+
+    fh.'open'('image', 'rb')
+    thw = new ['ImageIOThaw'], fh
+    $P0 = deref thw
+    fh.'close'()
+    $I0 = elements $P0
+    is($I0, 5000, 'thawed from handle (large)')
+    $S0 = $P0[4321;'s']
+    is($S0, 'item 4321', 'strings thawed from handle (large)')
+    $N0 = $P0[4999;'n']
+    is($N0, 1249.75, 'floats thawed from handle (large)')
+    $P1 = $P0[0;'shared']
+    $P2 = $P0[4999;'shared']
+    $I0 = issame $P1, $P2
+    ok($I0, 'PMCs shared across chunks thaw to one PMC (large)')
+
+    fh = new ['StringHandle']
+    fh.'open'('images', 'wb')
+    test_pmc = 'get_test_simple'()
+    $S0 = freeze test_pmc
+    fh.'print'($S0)
+    test_pmc = 'get_test_aggregate'()
+    $S0 = freeze test_pmc
+    fh.'print'($S0)
+    fh.'print'('trailer')
+    fh.'close'()
+
+    fh.'open'('images', 'rb')
+    thw = new ['ImageIOThaw'], fh
+    $P0 = deref thw
+    is($P0, -99, 'first of two images thawed from handle')
+    thw = new ['ImageIOThaw'], fh
+    $P0 = deref thw
+    is_deeply($P0, test_pmc, 'second image thawed from where the first ended')
+    $S0 = fh.'read'(100)
+    fh.'close'()
+    is($S0, 'trailer', 'thaw leaves the data after the image unread')
 .end
 
 .sub get_test_simple
@@ -65,6 +115,27 @@ Tests the ImageIO PMC.
     .return ($P0)
 .end
 
+.sub get_test_large
+    .local pmc list, shared, h
+    list   = new ['ResizablePMCArray']
+    shared = new ['Integer']
+    shared = 42
+    $I0 = 0
+  loop:
+    h = new ['Hash']
+    $S0 = $I0
+    $S0 = concat 'item ', $S0
+    h['s'] = $S0
+    $N0 = $I0
+    $N0 /= 4
+    h['n'] = $N0
+    h['shared'] = shared
+    push list, h
+    inc $I0
+    if $I0 < 5000 goto loop
+    .return (list)
+.end
+
 .sub get_test_aggregate
     $P0 = new ['ResizableStringArray']
     $P0[0] = 'parrot'
@@ -19,7 +19,7 @@ Tests the creation and invocation of Perl6 multi subs.
 .sub main :main
     .include 'test_more.pir'
 
-    plan( 8 )
+    plan( 11 )
 
     $P0 = new ['MultiSub']
     $I0 = defined $P0
@@ -51,6 +51,29 @@ Tests the creation and invocation of Perl6 multi subs.
     $S0 = foo($P1 :flat, $P2 :flat)
     is($S0, "testing 42, goodbye", "Int and String double :flat")
 
+    ## Dispatch results are cached until candidates change
+    $P0 = box 7
+    $S0 = bar($P0)
+    is($S0, "any", "only candidate chosen")
+    $S0 = bar($P0)
+    is($S0, "any", "same candidate chosen again")
+    $P1 = get_global 'bar'
+    $P2 = get_global 'baz'
+    $P3 = $P2[0]
+    push $P1, $P3
+    $S0 = bar($P0)
+    is($S0, "Integer", "closer candidate chosen once added")
+
+.end
+
+.sub bar :multi(_)
+    .param pmc x
+    .return ('any')
+.end
+
+.sub baz :multi(Integer)
+    .param pmc x
+    .return ('Integer')
 .end
 
 .sub foo :multi()
@@ -16,7 +16,7 @@ out-of-bounds test. Checks INT and PMC keys.
 
 =cut
 
-.const int TESTS = 63
+.const int TESTS = 68
 .const num PRECISION = 1e-6
 
 .sub 'test' :main
@@ -46,6 +46,7 @@ out-of-bounds test. Checks INT and PMC keys.
     push_float()
     shift_float()
     unshift_float()
+    shift_as_queue()
     check_interface()
     get_iter()
     'clone'()
@@ -406,6 +407,70 @@ out-of-bounds test. Checks INT and PMC keys.
     is($N0, 10.1, 'unshift float: second element', PRECISION)
 .end
 
+.sub shift_as_queue
+    .local pmc q
+    .local int i, next, in_order
+    q        = new ['ResizableFloatArray']
+    in_order = 1
+    next     = 0
+    i        = 0
+
+    # push three, shift two, so the array slides through its buffer
+  fill:
+    $N0 = i
+    push q, $N0
+    inc i
+    $N0 = i
+    push q, $N0
+    inc i
+    $N0 = i
+    push q, $N0
+    inc i
+    $N0 = shift q
+    $I0 = $N0
+    if $I0 == next goto fill_1
+    in_order = 0
+  fill_1:
+    inc next
+    $N0 = shift q
+    $I0 = $N0
+    if $I0 == next goto fill_2
+    in_order = 0
+  fill_2:
+    inc next
+    if i < 3000 goto fill
+
+    $I0 = elements q
+    is($I0, 1000, "RFA queue keeps pushed minus shifted elements")
+    $N0 = q[0]
+    $I0 = $N0
+    is($I0, 2000, "first element of RFA queue is the oldest one")
+    $N0 = q[999]
+    $I0 = $N0
+    is($I0, 2999, "last element of RFA queue is the newest one")
+
+    # unshift into the room left by shifting, then past it
+    i = 1999
+  front:
+    $N0 = i
+    unshift q, $N0
+    dec i
+    if i >= 0 goto front
+
+    next = 0
+  drain:
+    $N0 = shift q
+    $I0 = $N0
+    if $I0 == next goto drain_1
+    in_order = 0
+  drain_1:
+    inc next
+    $I0 = elements q
+    if $I0 goto drain
+    ok(in_order, "RFA queue shifts elements in order")
+    is(next, 3000, "RFA queue drains completely")
+.end
+
 .sub 'get_iter'
     $P0 = new ['ResizableFloatArray']
     $P0[0] = 1.1
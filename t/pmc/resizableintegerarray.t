@@ -42,7 +42,7 @@ Coverage plan:
 
 .sub main :main
     .include 'test_more.pir'
-    plan(55)
+    plan(60)
 
     test_does_interfaces()
 
@@ -70,6 +70,7 @@ Coverage plan:
     test_cant_pop_empty()
     test_shift()
     test_unshift()
+    shift_as_queue()
     test_cant_shift_empty()
     test_iterator()
     test_clone()
@@ -541,6 +542,61 @@ X1:
     is( $I1, 2, '... and stores values in correct order' )
 .end
 
+.sub shift_as_queue
+    .local pmc q
+    .local int i, next, in_order
+    q        = new ['ResizableIntegerArray']
+    in_order = 1
+    next     = 0
+    i        = 0
+
+    # push three, shift two, so the array slides through its buffer
+  fill:
+    push q, i
+    inc i
+    push q, i
+    inc i
+    push q, i
+    inc i
+    $I0 = shift q
+    if $I0 == next goto fill_1
+    in_order = 0
+  fill_1:
+    inc next
+    $I0 = shift q
+    if $I0 == next goto fill_2
+    in_order = 0
+  fill_2:
+    inc next
+    if i < 3000 goto fill
+
+    $I0 = elements q
+    is($I0, 1000, "RIA queue keeps pushed minus shifted elements")
+    $I0 = q[0]
+    is($I0, 2000, "first element of RIA queue is the oldest one")
+    $I0 = q[999]
+    is($I0, 2999, "last element of RIA queue is the newest one")
+
+    # unshift into the room left by shifting, then past it
+    i = 1999
+  front:
+    unshift q, i
+    dec i
+    if i >= 0 goto front
+
+    next = 0
+  drain:
+    $I0 = shift q
+    if $I0 == next goto drain_1
+    in_order = 0
+  drain_1:
+    inc next
+    $I0 = elements q
+    if $I0 goto drain
+    ok(in_order, "RIA queue shifts elements in order")
+    is(next, 3000, "RIA queue drains completely")
+.end
+
 .sub test_cant_shift_empty
     $P0 = new ['ResizableIntegerArray']
     $I0 = 1
@@ -22,7 +22,7 @@ out-of-bounds test. Checks INT and PMC keys.
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
 
-    plan(151)
+    plan(156)
 
     init_tests()
     resize_tests()
@@ -41,6 +41,7 @@ out-of-bounds test. Checks INT and PMC keys.
     get_mro_tests()
     push_and_pop()
     unshift_and_shift()
+    shift_as_queue()
     shift_empty()
     pop_empty()
     multikey_access()
@@ -597,6 +598,61 @@ loop:
     is(elements, 0, "expectedly empty RPA has 0 elements")
 .end
 
+.sub shift_as_queue
+    .local pmc q
+    .local int i, next, in_order
+    q        = new ['ResizablePMCArray']
+    in_order = 1
+    next     = 0
+    i        = 0
+
+    # push three, shift two, so the array slides through its buffer
+  fill:
+    push q, i
+    inc i
+    push q, i
+    inc i
+    push q, i
+    inc i
+    $I0 = shift q
+    if $I0 == next goto fill_1
+    in_order = 0
+  fill_1:
+    inc next
+    $I0 = shift q
+    if $I0 == next goto fill_2
+    in_order = 0
+  fill_2:
+    inc next
+    if i < 3000 goto fill
+
+    $I0 = elements q
+    is($I0, 1000, "RPA queue keeps pushed minus shifted elements")
+    $I0 = q[0]
+    is($I0, 2000, "first element of RPA queue is the oldest one")
+    $I0 = q[-1]
+    is($I0, 2999, "last element of RPA queue is the newest one")
+
+    # unshift into the room left by shifting, then past it
+    i = 1999
+  front:
+    unshift q, i
+    dec i
+    if i >= 0 goto front
+
+    next = 0
+  drain:
+    $I0 = shift q
+    if $I0 == next goto drain_1
+    in_order = 0
+  drain_1:
+    inc next
+    $I0 = elements q
+    if $I0 goto drain
+    ok(in_order, "RPA queue shifts elements in order")
+    is(next, 3000, "RPA queue drains completely")
+.end
+
 .sub shift_empty
     .local pmc pmc_arr
     pmc_arr = new ['ResizablePMCArray']
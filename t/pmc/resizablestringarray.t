@@ -22,7 +22,7 @@ out-of-bounds test. Checks INT and PMC keys.
     .include 'test_more.pir'
 
     # set a test plan
-    plan(271)
+    plan(276)
 
     'size/resize'()
     'clone'()
@@ -60,6 +60,7 @@ out-of-bounds test. Checks INT and PMC keys.
     'unshift_float'()
 
     'unshift_string_resize_threshold'()
+    shift_as_queue()
 
     'does'()
 #    'get_string'()
@@ -1102,6 +1103,61 @@ exception:
     is( $S9, "012345678", 'Unshift prepends at array instead of overlaying' )
 .end
 
+.sub shift_as_queue
+    .local pmc q
+    .local int i, next, in_order
+    q        = new ['ResizableStringArray']
+    in_order = 1
+    next     = 0
+    i        = 0
+
+    # push three, shift two, so the array slides through its buffer
+  fill:
+    push q, i
+    inc i
+    push q, i
+    inc i
+    push q, i
+    inc i
+    $I0 = shift q
+    if $I0 == next goto fill_1
+    in_order = 0
+  fill_1:
+    inc next
+    $I0 = shift q
+    if $I0 == next goto fill_2
+    in_order = 0
+  fill_2:
+    inc next
+    if i < 3000 goto fill
+
+    $I0 = elements q
+    is($I0, 1000, "RSA queue keeps pushed minus shifted elements")
+    $I0 = q[0]
+    is($I0, 2000, "first element of RSA queue is the oldest one")
+    $I0 = q[-1]
+    is($I0, 2999, "last element of RSA queue is the newest one")
+
+    # unshift into the room left by shifting, then past it
+    i = 1999
+  front:
+    unshift q, i
+    dec i
+    if i >= 0 goto front
+
+    next = 0
+  drain:
+    $I0 = shift q
+    if $I0 == next goto drain_1
+    in_order = 0
+  drain_1:
+    inc next
+    $I0 = elements q
+    if $I0 goto drain
+    ok(in_order, "RSA queue shifts elements in order")
+    is(next, 3000, "RSA queue drains completely")
+.end
+
 
 #
 # test unshifting INTVALs onto the array
@@ -24,7 +24,7 @@ stack, so we don't need to check if this parrot is IPv6-aware.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(20)
+    plan(25)
 
     test_init()
     test_get_fd()
@@ -39,6 +39,8 @@ stack, so we don't need to check if this parrot is IPv6-aware.
     test_udp_socket()
     test_udp_socket6()
     test_server()
+    test_tasks_wait_for_io()
+    test_close_wakes_task()
 
 .end
 
@@ -185,6 +187,115 @@ stack, so we don't need to check if this parrot is IPv6-aware.
     nok(status, 'Exit status of server process')
 .end
 
+.sub test_tasks_wait_for_io
+    .local pmc listener, sock, address, server
+    .local string str
+    .local int status, port
+
+    listener = new 'Socket'
+    listener.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = 1244
+    push_eh error
+  retry:
+    address = listener.'sockaddr'('localhost', port)
+    listener.'bind'(address)
+    goto bound
+  error:
+    inc port
+    if port < 1254 goto retry
+    pop_eh
+    skip(4, "couldn't bind to a free port")
+    .return ()
+
+  bound:
+    pop_eh
+    listener.'listen'(5)
+    set_global 'listener', listener
+
+    $P0 = get_global 'echo_once'
+    server = new 'Task', $P0
+    schedule server
+
+    # recv parks this task until the server task has answered, instead of
+    # blocking the only thread it would run on
+    sock = new 'Socket'
+    sock.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    address = sock.'sockaddr'('localhost', port)
+    sock.'connect'(address)
+    status = sock.'send'('task message')
+    is(status, 12, 'send to a task')
+    str = sock.'recv'()
+    is(str, 'task message', 'recv from a task')
+    sock.'close'()
+
+    # the server task is done by now, and waiting on a finished task would
+    # never return
+    listener.'close'()
+.end
+
+.sub echo_once
+    .local pmc listener, conn
+    .local string str
+
+    listener = get_global 'listener'
+    conn = listener.'accept'()
+    ok(1, 'accept in a task')
+    str = conn.'recv'()
+    is(str, 'task message', 'recv in a task')
+    conn.'send'(str)
+    conn.'close'()
+.end
+
+.sub test_close_wakes_task
+    .local pmc listener, address, waiter
+    .local int port
+
+    listener = new 'Socket'
+    listener.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = 1254
+    push_eh error
+  retry:
+    address = listener.'sockaddr'('localhost', port)
+    listener.'bind'(address)
+    goto bound
+  error:
+    inc port
+    if port < 1264 goto retry
+    pop_eh
+    skip(1, "couldn't bind to a free port")
+    .return ()
+
+  bound:
+    pop_eh
+    listener.'listen'(5)
+    set_global 'listener', listener
+
+    $P0 = get_global 'accept_closed'
+    waiter = new 'Task', $P0
+    schedule waiter
+
+    # let the task park in accept, then close the socket under it
+    pass
+    listener.'close'()
+    wait waiter
+.end
+
+.sub accept_closed
+    .local pmc listener, conn
+
+    listener = get_global 'listener'
+    push_eh error
+    conn = listener.'accept'()
+    pop_eh
+    $I0 = isnull conn
+    ok($I0, 'close wakes a task parked in accept')
+    .return ()
+
+  error:
+    pop_eh
+    ok(1, 'close wakes a task parked in accept')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -0,0 +1,184 @@
+#!./parrot
+# Copyright (C) 2011, Parrot Foundation.
+
+=head1 NAME
+
+t/pmc/workerpool.t - Worker pools
+
+=head1 SYNOPSIS
+
+    % prove t/pmc/workerpool.t
+
+=head1 DESCRIPTION
+
+Tests running subs on a pool of worker threads.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+
+    plan(11)
+
+    pool_size()
+    run_jobs()
+    copy_data()
+    run_task()
+    job_error()
+    bad_job()
+.end
+
+.sub pool_size
+    $P0 = new 'WorkerPool', 2
+    $I0 = $P0
+    is($I0, 2, "pool has 2 workers")
+
+    $P0 = new 'WorkerPool'
+    $I0 = $P0
+    $I1 = $I0 > 0
+    ok($I1, "default pool has workers")
+.end
+
+.sub run_jobs
+    .local pmc pool, sum, ids
+    pool = new 'WorkerPool', 2
+    sum  = get_global 'sum_to'
+    ids  = new 'ResizableIntegerArray'
+
+    $I0 = 0
+  submit_loop:
+    if $I0 >= 8 goto submit_done
+    $I1 = $I0 * 100
+    $P0 = box $I1
+    $I2 = pool.'submit'(sum, $P0)
+    push ids, $I2
+    inc $I0
+    goto submit_loop
+  submit_done:
+
+    .local int good
+    good = 1
+    $I0 = 0
+  result_loop:
+    if $I0 >= 8 goto result_done
+    $I1 = ids[$I0]
+    $P0 = pool.'result'($I1)
+    $I2 = $P0
+    $I3 = $I0 * 100
+    $I4 = $I3 + 1
+    $I3 = $I3 * $I4
+    $I3 = $I3 / 2
+    if $I2 == $I3 goto next_result
+    good = 0
+  next_result:
+    inc $I0
+    goto result_loop
+  result_done:
+    ok(good, "8 jobs on 2 workers")
+
+    $P0 = get_global 'answer'
+    $I0 = pool.'submit'($P0)
+    $P1 = pool.'result'($I0)
+    is($P1, 42, "job without data")
+
+    $I0 = pool.'submit'($P0)
+  wait_ready:
+    $I1 = pool.'ready'($I0)
+    unless $I1 goto wait_ready
+    ok($I1, "job becomes ready")
+    $P1 = pool.'result'($I0)
+    is($P1, 42, "result after ready")
+.end
+
+.sub copy_data
+    .local pmc pool, data
+    pool = new 'WorkerPool', 1
+    data = new 'ResizablePMCArray'
+    push data, 1
+    push data, 2
+
+    $P0 = get_global 'append'
+    $I0 = pool.'submit'($P0, data)
+    $P1 = pool.'result'($I0)
+
+    $I1 = elements data
+    is($I1, 2, "data is copied to the worker")
+    $I1 = elements $P1
+    is($I1, 3, "result is copied back")
+.end
+
+.sub run_task
+    $P0 = new 'WorkerPool', 1
+    $P1 = get_global 'sum_to'
+    $P2 = new 'Hash'
+    $P2['code'] = $P1
+    $P3 = box 10
+    $P2['data'] = $P3
+    $P4 = new 'Task', $P2
+    $I0 = $P0.'submit'($P4)
+    $P5 = $P0.'result'($I0)
+    is($P5, 55, "task code runs with task data")
+.end
+
+.sub job_error
+    $P0 = new 'WorkerPool', 1
+    $P1 = get_global 'fail'
+    $I0 = $P0.'submit'($P1)
+    push_eh caught
+    $P2 = $P0.'result'($I0)
+    pop_eh
+    ok(0, "error is rethrown")
+    .return ()
+  caught:
+    .get_results ($P3)
+    pop_eh
+    $S0 = $P3
+    is($S0, "job failed", "error is rethrown")
+.end
+
+.sub bad_job
+    $P0 = new 'WorkerPool', 1
+    $P1 = new 'Integer'
+    push_eh caught
+    $P0.'submit'($P1)
+    pop_eh
+    ok(0, "only subs can be submitted")
+    .return ()
+  caught:
+    pop_eh
+    ok(1, "only subs can be submitted")
+.end
+
+.sub sum_to
+    .param pmc n
+    .local int i, sum
+    sum = 0
+    i = n
+  loop:
+    if i == 0 goto done
+    sum += i
+    dec i
+    goto loop
+  done:
+    .return (sum)
+.end
+
+.sub answer
+    .return (42)
+.end
+
+.sub append
+    .param pmc list
+    push list, 3
+    .return (list)
+.end
+
+.sub fail
+    die "job failed"
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
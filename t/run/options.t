@@ -19,7 +19,7 @@ use strict;
 use warnings;
 use lib qw( lib . ../lib ../../lib );
 
-use Test::More tests => 35;
+use Test::More tests => 48;
 use Parrot::Config;
 use File::Temp 0.13 qw/tempfile/;
 use File::Spec;
@@ -76,7 +76,7 @@ is( `"$PARROT" --trace "$first_pir_file" "$second_pir_file" $redir`,
 my $cmd;
 
 ## this test assumes these cores work on all platforms (a safe assumption)
-for my $val (qw/ slow fast bounds trace /) {
+for my $val (qw/ slow fast bounds trace cgoto threaded jit /) {
     for my $opt ( '-R ', '--runcore ', '--runcore=' ) {
         $cmd = qq{"$PARROT" $opt$val "$second_pir_file" $redir};
         is( qx{$cmd}, "second\n", "<$opt$val> option)" ) or diag $cmd;
@@ -115,6 +115,71 @@ like( $output, qr/maximum GC nursery size is 50%/,
                  '--gc-nursery-size max warning' );
 is( $exit, 0, '... and should not crash' );
 
+$output = qx{$PARROT --gc-threads=0 2>&1 };
+$exit   = $? & 127;
+like( $output, qr/GC threads must be between 1 and 256/,
+                 '--gc-threads range warning' );
+is( $exit, 0, '... and should not crash' );
+
+is( qx{$PARROT --gc-threads=4 "$first_pir_file"}, "first\n", '--gc-threads' );
+
+# Keep a heap alive across enough collections that the older generations
+# get marked by the helper threads too, then check nothing was lost
+my ( $old_gen_fh, $old_gen_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+print $old_gen_fh <<'END_PIR';
+.include 'interpinfo.pasm'
+.sub main :main
+    .local pmc keep, row
+    .local int i, j, runs, sum
+    keep = new ['ResizablePMCArray']
+    i = 0
+  fill:
+    row = new ['ResizableStringArray']
+    j = 0
+  fill_row:
+    $S0 = j
+    push row, $S0
+    inc j
+    if j < 10 goto fill_row
+    push keep, row
+    inc i
+    if i < 200 goto fill
+
+    # every 10th, 100th and 1000th run collects the older generations
+    i = 0
+  churn:
+    $P0 = new ['ResizablePMCArray']
+    $P0[100] = i
+    $I0 = i % 200
+    row = keep[$I0]
+    $I1 = i % 10
+    $S0 = $I1
+    row[$I1] = $S0
+    sweep 1
+    inc i
+    runs = interpinfo .INTERPINFO_GC_MARK_RUNS
+    if runs < 1000 goto churn
+
+    sum = 0
+    i = 0
+  check:
+    row = keep[i]
+    j = 0
+  check_row:
+    $S0 = row[j]
+    $I0 = $S0
+    sum += $I0
+    inc j
+    if j < 10 goto check_row
+    inc i
+    if i < 200 goto check
+    say sum
+.end
+END_PIR
+close $old_gen_fh;
+is( qx{$PARROT -g gms --gc-threads=4 "$old_gen_pir_file"}, "9000\n",
+    '--gc-threads marks old generations' );
+
 
 # Test --leak-test
 is( qx{$PARROT --leak-test "$first_pir_file"}, "first\n", '--leak-test' );
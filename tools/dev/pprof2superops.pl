@@ -0,0 +1,120 @@
+#! perl
+
+# Copyright (C) 2011, Parrot Foundation.
+
+use strict;
+use warnings;
+
+use Getopt::Long;
+
+=head1 NAME
+
+tools/dev/pprof2superops.pl
+
+=head1 DESCRIPTION
+
+Find the most frequently executed sequences of ops in the output of Parrot's
+profiling runcore.  The result is a superinstruction profile which F<ops2c>
+uses to generate fused ops for those sequences.
+
+=head1 SYNOPSIS
+
+    PARROT_PROFILING_FULL_OPNAMES=1 ./parrot -Rprofiling foo.pir
+    perl tools/dev/pprof2superops.pl [--top=N] parrot.pprof.1234 > src/ops/ops.super
+
+=head1 USAGE
+
+Record a profile with the B<PARROT_PROFILING_FULL_OPNAMES> environment variable
+set, so that the profile names ops by their full names (e.g. C<lt_i_i_ic>).
+Any number of profiles can be given; their counts are added together.
+
+Every sequence of two or three ops executed one after another in the same
+context is counted.  Sequences are ranked by the number of dispatches a fused
+op would save, i.e. their count times their length minus one, and the best
+C<--top> (default 32) are written to standard output, one per line:
+
+    <count> <op> <op> [<op>]
+
+F<ops2c> only fuses sequences whose leading ops never branch, so some of the
+listed sequences may be skipped when the ops are generated.
+
+=cut
+
+my $top = 32;
+
+GetOptions( 'top=i' => \$top ) && @ARGV
+    or die "usage: $0 [--top=N] parrot.pprof.XXXX [...]\n";
+
+my %count;
+
+for my $file (@ARGV) {
+    count_sequences( $file, \%count );
+}
+
+my @sequences =
+    sort { saved( $b, \%count ) <=> saved( $a, \%count ) || $a cmp $b } keys %count;
+
+splice @sequences, $top if @sequences > $top;
+
+print "# superinstruction profile generated by $0\n";
+print "# count ops\n";
+print "$count{$_} $_\n" for @sequences;
+
+=head1 FUNCTIONS
+
+=over 4
+
+=item C<count_sequences($file, $count)>
+
+Add the number of times each sequence of ops was executed in the pprof file
+C<$file> to the hash C<$count>.  Context switches and the ends of runloops
+break sequences, since the ops on either side of them are not adjacent in the
+bytecode.
+
+=cut
+
+sub count_sequences {
+    my ( $file, $count ) = @_;
+
+    open my $fh, '<', $file or die "Can't open $file: $!\n";
+
+    my @window;
+    while ( my $line = <$fh> ) {
+        if ( $line =~ /^OP:.*\{x\{op:([^}]+)\}x\}/ ) {
+            push @window, $1;
+            shift @window if @window > 3;
+
+            $count->{"@window[-2, -1]"}++ if @window >= 2;
+            $count->{"@window"}++         if @window == 3;
+        }
+        elsif ( $line =~ /^(?:CS|END_OF_RUNLOOP):/ ) {
+            @window = ();
+        }
+    }
+
+    close $fh;
+}
+
+=item C<saved($sequence, $count)>
+
+Returns the number of dispatches which fusing C<$sequence> would have saved.
+
+=cut
+
+sub saved {
+    my ( $sequence, $count ) = @_;
+    my @ops = split / /, $sequence;
+
+    return $count->{$sequence} * ( @ops - 1 );
+}
+
+=back
+
+=cut
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4: